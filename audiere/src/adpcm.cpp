@@ -0,0 +1,429 @@
+#include "adpcm.h"
+#include "cpu.h"
+#include "utility.h"
+
+#ifdef ADR_SIMD_X86
+  #include <emmintrin.h>
+#endif
+#ifdef ADR_SIMD_AVX2
+  #include <immintrin.h>
+#endif
+
+
+namespace audiere {
+
+  static const int IMA_INDEX_TABLE[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8,
+  };
+
+  static const int IMA_STEP_TABLE[89] = {
+        7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+       19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+       50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+      130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+      337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+      876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+     2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+     5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+  };
+
+  static const int MS_ADAPTATION_TABLE[16] = {
+    230, 230, 230, 230, 307, 409, 512, 614,
+    768, 614, 512, 409, 307, 230, 230, 230,
+  };
+
+  const s16 MS_ADPCM_DEFAULT_COEFS[7][2] = {
+    { 256,    0 },
+    { 512, -256 },
+    {   0,    0 },
+    { 192,   64 },
+    { 240,    0 },
+    { 460, -208 },
+    { 392, -232 },
+  };
+
+
+  /// Decodes one IMA ADPCM nibble, updating the predictor and step index.
+  static inline s16 DecodeIMANibble(int& predictor, int& index, int nibble) {
+    const int step = IMA_STEP_TABLE[index];
+    int diff = step >> 3;
+    if (nibble & 4) diff += step;
+    if (nibble & 2) diff += step >> 1;
+    if (nibble & 1) diff += step >> 2;
+    predictor += (nibble & 8 ? -diff : diff);
+    predictor = clamp(-32768, predictor, 32767);
+    index = clamp(0, index + IMA_INDEX_TABLE[nibble], 88);
+    return s16(predictor);
+  }
+
+
+  int GetADPCMBlockFrames(int format_tag, int block_size, int channel_count) {
+    if (channel_count < 1) {
+      return 0;
+    }
+    if (format_tag == WAV_FORMAT_IMA_ADPCM) {
+      // a header sample, then eight samples per four bytes per channel
+      const int header_size = 4 * channel_count;
+      if (block_size < header_size) {
+        return 0;
+      }
+      return 1 + (block_size - header_size) / header_size * 8;
+    } else if (format_tag == WAV_FORMAT_MS_ADPCM) {
+      // two header samples, then two samples per byte
+      const int header_size = 7 * channel_count;
+      if (block_size < header_size) {
+        return 0;
+      }
+      return 2 + (block_size - header_size) * 2 / channel_count;
+    } else {
+      return 0;
+    }
+  }
+
+
+  int GetADPCMFrameCount(
+    int format_tag, int size, int block_align, int channel_count)
+  {
+    if (block_align <= 0) {
+      return 0;
+    }
+    const int full_blocks = size / block_align;
+    return
+      full_blocks * GetADPCMBlockFrames(format_tag, block_align, channel_count) +
+      GetADPCMBlockFrames(format_tag, size % block_align, channel_count);
+  }
+
+
+  int DecodeIMAWavBlock(
+    const u8* block, int block_size, int channel_count, s16* out)
+  {
+    const int frames = GetADPCMBlockFrames(
+      WAV_FORMAT_IMA_ADPCM, block_size, channel_count);
+    if (frames == 0 || channel_count > 2) {
+      return 0;
+    }
+
+    int predictor[2];
+    int index[2];
+    for (int c = 0; c < channel_count; ++c) {
+      predictor[c] = s16(read16_le(block + c * 4));
+      index[c]     = clamp(0, int(block[c * 4 + 2]), 88);
+      out[c]       = s16(predictor[c]);
+    }
+
+    // Each channel has four bytes, eight samples, at a time in turn.
+    const u8* data = block + 4 * channel_count;
+    for (int first = 1; first < frames; first += 8) {
+      for (int c = 0; c < channel_count; ++c) {
+        for (int i = 0; i < 8; ++i) {
+          const int nibble = (data[i / 2] >> ((i & 1) * 4)) & 0xF;
+          out[(first + i) * channel_count + c] =
+            DecodeIMANibble(predictor[c], index[c], nibble);
+        }
+        data += 4;
+      }
+    }
+    return frames;
+  }
+
+
+  int DecodeMSWavBlock(
+    const u8* block, int block_size, int channel_count,
+    const s16* coefs, int coef_count, s16* out)
+  {
+    const int frames = GetADPCMBlockFrames(
+      WAV_FORMAT_MS_ADPCM, block_size, channel_count);
+    if (frames == 0 || channel_count > 2 || coef_count < 1) {
+      return 0;
+    }
+
+    int coef1[2], coef2[2], delta[2], sample1[2], sample2[2];
+    const u8* p = block;
+    for (int c = 0; c < channel_count; ++c) {
+      int predictor = *p++;
+      if (predictor >= coef_count) {
+        predictor = 0;
+      }
+      coef1[c] = coefs[predictor * 2];
+      coef2[c] = coefs[predictor * 2 + 1];
+    }
+    for (int c = 0; c < channel_count; ++c, p += 2) {
+      delta[c] = s16(read16_le(p));
+    }
+    for (int c = 0; c < channel_count; ++c, p += 2) {
+      sample1[c] = s16(read16_le(p));
+    }
+    for (int c = 0; c < channel_count; ++c, p += 2) {
+      sample2[c] = s16(read16_le(p));
+    }
+
+    // the older sample comes out first
+    for (int c = 0; c < channel_count; ++c) {
+      out[c]                 = s16(sample2[c]);
+      out[channel_count + c] = s16(sample1[c]);
+    }
+
+    // the rest alternate between the channels, high nibble first
+    s16* o = out + 2 * channel_count;
+    const int nibble_count = (frames - 2) * channel_count;
+    for (int n = 0; n < nibble_count; ++n) {
+      const int c = n % channel_count;
+      const int nibble = (n & 1 ? p[n / 2] & 0xF : p[n / 2] >> 4);
+      const int predictor =
+        (sample1[c] * coef1[c] + sample2[c] * coef2[c]) / 256;
+      const int sample = clamp(
+        -32768, predictor + (nibble >= 8 ? nibble - 16 : nibble) * delta[c],
+        32767);
+      sample2[c] = sample1[c];
+      sample1[c] = sample;
+      delta[c] = std::max(16, (MS_ADAPTATION_TABLE[nibble] * delta[c]) >> 8);
+      *o++ = s16(sample);
+    }
+    return frames;
+  }
+
+
+  void EncodeADPCMBlock(
+    const s16* samples, int stride, ADPCMEncoderState& state, u8* block)
+  {
+    block[0] = u8(state.predictor & 0xFF);
+    block[1] = u8((state.predictor >> 8) & 0xFF);
+    block[2] = u8(state.index);
+    block[3] = 0;
+
+    u8* data = block + 4;
+    for (int i = 0; i < ADPCM_BLOCK_FRAMES; ++i) {
+      int diff = samples[i * stride] - state.predictor;
+      int nibble = 0;
+      if (diff < 0) {
+        nibble = 8;
+        diff = -diff;
+      }
+
+      // pick the nibble whose step is closest, as the decoder sees it
+      const int step = IMA_STEP_TABLE[state.index];
+      if (diff >= step) {
+        nibble |= 4;
+        diff -= step;
+      }
+      if (diff >= step >> 1) {
+        nibble |= 2;
+        diff -= step >> 1;
+      }
+      if (diff >= step >> 2) {
+        nibble |= 1;
+      }
+      DecodeIMANibble(state.predictor, state.index, nibble);
+
+      if (i & 1) {
+        data[i / 2] |= u8(nibble << 4);
+      } else {
+        data[i / 2] = u8(nibble);
+      }
+    }
+  }
+
+
+  static void DecodeADPCMBlock(const u8* block, s16* out) {
+    int predictor = s16(read16_le(block));
+    int index = clamp(0, int(block[2]), 88);
+    const u8* data = block + 4;
+    for (int i = 0; i < ADPCM_BLOCK_FRAMES; i += 2) {
+      const int byte = data[i / 2];
+      out[i]     = DecodeIMANibble(predictor, index, byte & 0xF);
+      out[i + 1] = DecodeIMANibble(predictor, index, byte >> 4);
+    }
+  }
+
+
+#ifdef ADR_SIMD_X86
+
+  /*
+   * The SIMD decoders decode four blocks at once, one per 32-bit lane.
+   * The results are bit-exact with DecodeADPCMBlock.
+   */
+
+  /// Reads the headers of four blocks into the lanes.
+  ADR_TARGET_SSE2 static inline void LoadLanes(
+    const u8* blocks, const u8* data[4], __m128i& predictor, __m128i& index)
+  {
+    int p[4], idx[4];
+    for (int lane = 0; lane < 4; ++lane) {
+      const u8* block = blocks + lane * ADPCM_BLOCK_SIZE;
+      p[lane]    = s16(read16_le(block));
+      idx[lane]  = clamp(0, int(block[2]), 88);
+      data[lane] = block + 4;
+    }
+    predictor = _mm_setr_epi32(p[0], p[1], p[2], p[3]);
+    index     = _mm_setr_epi32(idx[0], idx[1], idx[2], idx[3]);
+  }
+
+
+  /// Returns nibble i of each lane's data.
+  ADR_TARGET_SSE2 static inline __m128i GetNibbles(const u8* data[4], int i) {
+    const int shift = (i & 1) * 4;
+    return _mm_setr_epi32(
+      (data[0][i / 2] >> shift) & 0xF,
+      (data[1][i / 2] >> shift) & 0xF,
+      (data[2][i / 2] >> shift) & 0xF,
+      (data[3][i / 2] >> shift) & 0xF);
+  }
+
+
+  /// Decodes one nibble per lane, given the step size of each lane.
+  ADR_TARGET_SSE2 static inline void DecodeNibbles(
+    __m128i nibble, __m128i step, __m128i& predictor, __m128i& index)
+  {
+    const __m128i one   = _mm_set1_epi32(1);
+    const __m128i two   = _mm_set1_epi32(2);
+    const __m128i three = _mm_set1_epi32(3);
+    const __m128i four  = _mm_set1_epi32(4);
+    const __m128i six   = _mm_set1_epi32(6);
+    const __m128i seven = _mm_set1_epi32(7);
+    const __m128i eight = _mm_set1_epi32(8);
+    const __m128i max_index = _mm_set1_epi32(88);
+    const __m128i zero = _mm_setzero_si128();
+
+    // diff = step/8 + (n&4 ? step) + (n&2 ? step/2) + (n&1 ? step/4)
+    __m128i diff = _mm_srai_epi32(step, 3);
+    __m128i bit = _mm_cmpeq_epi32(_mm_and_si128(nibble, four), four);
+    diff = _mm_add_epi32(diff, _mm_and_si128(bit, step));
+    bit = _mm_cmpeq_epi32(_mm_and_si128(nibble, two), two);
+    diff = _mm_add_epi32(diff, _mm_and_si128(bit, _mm_srai_epi32(step, 1)));
+    bit = _mm_cmpeq_epi32(_mm_and_si128(nibble, one), one);
+    diff = _mm_add_epi32(diff, _mm_and_si128(bit, _mm_srai_epi32(step, 2)));
+
+    // negate where n&8, then clamp to 16 bits by packing with saturation
+    const __m128i sign = _mm_cmpeq_epi32(_mm_and_si128(nibble, eight), eight);
+    diff = _mm_sub_epi32(_mm_xor_si128(diff, sign), sign);
+    const __m128i packed = _mm_packs_epi32(
+      _mm_add_epi32(predictor, diff), zero);
+    predictor = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+
+    // index += (n&7) < 4 ? -1 : 2*(n&7) - 6, clamped to [0, 88].  The
+    // 16-bit min and max work since the index always fits in 16 bits.
+    const __m128i magnitude = _mm_and_si128(nibble, seven);
+    const __m128i big = _mm_cmpgt_epi32(magnitude, three);
+    const __m128i up = _mm_sub_epi32(_mm_add_epi32(magnitude, magnitude), six);
+    const __m128i change = _mm_or_si128(
+      _mm_and_si128(big, up), _mm_andnot_si128(big, _mm_set1_epi32(-1)));
+    index = _mm_add_epi32(index, change);
+    index = _mm_min_epi16(_mm_max_epi16(index, zero), max_index);
+  }
+
+
+  /// Writes sample i of each lane's block.
+  ADR_TARGET_SSE2 static inline void StoreLanes(
+    __m128i predictor, s16* out, int i)
+  {
+#if defined(_MSC_VER)
+    __declspec(align(16)) int lanes[4];
+#else
+    int lanes[4] __attribute__((aligned(16)));
+#endif
+    _mm_store_si128((__m128i*)lanes, predictor);
+    out[i]                          = s16(lanes[0]);
+    out[i + ADPCM_BLOCK_FRAMES]     = s16(lanes[1]);
+    out[i + ADPCM_BLOCK_FRAMES * 2] = s16(lanes[2]);
+    out[i + ADPCM_BLOCK_FRAMES * 3] = s16(lanes[3]);
+  }
+
+
+  /// SSE2 can't gather, so the step sizes are looked up a lane at a time.
+  ADR_TARGET_SSE2 static void DecodeADPCMBlocks4_SSE2(
+    const u8* blocks, s16* out)
+  {
+    const u8* data[4];
+    __m128i predictor, index;
+    LoadLanes(blocks, data, predictor, index);
+
+#if defined(_MSC_VER)
+    __declspec(align(16)) int lanes[4];
+#else
+    int lanes[4] __attribute__((aligned(16)));
+#endif
+
+    for (int i = 0; i < ADPCM_BLOCK_FRAMES; ++i) {
+      _mm_store_si128((__m128i*)lanes, index);
+      const __m128i step = _mm_setr_epi32(
+        IMA_STEP_TABLE[lanes[0]], IMA_STEP_TABLE[lanes[1]],
+        IMA_STEP_TABLE[lanes[2]], IMA_STEP_TABLE[lanes[3]]);
+      DecodeNibbles(GetNibbles(data, i), step, predictor, index);
+      StoreLanes(predictor, out, i);
+    }
+  }
+
+#endif
+
+
+#ifdef ADR_SIMD_AVX2
+
+  ADR_TARGET_AVX2 static void DecodeADPCMBlocks4_AVX2(
+    const u8* blocks, s16* out)
+  {
+    const u8* data[4];
+    __m128i predictor, index;
+    LoadLanes(blocks, data, predictor, index);
+
+    for (int i = 0; i < ADPCM_BLOCK_FRAMES; ++i) {
+      const __m128i step = _mm_i32gather_epi32(IMA_STEP_TABLE, index, 4);
+      DecodeNibbles(GetNibbles(data, i), step, predictor, index);
+      StoreLanes(predictor, out, i);
+    }
+  }
+
+#endif
+
+
+  typedef void (*DecodeBlocks4Function)(const u8* blocks, s16* out);
+
+  struct ADPCMKernels {
+    /// Decodes four consecutive blocks, or is 0 for the scalar decoder.
+    DecodeBlocks4Function decode_blocks4;
+  };
+
+#ifdef ADR_SIMD_AVX2
+  static const ADPCMKernels AVX2_KERNELS = { DecodeADPCMBlocks4_AVX2 };
+#endif
+#ifdef ADR_SIMD_X86
+  static const ADPCMKernels SSE2_KERNELS = { DecodeADPCMBlocks4_SSE2 };
+#endif
+  static const ADPCMKernels SCALAR_KERNELS = { 0 };
+
+  static const KernelChoice<ADPCMKernels> ADPCM_KERNELS[] = {
+#ifdef ADR_SIMD_AVX2
+    { SIMD_AVX2, &AVX2_KERNELS   },
+#endif
+#ifdef ADR_SIMD_X86
+    { SIMD_SSE2, &SSE2_KERNELS   },
+#endif
+    { SIMD_NONE, &SCALAR_KERNELS },
+  };
+
+  static SIMDLevel GetADPCMLevel() {
+    return ChooseKernels(ADPCM_KERNELS).level;
+  }
+
+  static KernelRegistration g_registration("adpcm", GetADPCMLevel);
+
+
+  void DecodeADPCMBlocks(const u8* blocks, int count, s16* out) {
+    const DecodeBlocks4Function decode_blocks4 =
+      ChooseKernels(ADPCM_KERNELS).kernels->decode_blocks4;
+
+    int i = 0;
+    if (decode_blocks4) {
+      for (; i + 4 <= count; i += 4) {
+        decode_blocks4(
+          blocks + i * ADPCM_BLOCK_SIZE, out + i * ADPCM_BLOCK_FRAMES);
+      }
+    }
+    for (; i < count; ++i) {
+      DecodeADPCMBlock(
+        blocks + i * ADPCM_BLOCK_SIZE, out + i * ADPCM_BLOCK_FRAMES);
+    }
+  }
+
+}
@@ -0,0 +1,94 @@
+/**
+ * @file
+ *
+ * IMA and Microsoft ADPCM decoders for WAV files, and the IMA ADPCM
+ * block format that ADPCM sample buffers are stored in.
+ */
+
+#ifndef ADPCM_H
+#define ADPCM_H
+
+
+#include "types.h"
+
+
+namespace audiere {
+
+  /// WAVE_FORMAT_ADPCM
+  const int WAV_FORMAT_MS_ADPCM  = 0x0002;
+  /// WAVE_FORMAT_IMA_ADPCM (also called WAVE_FORMAT_DVI_ADPCM)
+  const int WAV_FORMAT_IMA_ADPCM = 0x0011;
+
+
+  /**
+   * Returns the number of frames a WAV ADPCM block decodes to.  The last
+   * block of a file may be shorter than the block alignment.
+   *
+   * @param format_tag     WAV_FORMAT_MS_ADPCM or WAV_FORMAT_IMA_ADPCM
+   * @param block_size     bytes in the block
+   * @param channel_count  number of interleaved channels
+   */
+  int GetADPCMBlockFrames(int format_tag, int block_size, int channel_count);
+
+  /// Returns the number of frames in size bytes of WAV ADPCM data.
+  int GetADPCMFrameCount(
+    int format_tag, int size, int block_align, int channel_count);
+
+  /**
+   * Decodes one block of a WAV IMA ADPCM stream.
+   *
+   * @return  number of frames written to out
+   */
+  int DecodeIMAWavBlock(
+    const u8* block, int block_size, int channel_count, s16* out);
+
+  /**
+   * Decodes one block of a WAV Microsoft ADPCM stream.
+   *
+   * @param coefs       coef_count pairs of predictor coefficients
+   *
+   * @return  number of frames written to out
+   */
+  int DecodeMSWavBlock(
+    const u8* block, int block_size, int channel_count,
+    const s16* coefs, int coef_count, s16* out);
+
+  /// The seven coefficient pairs every Microsoft ADPCM file starts with.
+  extern const s16 MS_ADPCM_DEFAULT_COEFS[7][2];
+
+
+  /**
+   * ADPCM sample buffers store each channel as independent IMA ADPCM
+   * blocks of ADPCM_BLOCK_FRAMES samples: the predictor as a little endian
+   * s16, the step index, a pad byte, and then two samples per byte, low
+   * nibble first.  The header holds the encoder state from before the
+   * block's first sample, so any block can be decoded on its own.
+   */
+  const int ADPCM_BLOCK_FRAMES = 256;
+  const int ADPCM_BLOCK_SIZE   = 4 + ADPCM_BLOCK_FRAMES / 2;
+
+  /// Encoder state carried from one block of a channel to the next.
+  struct ADPCMEncoderState {
+    int predictor;
+    int index;
+  };
+
+  /**
+   * Encodes ADPCM_BLOCK_FRAMES samples, read every stride samples from
+   * samples, into a block.
+   */
+  void EncodeADPCMBlock(
+    const s16* samples, int stride, ADPCMEncoderState& state, u8* block);
+
+  /**
+   * Decodes count consecutive blocks.  Block i's samples go to
+   * out + i * ADPCM_BLOCK_FRAMES.  Where SSE2 is available, four blocks
+   * are decoded at once, one in each lane; with AVX2 the step sizes are
+   * gathered too.
+   */
+  void DecodeADPCMBlocks(const u8* blocks, int count, s16* out);
+
+}
+
+
+#endif
@@ -0,0 +1,254 @@
+#include <string.h>
+#include "adpcm.h"
+#include "audiere.h"
+#include "basic_source.h"
+#include "convert.h"
+#include "debug.h"
+#include "internal.h"
+#include "parallel_decode.h"
+#include "threads.h"
+#include "utility.h"
+
+
+namespace audiere {
+
+  /// Streams decode this many blocks of each channel at a time.
+  static const int GROUP_BLOCKS = 4;
+  static const int GROUP_FRAMES = GROUP_BLOCKS * ADPCM_BLOCK_FRAMES;
+
+
+  /**
+   * SampleBuffer that stores its samples as IMA ADPCM.  Each channel is
+   * a run of blocks, so a stream can decode several consecutive blocks of
+   * a channel with one call to DecodeADPCMBlocks.
+   */
+  class ADPCMSampleBuffer : public RefImplementation<SampleBuffer> {
+  public:
+    /// Encodes frame_count frames of interleaved 16-bit samples.
+    ADPCMSampleBuffer(
+      const s16* samples, int frame_count,
+      int channel_count, int sample_rate)
+    {
+      m_frame_count   = frame_count;
+      m_channel_count = channel_count;
+      m_sample_rate   = sample_rate;
+      m_block_count   = (frame_count + ADPCM_BLOCK_FRAMES - 1) /
+                        ADPCM_BLOCK_FRAMES;
+      m_blocks        = new u8[m_block_count * channel_count * ADPCM_BLOCK_SIZE];
+      m_samples       = 0;
+
+      // the last block is padded with silence
+      const int full_blocks = frame_count / ADPCM_BLOCK_FRAMES;
+      s16* last = new s16[ADPCM_BLOCK_FRAMES * channel_count];
+      memset(last, 0, ADPCM_BLOCK_FRAMES * channel_count * sizeof(s16));
+      memcpy(last, samples + full_blocks * ADPCM_BLOCK_FRAMES * channel_count,
+             (frame_count - full_blocks * ADPCM_BLOCK_FRAMES) *
+               channel_count * sizeof(s16));
+
+      for (int c = 0; c < channel_count; ++c) {
+        ADPCMEncoderState state;
+        state.predictor = (frame_count > 0 ? samples[c] : 0);
+        state.index     = 0;
+
+        for (int k = 0; k < m_block_count; ++k) {
+          const s16* in = (k < full_blocks ?
+            samples + k * ADPCM_BLOCK_FRAMES * channel_count :
+            last);
+          EncodeADPCMBlock(in + c, channel_count, state, getBlock(c, k));
+        }
+      }
+
+      delete[] last;
+    }
+
+    ~ADPCMSampleBuffer() {
+      delete[] m_samples;
+      delete[] m_blocks;
+    }
+
+    void ADR_CALL getFormat(
+      int& channel_count,
+      int& sample_rate,
+      SampleFormat& sample_format)
+    {
+      channel_count = m_channel_count;
+      sample_rate   = m_sample_rate;
+      sample_format = SF_S16;
+    }
+
+    int ADR_CALL getLength() {
+      return m_frame_count;
+    }
+
+    const void* ADR_CALL getSamples() {
+      SYNCHRONIZED(m_mutex);
+      if (!m_samples) {
+        ADR_LOG("Decoding a whole ADPCM sample buffer");
+        m_samples = new s16[m_block_count * ADPCM_BLOCK_FRAMES *
+                            m_channel_count];
+        SampleSourcePtr stream = openStream();
+        stream->read(m_frame_count, m_samples);
+      }
+      return m_samples;
+    }
+
+    SampleSource* ADR_CALL openStream();
+
+    int ADR_CALL getMemoryUsage() {
+      SYNCHRONIZED(m_mutex);
+      int usage = m_block_count * m_channel_count * ADPCM_BLOCK_SIZE;
+      if (m_samples) {
+        usage += m_frame_count * m_channel_count * GetSampleSize(SF_S16);
+      }
+      return usage;
+    }
+
+    int getBlockCount() {
+      return m_block_count;
+    }
+
+    /// Block k of channel c.
+    u8* getBlock(int c, int k) {
+      return m_blocks + (c * m_block_count + k) * ADPCM_BLOCK_SIZE;
+    }
+
+  private:
+    Mutex m_mutex;
+
+    u8* m_blocks;
+    int m_block_count;  // per channel
+    s16* m_samples;     // only decoded if getSamples() is called
+
+    int m_frame_count;
+    int m_channel_count;
+    int m_sample_rate;
+  };
+
+
+  class ADPCMBufferStream : public BasicSource {
+  public:
+    ADPCMBufferStream(ADPCMSampleBuffer* buffer) {
+      m_buffer = buffer;
+
+      int sample_rate;
+      SampleFormat sample_format;
+      buffer->getFormat(m_channel_count, sample_rate, sample_format);
+      m_frame_count = buffer->getLength();
+
+      m_group    = -1;
+      m_decoded  = new s16[GROUP_FRAMES * m_channel_count];
+      m_channel  = new s16[GROUP_FRAMES];
+      m_position = 0;
+    }
+
+    ~ADPCMBufferStream() {
+      delete[] m_decoded;
+      delete[] m_channel;
+    }
+
+    void ADR_CALL getFormat(
+      int& channel_count,
+      int& sample_rate,
+      SampleFormat& sample_format)
+    {
+      m_buffer->getFormat(channel_count, sample_rate, sample_format);
+    }
+
+    int doRead(int frame_count, void* buffer) {
+      s16* out = (s16*)buffer;
+      int frames_read = 0;
+      while (frames_read < frame_count && m_position < m_frame_count) {
+        const int group = m_position / GROUP_FRAMES;
+        if (group != m_group) {
+          decodeGroup(group);
+        }
+
+        const int offset = m_position - group * GROUP_FRAMES;
+        const int count = std::min(
+          std::min(frame_count - frames_read, m_frame_count - m_position),
+          GROUP_FRAMES - offset);
+        memcpy(out, m_decoded + offset * m_channel_count,
+               count * m_channel_count * sizeof(s16));
+
+        out         += count * m_channel_count;
+        frames_read += count;
+        m_position  += count;
+      }
+      return frames_read;
+    }
+
+    void ADR_CALL reset() {
+      m_position = 0;
+    }
+
+    bool ADR_CALL isSeekable()              { return true;           }
+    int ADR_CALL getLength()                { return m_frame_count;  }
+    void ADR_CALL setPosition(int position) { m_position = position; }
+    int ADR_CALL getPosition()              { return m_position;     }
+
+  private:
+    /// Decodes a group of blocks of every channel and interleaves them.
+    void decodeGroup(int group) {
+      const int first = group * GROUP_BLOCKS;
+      const int count = std::min(
+        GROUP_BLOCKS, m_buffer->getBlockCount() - first);
+      for (int c = 0; c < m_channel_count; ++c) {
+        DecodeADPCMBlocks(m_buffer->getBlock(c, first), count, m_channel);
+        s16* out = m_decoded + c;
+        for (int i = 0; i < count * ADPCM_BLOCK_FRAMES; ++i) {
+          *out = m_channel[i];
+          out += m_channel_count;
+        }
+      }
+      m_group = group;
+    }
+
+    RefPtr<ADPCMSampleBuffer> m_buffer;
+    int m_channel_count;
+    int m_frame_count;
+
+    int m_group;       // group of blocks in m_decoded, -1 if none
+    s16* m_decoded;    // interleaved samples of the group
+    s16* m_channel;    // one channel of the group, before interleaving
+    int m_position;    // in frames
+  };
+
+
+  SampleSource* ADR_CALL ADPCMSampleBuffer::openStream() {
+    return new ADPCMBufferStream(this);
+  }
+
+
+  ADR_EXPORT(SampleBuffer*) AdrCreateADPCMSampleBuffer(SampleSource* source) {
+    ADR_GUARD("AdrCreateADPCMSampleBuffer");
+
+    if (!source || !source->isSeekable()) {
+      return 0;
+    }
+
+    int channel_count, sample_rate;
+    SampleFormat sample_format;
+    source->getFormat(channel_count, sample_rate, sample_format);
+
+    u8* buffer;
+    const int length = DecodeWholeSource(source, buffer);
+    const int sample_count = length * channel_count;
+
+    // the encoder works on 16-bit samples
+    s16* samples = (s16*)buffer;
+    if (sample_format != SF_S16) {
+      samples = new s16[sample_count];
+      ConvertSamples(buffer, sample_format, samples, SF_S16, sample_count);
+    }
+
+    SampleBuffer* sb = new ADPCMSampleBuffer(
+      samples, length, channel_count, sample_rate);
+
+    if ((u8*)samples != buffer) {
+      delete[] samples;
+    }
+    delete[] buffer;
+    return sb;
+  }
+
+}
@@ -0,0 +1,103 @@
+/**
+ * @file
+ *
+ * Internal atomic operations on longs, for lock-free structures.  The
+ * reference counting in audiere.h has its own DLL-safe versions.
+ */
+
+#ifndef ATOMIC_H
+#define ATOMIC_H
+
+
+#ifdef _MSC_VER
+  #include <intrin.h>
+#endif
+
+
+namespace audiere {
+
+#if defined(__GNUC__) && \
+    (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))
+
+  /// Reads a value other threads published with AtomicStoreRelease.
+  inline long AtomicLoadAcquire(volatile long& var) {
+    return __atomic_load_n(&var, __ATOMIC_ACQUIRE);
+  }
+
+  /// Publishes a value and every write before it.
+  inline void AtomicStoreRelease(volatile long& var, long value) {
+    __atomic_store_n(&var, value, __ATOMIC_RELEASE);
+  }
+
+  /// Replaces var with value if it equals expected.  Returns whether it did.
+  inline bool AtomicCompareExchange(
+    volatile long& var, long expected, long value)
+  {
+    return __atomic_compare_exchange_n(
+      &var, &expected, value, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+  }
+
+  /// Replaces var with value.  Returns the old value.
+  inline long AtomicExchange(volatile long& var, long value) {
+    return __atomic_exchange_n(&var, value, __ATOMIC_ACQ_REL);
+  }
+
+#elif defined(__GNUC__)
+
+  // the older builtins are full barriers
+
+  inline long AtomicLoadAcquire(volatile long& var) {
+    long value = var;
+    __sync_synchronize();
+    return value;
+  }
+
+  inline void AtomicStoreRelease(volatile long& var, long value) {
+    __sync_synchronize();
+    var = value;
+  }
+
+  inline bool AtomicCompareExchange(
+    volatile long& var, long expected, long value)
+  {
+    return __sync_bool_compare_and_swap(&var, expected, value);
+  }
+
+  inline long AtomicExchange(volatile long& var, long value) {
+    __sync_synchronize();
+    return __sync_lock_test_and_set(&var, value);
+  }
+
+#elif defined(_MSC_VER)
+
+  // volatile accesses have acquire and release semantics in MSVC
+
+  inline long AtomicLoadAcquire(volatile long& var) {
+    long value = var;
+    _ReadWriteBarrier();
+    return value;
+  }
+
+  inline void AtomicStoreRelease(volatile long& var, long value) {
+    _ReadWriteBarrier();
+    var = value;
+  }
+
+  inline bool AtomicCompareExchange(
+    volatile long& var, long expected, long value)
+  {
+    return _InterlockedCompareExchange(&var, value, expected) == expected;
+  }
+
+  inline long AtomicExchange(volatile long& var, long value) {
+    return _InterlockedExchange(&var, value);
+  }
+
+#else
+  #error Atomic operations are not implemented for this compiler
+#endif
+
+}
+
+
+#endif
@@ -252,6 +252,7 @@ namespace audiere {
   enum SampleFormat {
     SF_U8,  ///< unsigned 8-bit integer [0,255]
     SF_S16, ///< signed 16-bit integer in host endianness [-32768,32767]
+    SF_F32, ///< 32-bit float in host endianness, full scale is [-1,1]
   };
 
 
@@ -380,6 +381,56 @@ namespace audiere {
   typedef RefPtr<SampleSource> SampleSourcePtr;
 
 
+  /**
+   * FileInfo describes a sound file without decoding it.  It is returned
+   * by ProbeFile, which only reads the file's headers, so it is much
+   * cheaper than opening a SampleSource when you only want to know what a
+   * file contains.
+   */
+  class FileInfo : public RefCounted {
+  protected:
+    ~FileInfo() { }
+
+  public:
+    /// Returns the format of the file, such as FF_MP3.
+    ADR_METHOD(FileFormat) getFileFormat() = 0;
+
+    /**
+     * Retrieve the number of channels, sample rate, and sample format that
+     * a SampleSource opened from this file would have.
+     */
+    ADR_METHOD(void) getFormat(
+      int& channel_count,
+      int& sample_rate,
+      SampleFormat& sample_format) = 0;
+
+    /**
+     * @return  number of frames in the stream, or 0 if it is not known
+     *          without decoding the file
+     */
+    ADR_METHOD(int) getLength() = 0;
+
+    /**
+     * @return  true if getLength() is exact, false if it was estimated,
+     *          e.g. from the bitrate of an MP3 file
+     */
+    ADR_METHOD(bool) isLengthExact() = 0;
+
+    /// Returns number of metadata tags present in the file.
+    ADR_METHOD(int) getTagCount() = 0;
+
+    /// @see SampleSource::getTagKey
+    virtual const char* ADR_CALL getTagKey(int i) = 0;
+
+    /// @see SampleSource::getTagValue
+    virtual const char* ADR_CALL getTagValue(int i) = 0;
+
+    /// @see SampleSource::getTagType
+    virtual const char* ADR_CALL getTagType(int i) = 0;
+  };
+  typedef RefPtr<FileInfo> FileInfoPtr;
+
+
   /**
    * LoopPointSource is a wrapper around another SampleSource, providing
    * custom loop behavior.  LoopPointSource maintains a set of links
@@ -643,8 +694,8 @@ namespace audiere {
    * implementation.  streamStopped() will be called whenever a stream on that
    * device stops playback.
    *
-   * WARNING: StopCallback is called from another thread.  Make sure your
-   * callback is thread-safe.
+   * WARNING: StopCallback is called from another thread, unless the device
+   * was opened with "events=poll".  Make sure your callback is thread-safe.
    */
   class StopCallback : public Callback {
   protected:
@@ -751,6 +802,18 @@ namespace audiere {
 
     /// Clears all of the callbacks from the device.
     ADR_METHOD(void) clearCallbacks() = 0;
+
+    /**
+     * Delivers waiting events to the registered callbacks on the calling
+     * thread, oldest first.  Devices opened with "events=poll" have no
+     * event thread, so the application must call this regularly, such
+     * as once a frame; otherwise it does nothing.
+     *
+     * @param max_events  most events to deliver in this call
+     *
+     * @return  number of events delivered
+     */
+    ADR_METHOD(int) pollEvents(int max_events) = 0;
   };
   typedef RefPtr<AudioDevice> AudioDevicePtr;
 
@@ -796,6 +859,14 @@ namespace audiere {
      * buffer.
      */
     ADR_METHOD(SampleSource*) openStream() = 0;
+
+    /**
+     * Returns how many bytes of memory the buffer's samples take up.  For
+     * a buffer created with CreateCompressedSampleBuffer, this is the size
+     * of the encoded file, plus the decoded samples if getSamples() has
+     * been called.
+     */
+    ADR_METHOD(int) getMemoryUsage() = 0;
   };
   typedef RefPtr<SampleBuffer> SampleBufferPtr;
 
@@ -1050,6 +1121,16 @@ namespace audiere {
      */
     ADR_FUNCTION(const char*) AdrGetSupportedAudioDevices();
 
+    /**
+     * Returns a formatted string that lists the SIMD kernels Audiere has
+     * selected.  The string stays valid until Audiere is unloaded.
+     *
+     * It is formatted in the following way:
+     *
+     * name1:instruction_set1;name2:instruction_set2;...
+     */
+    ADR_FUNCTION(const char*) AdrGetSelectedKernels();
+
     ADR_FUNCTION(int) AdrGetSampleSize(SampleFormat format);
 
     ADR_FUNCTION(AudioDevice*) AdrOpenDevice(
@@ -1062,6 +1143,16 @@ namespace audiere {
     ADR_FUNCTION(SampleSource*) AdrOpenSampleSourceFromFile(
       File* file,
       FileFormat file_format);
+    ADR_FUNCTION(FileInfo*) AdrProbeFile(
+      const char* filename,
+      FileFormat file_format);
+    ADR_FUNCTION(FileInfo*) AdrProbeFileFromFile(
+      File* file,
+      FileFormat file_format);
+    ADR_FUNCTION(void) AdrSetSeekCacheDirectory(const char* directory);
+    ADR_FUNCTION(void) AdrSetPreferredSampleFormat(SampleFormat format);
+    ADR_FUNCTION(void) AdrSetDecoderPoolSize(int size);
+    ADR_FUNCTION(void) AdrSetLoadThreadCount(int count);
     ADR_FUNCTION(SampleSource*) AdrCreateTone(double frequency);
     ADR_FUNCTION(SampleSource*) AdrCreateSquareWave(double frequency);
     ADR_FUNCTION(SampleSource*) AdrCreateWhiteNoise();
@@ -1083,11 +1174,24 @@ namespace audiere {
       SampleFormat sample_format);
     ADR_FUNCTION(SampleBuffer*) AdrCreateSampleBufferFromSource(
       SampleSource* source);
+    ADR_FUNCTION(SampleBuffer*) AdrCreateLazySampleBuffer(
+      SampleSource* source);
+    ADR_FUNCTION(SampleBuffer*) AdrCreateCompressedSampleBuffer(
+      const char* filename,
+      FileFormat file_format);
+    ADR_FUNCTION(SampleBuffer*) AdrCreateCompressedSampleBufferFromFile(
+      File* file,
+      FileFormat file_format);
+    ADR_FUNCTION(SampleBuffer*) AdrCreateADPCMSampleBuffer(
+      SampleSource* source);
 
     ADR_FUNCTION(SoundEffect*) AdrOpenSoundEffect(
       AudioDevice* device,
       SampleSource* source,
       SoundEffectType type);
+    ADR_FUNCTION(SoundEffect*) AdrOpenSoundEffectFromBuffer(
+      AudioDevice* device,
+      SampleBuffer* buffer);
 
     ADR_FUNCTION(File*) AdrOpenFile(
       const char* name,
@@ -1204,6 +1308,36 @@ namespace audiere {
   }
 
 
+  /// Describes a set of SIMD kernels Audiere uses.
+  struct KernelDesc {
+    /// What the kernels do, such as "convert" or "mixer"
+    std::string name;
+
+    /// Instruction set selected: "none", "sse2", "sse4.1" or "avx2"
+    std::string instruction_set;
+  };
+
+  /**
+   * Populates a vector of KernelDesc structs with the kernels Audiere's
+   * inner loops use on this processor.  Each set of kernels uses the
+   * best instruction set the processor supports, limited by the
+   * AUDIERE_SIMD environment variable or the "simd" parameter of
+   * OpenDevice.
+   */
+  inline void GetSelectedKernels(std::vector<KernelDesc>& kernels) {
+    std::vector<std::string> descriptions;
+    SplitString(descriptions, hidden::AdrGetSelectedKernels(), ';');
+
+    kernels.resize(descriptions.size());
+    for (unsigned i = 0; i < descriptions.size(); ++i) {
+      std::vector<std::string> d;
+      SplitString(d, descriptions[i].c_str(), ':');
+      kernels[i].name            = d[0];
+      kernels[i].instruction_set = d[1];
+    }
+  }
+
+
   /**
    * Get the size of a sample in a specific sample format.
    * This is commonly used to determine how many bytes a chunk of
@@ -1223,7 +1357,12 @@ namespace audiere {
    *
    * @param  name  name of audio device that should be used
    * @param  parameters  comma delimited list of audio-device parameters;
-   *                     for example, "buffer=100,rate=44100"
+   *                     for example, "buffer=100,rate=44100".  Every
+   *                     device accepts "simd=none", "sse2", "sse4.1" or
+   *                     "avx2", which limits the instruction sets of the
+   *                     kernels chosen from then on, for comparing them,
+   *                     and "events=poll", which delivers events from
+   *                     AudioDevice::pollEvents() instead of a thread.
    *
    * @return  new audio device object if OpenDevice succeeds, and 0 in case
    *          of failure
@@ -1268,6 +1407,98 @@ namespace audiere {
     return hidden::AdrOpenSampleSourceFromFile(file.get(), file_format);
   }
 
+  /**
+   * Reads the format, length, and tags of a sound file without opening a
+   * decoder.  Only the headers of the file are read, and the length is
+   * estimated where it can't be found that way.  ProbeFile may be called
+   * from several threads at once.
+   *
+   * @see ProbeFile(File*)
+   */
+  inline FileInfo* ProbeFile(
+    const char* filename,
+    FileFormat file_format = FF_AUTODETECT)
+  {
+    return hidden::AdrProbeFile(filename, file_format);
+  }
+
+  /**
+   * Reads the format, length, and tags from the specified file object.
+   *
+   * @param file         File object to examine
+   * @param file_format  Format of the file.  If FF_AUTODETECT, Audiere
+   *                     will look at the file's contents to find out.
+   *
+   * @return  new FileInfo if the file is recognized, 0 otherwise
+   */
+  inline FileInfo* ProbeFile(
+    const FilePtr& file,
+    FileFormat file_format = FF_AUTODETECT)
+  {
+    return hidden::AdrProbeFileFromFile(file.get(), file_format);
+  }
+
+  /**
+   * Enables the seek index cache.  Decoders that must scan a whole stream
+   * to find its length and seek points (currently MP3 and Speex) store the
+   * results in this directory, so the next time the same file is opened,
+   * it has an exact length and exact seeking without a scan.  The cache is
+   * disabled by default.
+   *
+   * Entries are keyed by the file's contents, not its name, and are
+   * ignored when the file changes.  The directory must already exist.
+   *
+   * @param directory  path of the cache directory, or 0 to disable the
+   *                   cache
+   */
+  inline void SetSeekCacheDirectory(const char* directory) {
+    hidden::AdrSetSeekCacheDirectory(directory);
+  }
+
+  /**
+   * Chooses the sample format of sources opened afterwards, for decoders
+   * that can produce more than one.  MP3 honors SF_F32 by skipping the
+   * rounding and clipping to 16 bits, so peaks above full scale are kept.
+   * So do WAV and AIFF files with 24-bit, 32-bit, or floating point
+   * samples, which are otherwise reduced to 16 bits.  The default is
+   * SF_S16.
+   *
+   * The mixing devices convert SF_F32 sources to 16 bits after
+   * resampling.  DirectSound plays them as they are, which needs Windows
+   * XP or later.
+   *
+   * @param format  SF_S16 or SF_F32
+   */
+  inline void SetPreferredSampleFormat(SampleFormat format) {
+    hidden::AdrSetPreferredSampleFormat(format);
+  }
+
+  /**
+   * Sets how many idle decoders Audiere keeps for each compressed format
+   * (currently MP3 and FLAC).  Closing a stream returns its decoder to a
+   * pool instead of freeing it, so opening many short sounds in a row
+   * doesn't allocate a decoder every time.  The default is 4.
+   *
+   * @param size  most idle decoders kept per format; 0 disables pooling
+   *              and frees the decoders that are pooled now
+   */
+  inline void SetDecoderPoolSize(int size) {
+    hidden::AdrSetDecoderPoolSize(size);
+  }
+
+  /**
+   * Sets how many threads CreateSampleBuffer and OpenSound with streaming
+   * off may use to decode a whole file.  WAV, AIFF, FLAC, Ogg Vorbis, and
+   * MP3 files long enough to be worth it are split into segments that are
+   * decoded at the same time, each by its own decoder.
+   *
+   * @param count  most threads used for one file; 0, the default, uses
+   *               one per processor and 1 decodes on the calling thread
+   */
+  inline void SetLoadThreadCount(int count) {
+    hidden::AdrSetLoadThreadCount(count);
+  }
+
   /**
    * Create a tone sample source with the specified frequency.
    *
@@ -1444,6 +1675,75 @@ namespace audiere {
     return hidden::AdrCreateSampleBufferFromSource(source.get());
   }
 
+  /**
+   * Create a SampleBuffer that decodes a SampleSource as it is played,
+   * rather than all at once like CreateSampleBuffer.  Streams opened from
+   * it can start playing right away, and share the samples decoded so far,
+   * so later streams don't decode them again.  The buffer reads from the
+   * source until it reaches the end, so don't use the source elsewhere.
+   *
+   * getSamples() has to decode the rest of the source before it returns.
+   *
+   * @param source  Seekable sample source used to create the buffer.
+   *                If the source is not seekable, then the function
+   *                fails.
+   *
+   * @return  new sample buffer if success, 0 otherwise
+   */
+  inline SampleBuffer* CreateLazySampleBuffer(const SampleSourcePtr& source) {
+    return hidden::AdrCreateLazySampleBuffer(source.get());
+  }
+
+  /**
+   * Create a SampleBuffer that keeps the encoded file in memory instead of
+   * the decoded samples, which for Ogg Vorbis or MP3 is about a tenth of
+   * the size.  Every stream opened from it decodes the shared file data
+   * with a decoder of its own.  getSamples() decodes the whole file and
+   * keeps the result, so avoid it.
+   *
+   * @param filename     Name of the file to load
+   * @param file_format  Format of the file, or FF_AUTODETECT
+   *
+   * @return  new sample buffer if success, 0 otherwise
+   */
+  inline SampleBuffer* CreateCompressedSampleBuffer(
+    const char* filename,
+    FileFormat file_format = FF_AUTODETECT)
+  {
+    return hidden::AdrCreateCompressedSampleBuffer(filename, file_format);
+  }
+
+  /**
+   * Create a compressed SampleBuffer from the contents of a file object,
+   * which is read completely and not kept.
+   * @see CreateCompressedSampleBuffer(const char*, FileFormat)
+   */
+  inline SampleBuffer* CreateCompressedSampleBuffer(
+    const FilePtr& file,
+    FileFormat file_format = FF_AUTODETECT)
+  {
+    return hidden::AdrCreateCompressedSampleBufferFromFile(
+      file.get(), file_format);
+  }
+
+  /**
+   * Create a SampleBuffer that stores a SampleSource as 4-bit IMA ADPCM,
+   * a quarter of the size of 16-bit samples.  Streams opened from it
+   * decode the ADPCM as they are read, which is cheap enough for many
+   * sound effects playing at once.  The samples come out of the buffer
+   * as SF_S16, with a little quantization noise.  getSamples() decodes
+   * the whole buffer and keeps the result, so avoid it.
+   *
+   * @param source  Seekable sample source used to create the buffer.
+   *                If the source is not seekable, then the function
+   *                fails.
+   *
+   * @return  new sample buffer if success, 0 otherwise
+   */
+  inline SampleBuffer* CreateADPCMSampleBuffer(const SampleSourcePtr& source) {
+    return hidden::AdrCreateADPCMSampleBuffer(source.get());
+  }
+
   /**
    * Open a SoundEffect object from the given sample source and sound
    * effect type.  @see SoundEffect
@@ -1454,7 +1754,9 @@ namespace audiere {
    *                with data.
    *
    * @param type  The type of the sound effect.  If type is MULTIPLE,
-   *              the source must be seekable.
+   *              the source must be seekable, and it is decoded as it
+   *              plays into a buffer shared by every instance.
+   *              @see CreateLazySampleBuffer
    *
    * @return  new SoundEffect object if successful, 0 otherwise
    */
@@ -1494,6 +1796,23 @@ namespace audiere {
     return OpenSoundEffect(device, source, type);
   }
 
+  /**
+   * Open a MULTIPLE SoundEffect that plays the samples of an existing
+   * SampleBuffer, such as one from CreateCompressedSampleBuffer.  Choosing
+   * the kind of buffer lets each sound trade memory for decoding time.
+   *
+   * @param device  AudioDevice on which the sound is played.
+   * @param buffer  The samples to play.
+   *
+   * @return  new SoundEffect object if successful, 0 otherwise
+   */
+  inline SoundEffect* OpenSoundEffect(
+    const AudioDevicePtr& device,
+    const SampleBufferPtr& buffer)
+  {
+    return hidden::AdrOpenSoundEffectFromBuffer(device.get(), buffer.get());
+  }
+
   /**
    * Opens a default file implementation from the local filesystem.
    *
@@ -1561,6 +1880,10 @@ namespace audiere {
   /**
    * A basic implementation of the RefCounted interface.  Derive
    * your implementations from RefImplementation<YourInterface>.
+   *
+   * The reference count is atomic, so different threads may hold RefPtrs
+   * to the same object and copy or release them without locking.  A
+   * single RefPtr still must not be changed by two threads at once.
    */
   template<class Interface>
   class RefImplementation : public Interface {
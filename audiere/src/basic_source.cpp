@@ -7,12 +7,34 @@ namespace audiere {
 
   BasicSource::BasicSource() {
     m_repeat = false;
+    m_frame_size = 0;
+    m_origin_file = 0;
+    m_origin_format = FF_AUTODETECT;
   }
 
+
+  bool
+  BasicSource::FindOrigin(
+    SampleSource* source, File*& file, FileFormat& format)
+  {
+    BasicSource* basic = dynamic_cast<BasicSource*>(source);
+    if (!basic || !basic->m_origin_file) {
+      return false;
+    }
+    file   = basic->m_origin_file;
+    format = basic->m_origin_format;
+    return true;
+  }
+
+
   int
   BasicSource::read(int frame_count, void* buffer) {
     if (m_repeat) {
-      const int frame_size = GetFrameSize(this);
+      // a source's format doesn't change, so only ask for it once
+      if (m_frame_size == 0) {
+        m_frame_size = GetFrameSize(this);
+      }
+      const int frame_size = m_frame_size;
 
       // the main read loop:
       u8* out = (u8*)buffer;
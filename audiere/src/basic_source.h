@@ -53,6 +53,24 @@ namespace audiere {
     /// Implement this method in subclasses.
     virtual int doRead(int frame_count, void* buffer) = 0;
 
+    /**
+     * Records the file and format this source was opened from, so more
+     * decoders can be opened on the same file later.  OpenSource calls
+     * this for every source it returns.
+     */
+    void setOrigin(File* file, FileFormat format) {
+      m_origin_file   = file;
+      m_origin_format = format;
+    }
+
+    /**
+     * Looks up the file and format of a source opened by OpenSource.
+     *
+     * @return  false if the source didn't come from OpenSource
+     */
+    static bool FindOrigin(
+      SampleSource* source, File*& file, FileFormat& format);
+
   protected:
     void addTag(const Tag& t) {
       m_tags.push_back(t);
@@ -66,7 +84,11 @@ namespace audiere {
 
   private:
     bool m_repeat;
+    int m_frame_size;  // 0 until the first read that repeats
     std::vector<Tag> m_tags;
+
+    File* m_origin_file;  // the source holds a reference already
+    FileFormat m_origin_format;
   };
 
 }
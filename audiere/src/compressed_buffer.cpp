@@ -0,0 +1,173 @@
+#include "audiere.h"
+#include "basic_source.h"
+#include "debug.h"
+#include "default_file.h"
+#include "input.h"
+#include "internal.h"
+#include "memory_file.h"
+#include "parallel_decode.h"
+#include "threads.h"
+#include "utility.h"
+
+
+namespace audiere {
+
+  /**
+   * SampleBuffer that holds an encoded file instead of decoded samples.
+   * Every stream opened from it gets a decoder of its own, reading the
+   * shared file data through a BorrowedMemoryFile.
+   */
+  class CompressedSampleBuffer : public RefImplementation<SampleBuffer> {
+  public:
+    /// Takes ownership of data, which must come from new u8[].
+    CompressedSampleBuffer(u8* data, int size) {
+      m_data    = data;
+      m_size    = size;
+      m_samples = 0;
+
+      m_file_format   = FF_AUTODETECT;
+      m_frame_count   = 0;
+      m_channel_count = 0;
+      m_sample_rate   = 0;
+      m_sample_format = SF_S16;
+    }
+
+    ~CompressedSampleBuffer() {
+      delete[] m_samples;
+      delete[] m_data;
+    }
+
+    /**
+     * Opens the data once to find its format and length.
+     *
+     * @return  false if no decoder accepts the data or it can't be seeked
+     */
+    bool initialize(const char* filename, FileFormat file_format) {
+      // This file doesn't reference the buffer, since the buffer has no
+      // references yet and would be destroyed along with the source.
+      SampleSourcePtr source = OpenSource(
+        new BorrowedMemoryFile(m_data, m_size, 0), filename, file_format);
+      if (!source || !source->isSeekable()) {
+        return false;
+      }
+
+      // remember what the data turned out to be, so streams skip detection
+      File* file;
+      if (!BasicSource::FindOrigin(source.get(), file, m_file_format)) {
+        m_file_format = file_format;
+      }
+
+      source->getFormat(m_channel_count, m_sample_rate, m_sample_format);
+      m_frame_count = source->getLength();
+      return true;
+    }
+
+    void ADR_CALL getFormat(
+      int& channel_count,
+      int& sample_rate,
+      SampleFormat& sample_format)
+    {
+      channel_count = m_channel_count;
+      sample_rate   = m_sample_rate;
+      sample_format = m_sample_format;
+    }
+
+    int ADR_CALL getLength() {
+      SYNCHRONIZED(m_mutex);
+      return m_frame_count;
+    }
+
+    const void* ADR_CALL getSamples() {
+      SYNCHRONIZED(m_mutex);
+      if (!m_samples) {
+        ADR_LOG("Decoding a whole compressed sample buffer");
+        SampleSourcePtr source = openStream();
+        if (source) {
+          // the length was only an estimate if this is an MP3
+          m_frame_count = DecodeWholeSource(source.get(), m_samples);
+        }
+      }
+      return m_samples;
+    }
+
+    SampleSource* ADR_CALL openStream() {
+      return OpenSource(
+        new BorrowedMemoryFile(m_data, m_size, this), 0, m_file_format);
+    }
+
+    int ADR_CALL getMemoryUsage() {
+      SYNCHRONIZED(m_mutex);
+      int usage = m_size;
+      if (m_samples) {
+        usage += m_frame_count * m_channel_count *
+                 GetSampleSize(m_sample_format);
+      }
+      return usage;
+    }
+
+  private:
+    Mutex m_mutex;
+
+    u8* m_data;
+    int m_size;
+    FileFormat m_file_format;
+
+    u8* m_samples;  // only decoded if getSamples() is called
+    int m_frame_count;
+    int m_channel_count;
+    int m_sample_rate;
+    SampleFormat m_sample_format;
+  };
+
+
+  static SampleBuffer* CreateCompressedBuffer(
+    File* file,
+    const char* filename,
+    FileFormat file_format)
+  {
+    const int size = GetFileLength(file);
+    if (size <= 0 || !file->seek(0, File::BEGIN)) {
+      return 0;
+    }
+
+    u8* data = new u8[size];
+    if (file->read(data, size) != size) {
+      delete[] data;
+      return 0;
+    }
+
+    CompressedSampleBuffer* sb = new CompressedSampleBuffer(data, size);
+    if (!sb->initialize(filename, file_format)) {
+      delete sb;
+      return 0;
+    }
+    return sb;
+  }
+
+
+  ADR_EXPORT(SampleBuffer*) AdrCreateCompressedSampleBuffer(
+    const char* filename,
+    FileFormat file_format)
+  {
+    if (!filename) {
+      return 0;
+    }
+    FilePtr file = AdrOpenFile(filename, false);
+    if (!file) {
+      return 0;
+    }
+    return CreateCompressedBuffer(file.get(), filename, file_format);
+  }
+
+
+  ADR_EXPORT(SampleBuffer*) AdrCreateCompressedSampleBufferFromFile(
+    File* file,
+    FileFormat file_format)
+  {
+    if (!file) {
+      return 0;
+    }
+    return CreateCompressedBuffer(file, 0, file_format);
+  }
+
+}
@@ -0,0 +1,918 @@
+#include <string.h>
+#include "convert.h"
+#include "cpu.h"
+#include "input.h"
+#include "utility.h"
+
+#ifdef ADR_SIMD_X86
+  #include <emmintrin.h>
+#endif
+#ifdef ADR_SIMD_AVX2
+  #include <immintrin.h>
+#endif
+
+
+namespace audiere {
+
+  /// Samples are converted through a staging buffer this many at a time.
+  static const int STAGE_SIZE = 256;
+
+  /// Bytes read at a time by ReadRawFrames when samples change size.
+  static const int RAW_CHUNK_SIZE = 8192;
+
+#ifdef WORDS_BIGENDIAN
+  static const bool HOST_BIG_ENDIAN = true;
+#else
+  static const bool HOST_BIG_ENDIAN = false;
+#endif
+
+
+  /**
+   * The loops every conversion is built from.  There is a scalar, an
+   * SSE2 and an AVX2 set; the AVX2 set reuses SSE2 loops where wider
+   * registers don't help.
+   */
+  struct ConvertKernels {
+    /// Swaps the bytes of count 16-bit samples.
+    void (*swap16)(const u8* in, u8* out, int count);
+
+    /// Swaps the bytes of count 32-bit samples.
+    void (*swap32)(const u8* in, u8* out, int count);
+
+    /// Flips the sign bit of count 8-bit samples.
+    void (*flip_sign8)(const u8* in, u8* out, int count);
+
+    /// out = in << shift, for shift in [0, 16].
+    void (*s16_to_ints)(const s16* in, int shift, int* out, int count);
+
+    /// out = in >> shift, clipped to 16 bits.
+    void (*ints_to_s16)(const int* in, int shift, s16* out, int count);
+
+    /// out = in * scale
+    void (*ints_to_f32)(const int* in, float scale, float* out, int count);
+
+    /// Scales by 32768, clips, and rounds half away from zero.
+    void (*f32_to_s16)(const float* in, s16* out, int count);
+
+    /// Clips to [-limit, limit], scales, and truncates.
+    void (*f32_to_ints)(
+      const float* in, float limit, float scale, int* out, int count);
+
+    /// Interleaves two channels of 16-bit samples.
+    void (*interleave2_16)(const s16* l, const s16* r, s16* out, int count);
+
+    /// Interleaves two channels of 32-bit samples, ints or floats.
+    void (*interleave2_32)(
+      const void* l, const void* r, void* out, int count);
+
+    /// Splits interleaved 16-bit samples into two channels of ints.
+    void (*deinterleave2_16)(const s16* in, int* l, int* r, int count);
+
+    /// Splits interleaved 32-bit samples into two channels.
+    void (*deinterleave2_32)(const void* in, void* l, void* r, int count);
+  };
+
+
+  static inline unsigned int SwapBytes32(unsigned int x) {
+    return (x << 24) | ((x << 8) & 0xFF0000) | ((x >> 8) & 0xFF00) | (x >> 24);
+  }
+
+
+  /// Clips to full scale and rounds half away from zero.
+  static inline int FloatToInt(float f, float scale, float max) {
+    const float x = clamp(-scale, f * scale, max);
+    return int(x < 0 ? x - 0.5f : x + 0.5f);
+  }
+
+
+  // Scalar kernels.  Each SSE2 kernel finishes its last few samples with
+  // these.
+
+  static void Swap16(const u8* in, u8* out, int count) {
+    for (int i = 0; i < count; ++i) {
+      const u8 a = in[i * 2];
+      out[i * 2]     = in[i * 2 + 1];
+      out[i * 2 + 1] = a;
+    }
+  }
+
+  static void Swap32(const u8* in, u8* out, int count) {
+    for (int i = 0; i < count; ++i) {
+      unsigned int x;
+      memcpy(&x, in + i * 4, 4);
+      x = SwapBytes32(x);
+      memcpy(out + i * 4, &x, 4);
+    }
+  }
+
+  static void FlipSign8(const u8* in, u8* out, int count) {
+    for (int i = 0; i < count; ++i) {
+      out[i] = in[i] ^ 0x80;
+    }
+  }
+
+  static void S16ToInts(const s16* in, int shift, int* out, int count) {
+    const int scale = 1 << shift;
+    for (int i = 0; i < count; ++i) {
+      out[i] = int(in[i]) * scale;
+    }
+  }
+
+  static void IntsToS16(const int* in, int shift, s16* out, int count) {
+    for (int i = 0; i < count; ++i) {
+      out[i] = s16(clamp(-32768, in[i] >> shift, 32767));
+    }
+  }
+
+  static void IntsToF32(const int* in, float scale, float* out, int count) {
+    for (int i = 0; i < count; ++i) {
+      out[i] = float(in[i]) * scale;
+    }
+  }
+
+  static void F32ToS16(const float* in, s16* out, int count) {
+    for (int i = 0; i < count; ++i) {
+      out[i] = s16(FloatToInt(in[i], 32768.0f, 32767.0f));
+    }
+  }
+
+  static void F32ToInts(
+    const float* in, float limit, float scale, int* out, int count)
+  {
+    for (int i = 0; i < count; ++i) {
+      out[i] = int(clamp(-limit, in[i], limit) * scale);
+    }
+  }
+
+  static void Interleave2_16(const s16* l, const s16* r, s16* out, int count) {
+    for (int i = 0; i < count; ++i) {
+      out[i * 2]     = l[i];
+      out[i * 2 + 1] = r[i];
+    }
+  }
+
+  static void Interleave2_32(
+    const void* l, const void* r, void* out, int count)
+  {
+    const u8* l8 = (const u8*)l;
+    const u8* r8 = (const u8*)r;
+    u8* o = (u8*)out;
+    for (int i = 0; i < count; ++i) {
+      memcpy(o + i * 8,     l8 + i * 4, 4);
+      memcpy(o + i * 8 + 4, r8 + i * 4, 4);
+    }
+  }
+
+  static void Deinterleave2_16(const s16* in, int* l, int* r, int count) {
+    for (int i = 0; i < count; ++i) {
+      l[i] = in[i * 2];
+      r[i] = in[i * 2 + 1];
+    }
+  }
+
+  static void Deinterleave2_32(
+    const void* in, void* l, void* r, int count)
+  {
+    const u8* i8 = (const u8*)in;
+    u8* l8 = (u8*)l;
+    u8* r8 = (u8*)r;
+    for (int i = 0; i < count; ++i) {
+      memcpy(l8 + i * 4, i8 + i * 8,     4);
+      memcpy(r8 + i * 4, i8 + i * 8 + 4, 4);
+    }
+  }
+
+
+  static const ConvertKernels SCALAR_KERNELS = {
+    Swap16,
+    Swap32,
+    FlipSign8,
+    S16ToInts,
+    IntsToS16,
+    IntsToF32,
+    F32ToS16,
+    F32ToInts,
+    Interleave2_16,
+    Interleave2_32,
+    Deinterleave2_16,
+    Deinterleave2_32,
+  };
+
+
+#ifdef ADR_SIMD_X86
+
+  ADR_TARGET_SSE2 static void Swap16_SSE2(const u8* in, u8* out, int count) {
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+      const __m128i v = _mm_loadu_si128((const __m128i*)(in + i * 2));
+      _mm_storeu_si128((__m128i*)(out + i * 2),
+        _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+    }
+    Swap16(in + i * 2, out + i * 2, count - i);
+  }
+
+  ADR_TARGET_SSE2 static void Swap32_SSE2(const u8* in, u8* out, int count) {
+    int i = 0;
+    const __m128i mask = _mm_set1_epi32(0x00FF00FF);
+    for (; i + 4 <= count; i += 4) {
+      __m128i v = _mm_loadu_si128((const __m128i*)(in + i * 4));
+      // swap the bytes in each 16-bit half, then the halves
+      v = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 8), mask),
+                       _mm_slli_epi32(_mm_and_si128(v, mask), 8));
+      v = _mm_or_si128(_mm_srli_epi32(v, 16), _mm_slli_epi32(v, 16));
+      _mm_storeu_si128((__m128i*)(out + i * 4), v);
+    }
+    Swap32(in + i * 4, out + i * 4, count - i);
+  }
+
+  ADR_TARGET_SSE2 static void FlipSign8_SSE2(const u8* in, u8* out, int count) {
+    int i = 0;
+    const __m128i sign = _mm_set1_epi8(char(0x80));
+    for (; i + 16 <= count; i += 16) {
+      const __m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+      _mm_storeu_si128((__m128i*)(out + i), _mm_xor_si128(v, sign));
+    }
+    FlipSign8(in + i, out + i, count - i);
+  }
+
+  ADR_TARGET_SSE2 static void S16ToInts_SSE2(
+    const s16* in, int shift, int* out, int count)
+  {
+    int i = 0;
+    // interleaving zeros below each sample shifts it up 16 bits
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i down = _mm_cvtsi32_si128(16 - shift);
+    for (; i + 8 <= count; i += 8) {
+      const __m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+      _mm_storeu_si128((__m128i*)(out + i),
+        _mm_sra_epi32(_mm_unpacklo_epi16(zero, v), down));
+      _mm_storeu_si128((__m128i*)(out + i + 4),
+        _mm_sra_epi32(_mm_unpackhi_epi16(zero, v), down));
+    }
+    S16ToInts(in + i, shift, out + i, count - i);
+  }
+
+  ADR_TARGET_SSE2 static void IntsToS16_SSE2(
+    const int* in, int shift, s16* out, int count)
+  {
+    int i = 0;
+    const __m128i down = _mm_cvtsi32_si128(shift);
+    for (; i + 8 <= count; i += 8) {
+      const __m128i a = _mm_loadu_si128((const __m128i*)(in + i));
+      const __m128i b = _mm_loadu_si128((const __m128i*)(in + i + 4));
+      _mm_storeu_si128((__m128i*)(out + i), _mm_packs_epi32(
+        _mm_sra_epi32(a, down), _mm_sra_epi32(b, down)));
+    }
+    IntsToS16(in + i, shift, out + i, count - i);
+  }
+
+  ADR_TARGET_SSE2 static void IntsToF32_SSE2(
+    const int* in, float scale, float* out, int count)
+  {
+    int i = 0;
+    const __m128 vscale = _mm_set1_ps(scale);
+    for (; i + 4 <= count; i += 4) {
+      const __m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+      _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(v), vscale));
+    }
+    IntsToF32(in + i, scale, out + i, count - i);
+  }
+
+  ADR_TARGET_SSE2 static void F32ToS16_SSE2(const float* in, s16* out, int count) {
+    int i = 0;
+    const __m128 scale = _mm_set1_ps(32768.0f);
+    const __m128 lo    = _mm_set1_ps(-32768.0f);
+    const __m128 hi    = _mm_set1_ps(32767.0f);
+    const __m128 half  = _mm_set1_ps(0.5f);
+    const __m128 sign  = _mm_set1_ps(-0.0f);
+    for (; i + 8 <= count; i += 8) {
+      __m128 a = _mm_mul_ps(_mm_loadu_ps(in + i), scale);
+      __m128 b = _mm_mul_ps(_mm_loadu_ps(in + i + 4), scale);
+      a = _mm_max_ps(_mm_min_ps(a, hi), lo);
+      b = _mm_max_ps(_mm_min_ps(b, hi), lo);
+      // add 0.5 with the sign of the sample, then truncate
+      a = _mm_add_ps(a, _mm_or_ps(_mm_and_ps(a, sign), half));
+      b = _mm_add_ps(b, _mm_or_ps(_mm_and_ps(b, sign), half));
+      _mm_storeu_si128((__m128i*)(out + i), _mm_packs_epi32(
+        _mm_cvttps_epi32(a), _mm_cvttps_epi32(b)));
+    }
+    F32ToS16(in + i, out + i, count - i);
+  }
+
+  ADR_TARGET_SSE2 static void F32ToInts_SSE2(
+    const float* in, float limit, float scale, int* out, int count)
+  {
+    int i = 0;
+    const __m128 hi     = _mm_set1_ps(limit);
+    const __m128 lo     = _mm_set1_ps(-limit);
+    const __m128 vscale = _mm_set1_ps(scale);
+    for (; i + 4 <= count; i += 4) {
+      __m128 v = _mm_loadu_ps(in + i);
+      v = _mm_mul_ps(_mm_max_ps(_mm_min_ps(v, hi), lo), vscale);
+      _mm_storeu_si128((__m128i*)(out + i), _mm_cvttps_epi32(v));
+    }
+    F32ToInts(in + i, limit, scale, out + i, count - i);
+  }
+
+  ADR_TARGET_SSE2 static void Interleave2_16_SSE2(
+    const s16* l, const s16* r, s16* out, int count)
+  {
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+      const __m128i a = _mm_loadu_si128((const __m128i*)(l + i));
+      const __m128i b = _mm_loadu_si128((const __m128i*)(r + i));
+      _mm_storeu_si128((__m128i*)(out + i * 2),     _mm_unpacklo_epi16(a, b));
+      _mm_storeu_si128((__m128i*)(out + i * 2 + 8), _mm_unpackhi_epi16(a, b));
+    }
+    Interleave2_16(l + i, r + i, out + i * 2, count - i);
+  }
+
+  ADR_TARGET_SSE2 static void Interleave2_32_SSE2(
+    const void* l, const void* r, void* out, int count)
+  {
+    const float* lf = (const float*)l;
+    const float* rf = (const float*)r;
+    float* o = (float*)out;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+      const __m128 a = _mm_loadu_ps(lf + i);
+      const __m128 b = _mm_loadu_ps(rf + i);
+      _mm_storeu_ps(o + i * 2,     _mm_unpacklo_ps(a, b));
+      _mm_storeu_ps(o + i * 2 + 4, _mm_unpackhi_ps(a, b));
+    }
+    Interleave2_32(lf + i, rf + i, o + i * 2, count - i);
+  }
+
+  ADR_TARGET_SSE2 static void Deinterleave2_16_SSE2(
+    const s16* in, int* l, int* r, int count)
+  {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+      // the left sample is the low half of each 32-bit frame
+      const __m128i v = _mm_loadu_si128((const __m128i*)(in + i * 2));
+      _mm_storeu_si128((__m128i*)(l + i),
+        _mm_srai_epi32(_mm_slli_epi32(v, 16), 16));
+      _mm_storeu_si128((__m128i*)(r + i), _mm_srai_epi32(v, 16));
+    }
+    Deinterleave2_16(in + i * 2, l + i, r + i, count - i);
+  }
+
+  ADR_TARGET_SSE2 static void Deinterleave2_32_SSE2(
+    const void* in, void* l, void* r, int count)
+  {
+    const float* inf = (const float*)in;
+    float* lf = (float*)l;
+    float* rf = (float*)r;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+      const __m128 a = _mm_loadu_ps(inf + i * 2);
+      const __m128 b = _mm_loadu_ps(inf + i * 2 + 4);
+      _mm_storeu_ps(lf + i, _mm_shuffle_ps(a, b, 0x88));
+      _mm_storeu_ps(rf + i, _mm_shuffle_ps(a, b, 0xDD));
+    }
+    Deinterleave2_32(inf + i * 2, lf + i, rf + i, count - i);
+  }
+
+
+  static const ConvertKernels SSE2_KERNELS = {
+    Swap16_SSE2,
+    Swap32_SSE2,
+    FlipSign8_SSE2,
+    S16ToInts_SSE2,
+    IntsToS16_SSE2,
+    IntsToF32_SSE2,
+    F32ToS16_SSE2,
+    F32ToInts_SSE2,
+    Interleave2_16_SSE2,
+    Interleave2_32_SSE2,
+    Deinterleave2_16_SSE2,
+    Deinterleave2_32_SSE2,
+  };
+
+#endif
+
+
+#ifdef ADR_SIMD_AVX2
+
+  ADR_TARGET_AVX2 static void Swap16_AVX2(const u8* in, u8* out, int count) {
+    int i = 0;
+    const __m256i order = _mm256_setr_epi8(
+      1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+      1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    for (; i + 16 <= count; i += 16) {
+      const __m256i v = _mm256_loadu_si256((const __m256i*)(in + i * 2));
+      _mm256_storeu_si256(
+        (__m256i*)(out + i * 2), _mm256_shuffle_epi8(v, order));
+    }
+    Swap16(in + i * 2, out + i * 2, count - i);
+  }
+
+  ADR_TARGET_AVX2 static void Swap32_AVX2(const u8* in, u8* out, int count) {
+    int i = 0;
+    const __m256i order = _mm256_setr_epi8(
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    for (; i + 8 <= count; i += 8) {
+      const __m256i v = _mm256_loadu_si256((const __m256i*)(in + i * 4));
+      _mm256_storeu_si256(
+        (__m256i*)(out + i * 4), _mm256_shuffle_epi8(v, order));
+    }
+    Swap32(in + i * 4, out + i * 4, count - i);
+  }
+
+  ADR_TARGET_AVX2 static void S16ToInts_AVX2(
+    const s16* in, int shift, int* out, int count)
+  {
+    int i = 0;
+    const __m128i up = _mm_cvtsi32_si128(shift);
+    for (; i + 8 <= count; i += 8) {
+      const __m256i v = _mm256_cvtepi16_epi32(
+        _mm_loadu_si128((const __m128i*)(in + i)));
+      _mm256_storeu_si256((__m256i*)(out + i), _mm256_sll_epi32(v, up));
+    }
+    S16ToInts(in + i, shift, out + i, count - i);
+  }
+
+  ADR_TARGET_AVX2 static void IntsToS16_AVX2(
+    const int* in, int shift, s16* out, int count)
+  {
+    int i = 0;
+    const __m128i down = _mm_cvtsi32_si128(shift);
+    for (; i + 16 <= count; i += 16) {
+      const __m256i a = _mm256_loadu_si256((const __m256i*)(in + i));
+      const __m256i b = _mm256_loadu_si256((const __m256i*)(in + i + 8));
+      // packing works within 128-bit halves, so put the quarters in order
+      const __m256i packed = _mm256_packs_epi32(
+        _mm256_sra_epi32(a, down), _mm256_sra_epi32(b, down));
+      _mm256_storeu_si256(
+        (__m256i*)(out + i), _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+    IntsToS16(in + i, shift, out + i, count - i);
+  }
+
+  ADR_TARGET_AVX2 static void IntsToF32_AVX2(
+    const int* in, float scale, float* out, int count)
+  {
+    int i = 0;
+    const __m256 vscale = _mm256_set1_ps(scale);
+    for (; i + 8 <= count; i += 8) {
+      const __m256i v = _mm256_loadu_si256((const __m256i*)(in + i));
+      _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(v), vscale));
+    }
+    IntsToF32(in + i, scale, out + i, count - i);
+  }
+
+  ADR_TARGET_AVX2 static void F32ToS16_AVX2(
+    const float* in, s16* out, int count)
+  {
+    int i = 0;
+    const __m256 scale = _mm256_set1_ps(32768.0f);
+    const __m256 lo    = _mm256_set1_ps(-32768.0f);
+    const __m256 hi    = _mm256_set1_ps(32767.0f);
+    const __m256 half  = _mm256_set1_ps(0.5f);
+    const __m256 sign  = _mm256_set1_ps(-0.0f);
+    for (; i + 16 <= count; i += 16) {
+      __m256 a = _mm256_mul_ps(_mm256_loadu_ps(in + i), scale);
+      __m256 b = _mm256_mul_ps(_mm256_loadu_ps(in + i + 8), scale);
+      a = _mm256_max_ps(_mm256_min_ps(a, hi), lo);
+      b = _mm256_max_ps(_mm256_min_ps(b, hi), lo);
+      // add 0.5 with the sign of the sample, then truncate
+      a = _mm256_add_ps(a, _mm256_or_ps(_mm256_and_ps(a, sign), half));
+      b = _mm256_add_ps(b, _mm256_or_ps(_mm256_and_ps(b, sign), half));
+      const __m256i packed = _mm256_packs_epi32(
+        _mm256_cvttps_epi32(a), _mm256_cvttps_epi32(b));
+      _mm256_storeu_si256(
+        (__m256i*)(out + i), _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+    F32ToS16(in + i, out + i, count - i);
+  }
+
+  ADR_TARGET_AVX2 static void F32ToInts_AVX2(
+    const float* in, float limit, float scale, int* out, int count)
+  {
+    int i = 0;
+    const __m256 hi     = _mm256_set1_ps(limit);
+    const __m256 lo     = _mm256_set1_ps(-limit);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    for (; i + 8 <= count; i += 8) {
+      __m256 v = _mm256_loadu_ps(in + i);
+      v = _mm256_mul_ps(_mm256_max_ps(_mm256_min_ps(v, hi), lo), vscale);
+      _mm256_storeu_si256((__m256i*)(out + i), _mm256_cvttps_epi32(v));
+    }
+    F32ToInts(in + i, limit, scale, out + i, count - i);
+  }
+
+
+  static const ConvertKernels AVX2_KERNELS = {
+    Swap16_AVX2,
+    Swap32_AVX2,
+    FlipSign8_SSE2,
+    S16ToInts_AVX2,
+    IntsToS16_AVX2,
+    IntsToF32_AVX2,
+    F32ToS16_AVX2,
+    F32ToInts_AVX2,
+    Interleave2_16_SSE2,
+    Interleave2_32_SSE2,
+    Deinterleave2_16_SSE2,
+    Deinterleave2_32_SSE2,
+  };
+
+#endif
+
+
+  static const KernelChoice<ConvertKernels> CONVERT_KERNELS[] = {
+#ifdef ADR_SIMD_AVX2
+    { SIMD_AVX2, &AVX2_KERNELS   },
+#endif
+#ifdef ADR_SIMD_X86
+    { SIMD_SSE2, &SSE2_KERNELS   },
+#endif
+    { SIMD_NONE, &SCALAR_KERNELS },
+  };
+
+  static SIMDLevel GetConvertLevel() {
+    return ChooseKernels(CONVERT_KERNELS).level;
+  }
+
+  static KernelRegistration g_registration("convert", GetConvertLevel);
+
+
+  static inline const ConvertKernels& Kernels() {
+    return *ChooseKernels(CONVERT_KERNELS).kernels;
+  }
+
+
+  int GetRawSampleSize(RawSampleFormat format) {
+    switch (format) {
+      case RSF_U8:  return 1;
+      case RSF_S8:  return 1;
+      case RSF_S16: return 2;
+      case RSF_S24: return 3;
+      case RSF_S32: return 4;
+      case RSF_F32: return 4;
+      case RSF_F64: return 8;
+      default:      return 0;
+    }
+  }
+
+
+  SampleFormat GetDecodedSampleFormat(RawSampleFormat format) {
+    switch (format) {
+      case RSF_U8:
+      case RSF_S8:  return SF_U8;
+      case RSF_S16: return SF_S16;
+      default:      return GetPreferredSampleFormat();
+    }
+  }
+
+
+  /**
+   * Loads raw integer samples as host endian ints with full scale at
+   * 2^31, so every integer format converts the same way.
+   */
+  static void LoadIntegers(
+    const u8* in, RawSampleFormat format, bool big_endian,
+    int* stage, int count)
+  {
+    const bool swap = (big_endian != HOST_BIG_ENDIAN);
+    switch (format) {
+      case RSF_U8:
+        for (int i = 0; i < count; ++i) {
+          stage[i] = (int(in[i]) - 128) * (1 << 24);
+        }
+        break;
+
+      case RSF_S8:
+        for (int i = 0; i < count; ++i) {
+          stage[i] = int(s8(in[i])) * (1 << 24);
+        }
+        break;
+
+      case RSF_S16: {
+        s16 samples[STAGE_SIZE];
+        if (swap) {
+          Kernels().swap16(in, (u8*)samples, count);
+        } else {
+          memcpy(samples, in, count * 2);
+        }
+        Kernels().s16_to_ints(samples, 16, stage, count);
+        break;
+      }
+
+      case RSF_S24: {
+        // byte 0 is the most significant if big endian
+        const int hi = (big_endian ? 0 : 2);
+        const int lo = 2 - hi;
+        for (int i = 0; i < count; ++i) {
+          const u8* p = in + i * 3;
+          stage[i] = int((unsigned int)p[hi] << 24 |
+                         (unsigned int)p[1]  << 16 |
+                         (unsigned int)p[lo] << 8);
+        }
+        break;
+      }
+
+      case RSF_S32:
+        if (swap) {
+          Kernels().swap32(in, (u8*)stage, count);
+        } else {
+          memcpy(stage, in, count * 4);
+        }
+        break;
+
+      default:
+        break;
+    }
+  }
+
+
+  /// Loads raw float samples as host endian floats.
+  static void LoadFloats(
+    const u8* in, RawSampleFormat format, bool big_endian,
+    float* stage, int count)
+  {
+    const bool swap = (big_endian != HOST_BIG_ENDIAN);
+    if (format == RSF_F32) {
+      if (swap) {
+        Kernels().swap32(in, (u8*)stage, count);
+      } else {
+        memcpy(stage, in, count * 4);
+      }
+    } else {
+      for (int i = 0; i < count; ++i) {
+        u8 bytes[8];
+        for (int j = 0; j < 8; ++j) {
+          bytes[j] = in[i * 8 + (swap ? 7 - j : j)];
+        }
+        double d;
+        memcpy(&d, bytes, 8);
+        stage[i] = float(d);
+      }
+    }
+  }
+
+
+  static void StoreIntegers(
+    const int* stage, SampleFormat format, u8* out, int count)
+  {
+    if (format == SF_U8) {
+      for (int i = 0; i < count; ++i) {
+        out[i] = u8((stage[i] >> 24) + 128);
+      }
+    } else if (format == SF_S16) {
+      Kernels().ints_to_s16(stage, 16, (s16*)out, count);
+    } else {
+      Kernels().ints_to_f32(stage, 1.0f / 2147483648.0f, (float*)out, count);
+    }
+  }
+
+
+  static void StoreFloats(
+    const float* stage, SampleFormat format, u8* out, int count)
+  {
+    if (format == SF_U8) {
+      for (int i = 0; i < count; ++i) {
+        out[i] = u8(FloatToInt(stage[i], 128.0f, 127.0f) + 128);
+      }
+    } else if (format == SF_S16) {
+      Kernels().f32_to_s16(stage, (s16*)out, count);
+    } else {
+      memcpy(out, stage, count * 4);
+    }
+  }
+
+
+  void ConvertRawSamples(
+    const void* in, RawSampleFormat in_format, bool big_endian,
+    void* out, SampleFormat out_format,
+    int sample_count)
+  {
+    const u8* i = (const u8*)in;
+    u8* o = (u8*)out;
+    const bool swap = (big_endian != HOST_BIG_ENDIAN);
+
+    // formats that only need their bytes shuffled
+    if ((in_format == RSF_U8  && out_format == SF_U8) ||
+        (in_format == RSF_S16 && out_format == SF_S16 && !swap) ||
+        (in_format == RSF_F32 && out_format == SF_F32 && !swap))
+    {
+      if (in != out) {
+        memcpy(out, in, sample_count * GetSampleSize(out_format));
+      }
+      return;
+    } else if (in_format == RSF_S8 && out_format == SF_U8) {
+      Kernels().flip_sign8(i, o, sample_count);
+      return;
+    } else if (in_format == RSF_S16 && out_format == SF_S16) {
+      Kernels().swap16(i, o, sample_count);
+      return;
+    } else if (in_format == RSF_F32 && out_format == SF_F32) {
+      Kernels().swap32(i, o, sample_count);
+      return;
+    }
+
+    const int in_size = GetRawSampleSize(in_format);
+    const int out_size = GetSampleSize(out_format);
+    const bool is_float = (in_format == RSF_F32 || in_format == RSF_F64);
+
+    // Each block is loaded completely before any of it is stored, so
+    // converting in place works when the sizes match.
+    int ints[STAGE_SIZE];
+    float floats[STAGE_SIZE];
+    while (sample_count > 0) {
+      const int count = std::min(sample_count, STAGE_SIZE);
+      if (is_float) {
+        LoadFloats(i, in_format, big_endian, floats, count);
+        StoreFloats(floats, out_format, o, count);
+      } else {
+        LoadIntegers(i, in_format, big_endian, ints, count);
+        StoreIntegers(ints, out_format, o, count);
+      }
+      i += count * in_size;
+      o += count * out_size;
+      sample_count -= count;
+    }
+  }
+
+
+  void ConvertSamples(
+    const void* in, SampleFormat in_format,
+    void* out, SampleFormat out_format,
+    int sample_count)
+  {
+    RawSampleFormat raw_format;
+    switch (in_format) {
+      case SF_U8:  raw_format = RSF_U8;  break;
+      case SF_S16: raw_format = RSF_S16; break;
+      default:     raw_format = RSF_F32; break;
+    }
+    ConvertRawSamples(
+      in, raw_format, HOST_BIG_ENDIAN, out, out_format, sample_count);
+  }
+
+
+  /// Converts ints with full scale at 2^(bits - 1) to clipped 16-bit samples.
+  static void ScaleToS16(const int* in, int bits, s16* out, int count) {
+    if (bits >= 16) {
+      Kernels().ints_to_s16(in, bits - 16, out, count);
+    } else {
+      const int scale = 1 << (16 - bits);
+      for (int i = 0; i < count; ++i) {
+        out[i] = s16(clamp(-32768, in[i] * scale, 32767));
+      }
+    }
+  }
+
+
+  void InterleaveIntegers(
+    const int* const in[], int channel_count, int bits,
+    void* out, SampleFormat out_format,
+    int frame_count)
+  {
+    const int frame_size = channel_count * GetSampleSize(out_format);
+    const float scale = 1.0f / float(1 << (bits - 1));
+    u8* o = (u8*)out;
+
+    s16 l16[STAGE_SIZE];
+    s16 r16[STAGE_SIZE];
+    float l32[STAGE_SIZE];
+    float r32[STAGE_SIZE];
+    for (int begin = 0; begin < frame_count; begin += STAGE_SIZE) {
+      const int count = std::min(frame_count - begin, STAGE_SIZE);
+
+      if (out_format == SF_F32) {
+
+        // floats keep whatever exceeds full scale
+        float* of = (float*)o;
+        if (channel_count == 2) {
+          Kernels().ints_to_f32(in[0] + begin, scale, l32, count);
+          Kernels().ints_to_f32(in[1] + begin, scale, r32, count);
+          Kernels().interleave2_32(l32, r32, of, count);
+        } else {
+          for (int c = 0; c < channel_count; ++c) {
+            Kernels().ints_to_f32(in[c] + begin, scale, l32, count);
+            for (int i = 0; i < count; ++i) {
+              of[i * channel_count + c] = l32[i];
+            }
+          }
+        }
+
+      } else if (out_format == SF_S16 && channel_count == 2) {
+
+        ScaleToS16(in[0] + begin, bits, l16, count);
+        ScaleToS16(in[1] + begin, bits, r16, count);
+        Kernels().interleave2_16(l16, r16, (s16*)o, count);
+
+      } else {
+
+        for (int c = 0; c < channel_count; ++c) {
+          ScaleToS16(in[c] + begin, bits, l16, count);
+          if (out_format == SF_S16) {
+            s16* os = (s16*)o;
+            for (int i = 0; i < count; ++i) {
+              os[i * channel_count + c] = l16[i];
+            }
+          } else {
+            for (int i = 0; i < count; ++i) {
+              o[i * channel_count + c] = u8((l16[i] >> 8) + 128);
+            }
+          }
+        }
+
+      }
+
+      o += count * frame_size;
+    }
+  }
+
+
+  void DeinterleaveIntegers(
+    const void* in, SampleFormat in_format, int channel_count,
+    int* const out[], int frame_count)
+  {
+    const u8* i8 = (const u8*)in;
+    const int frame_size = channel_count * GetSampleSize(in_format);
+
+    int stage[STAGE_SIZE];
+    const int stage_frames = STAGE_SIZE / channel_count;
+    for (int begin = 0; begin < frame_count; begin += stage_frames) {
+      const int count = std::min(frame_count - begin, stage_frames);
+      const int samples = count * channel_count;
+
+      if (in_format == SF_S16 && channel_count == 2) {
+        Kernels().deinterleave2_16(
+          (const s16*)i8, out[0] + begin, out[1] + begin, count);
+        i8 += count * frame_size;
+        continue;
+      }
+
+      // bring every format to 16-bit scale first
+      if (in_format == SF_U8) {
+        for (int i = 0; i < samples; ++i) {
+          stage[i] = (int(i8[i]) - 128) * 256;
+        }
+      } else if (in_format == SF_S16) {
+        Kernels().s16_to_ints((const s16*)i8, 0, stage, samples);
+      } else {
+        Kernels().f32_to_ints(
+          (const float*)i8, 8.0f, 32768.0f, stage, samples);
+      }
+
+      if (channel_count == 1) {
+        memcpy(out[0] + begin, stage, count * sizeof(int));
+      } else if (channel_count == 2) {
+        Kernels().deinterleave2_32(
+          stage, out[0] + begin, out[1] + begin, count);
+      } else {
+        for (int c = 0; c < channel_count; ++c) {
+          int* o = out[c] + begin;
+          for (int i = 0; i < count; ++i) {
+            o[i] = stage[i * channel_count + c];
+          }
+        }
+      }
+
+      i8 += count * frame_size;
+    }
+  }
+
+
+  int ReadRawFrames(
+    File* file, RawSampleFormat format, bool big_endian, int channel_count,
+    SampleFormat out_format, int frame_count, void* buffer)
+  {
+    const int raw_frame_size = channel_count * GetRawSampleSize(format);
+    const int frame_size = channel_count * GetSampleSize(out_format);
+
+    // if the sizes match, convert where the samples were read
+    if (raw_frame_size == frame_size) {
+      const int read = file->read(buffer, frame_count * frame_size);
+      const int frames_read = read / frame_size;
+      ConvertRawSamples(
+        buffer, format, big_endian, buffer, out_format,
+        frames_read * channel_count);
+      return frames_read;
+    }
+
+    u8 raw[RAW_CHUNK_SIZE];
+    const int chunk_frames = RAW_CHUNK_SIZE / raw_frame_size;
+    u8* out = (u8*)buffer;
+    int frames_read = 0;
+    while (frames_read < frame_count) {
+      const int to_read = std::min(chunk_frames, frame_count - frames_read);
+      const int read = file->read(raw, to_read * raw_frame_size);
+      const int frames = read / raw_frame_size;
+      ConvertRawSamples(
+        raw, format, big_endian, out, out_format, frames * channel_count);
+
+      out         += frames * frame_size;
+      frames_read += frames;
+      if (frames < to_read) {
+        break;
+      }
+    }
+    return frames_read;
+  }
+
+}
@@ -0,0 +1,98 @@
+/**
+ * @file
+ *
+ * Sample format conversion: from the formats PCM files store to the ones
+ * SampleSources produce, and between the interleaved samples sources
+ * produce and the separate channels decoders and the resampler use.
+ */
+
+#ifndef CONVERT_H
+#define CONVERT_H
+
+
+#include "audiere.h"
+#include "types.h"
+
+
+namespace audiere {
+
+  /// How a file stores each sample.  Integers are signed unless noted.
+  enum RawSampleFormat {
+    RSF_U8,   ///< unsigned 8-bit
+    RSF_S8,
+    RSF_S16,
+    RSF_S24,  ///< packed in three bytes
+    RSF_S32,
+    RSF_F32,  ///< IEEE float
+    RSF_F64,  ///< IEEE double
+  };
+
+  /// Returns the size of a raw sample in bytes.
+  int GetRawSampleSize(RawSampleFormat format);
+
+  /**
+   * Returns the format a source produces from raw samples: SF_U8 and
+   * SF_S16 for 8- and 16-bit integers, and the preferred sample format
+   * for anything wider.
+   */
+  SampleFormat GetDecodedSampleFormat(RawSampleFormat format);
+
+  /**
+   * Converts raw samples to a SampleFormat.  Integers are scaled so full
+   * scale stays full scale, and floats are clipped when converted to
+   * integers.  in and out may be the same buffer if the raw and converted
+   * samples are the same size.
+   *
+   * @param big_endian  whether the raw samples are big endian
+   */
+  void ConvertRawSamples(
+    const void* in, RawSampleFormat in_format, bool big_endian,
+    void* out, SampleFormat out_format,
+    int sample_count);
+
+  /**
+   * Converts host endian samples between SampleFormats, the same way
+   * ConvertRawSamples does.
+   */
+  void ConvertSamples(
+    const void* in, SampleFormat in_format,
+    void* out, SampleFormat out_format,
+    int sample_count);
+
+  /**
+   * Interleaves channels of integer samples and converts them to a
+   * SampleFormat.  Integer formats are clipped, and floats keep whatever
+   * exceeds full scale.
+   *
+   * @param in    channel_count arrays of frame_count samples
+   * @param bits  full scale of the input is 2^(bits - 1), bits <= 31
+   */
+  void InterleaveIntegers(
+    const int* const in[], int channel_count, int bits,
+    void* out, SampleFormat out_format,
+    int frame_count);
+
+  /**
+   * Splits interleaved samples into channels of ints with full scale at
+   * 2^15.  Floats are clipped at eight times full scale.
+   *
+   * @param out  channel_count arrays of frame_count samples
+   */
+  void DeinterleaveIntegers(
+    const void* in, SampleFormat in_format, int channel_count,
+    int* const out[], int frame_count);
+
+  /**
+   * Reads interleaved raw frames from a file and converts them.
+   *
+   * @return  number of frames read, less than frame_count at the end of
+   *          the file
+   */
+  int ReadRawFrames(
+    File* file, RawSampleFormat format, bool big_endian, int channel_count,
+    SampleFormat out_format, int frame_count, void* buffer);
+
+}
+
+
+#endif
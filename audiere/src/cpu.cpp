@@ -0,0 +1,193 @@
+#ifdef _MSC_VER
+#pragma warning(disable : 4786)
+#endif
+
+
+#include <stdlib.h>
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+#include "cpu.h"
+#include "debug.h"
+#include "internal.h"
+#include "threads.h"
+#include "utility.h"
+
+#ifdef ADR_SIMD_X86
+  #ifdef _MSC_VER
+    #include <intrin.h>
+  #else
+    #include <cpuid.h>
+  #endif
+#endif
+
+
+namespace audiere {
+
+  // -1 until computed.  Computing them twice at once is harmless.
+  static volatile int g_cpu_level = -1;
+  static volatile int g_limit = -1;
+
+  KernelRegistration* KernelRegistration::s_first = 0;
+
+
+#ifdef ADR_SIMD_X86
+
+  static void CPUID(int leaf, unsigned int regs[4]) {
+#if defined(_MSC_VER)
+    __cpuidex((int*)regs, leaf, 0);
+#else
+    __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+  }
+
+  /// XCR0: which register sets the OS saves on context switches
+  static unsigned int XGETBV0() {
+#if defined(_MSC_VER) && _MSC_VER >= 1600
+    return (unsigned int)_xgetbv(0);
+#elif defined(_MSC_VER)
+    return 0;
+#else
+    unsigned int eax, edx;
+    __asm__ (".byte 0x0f, 0x01, 0xd0" : "=a" (eax), "=d" (edx) : "c" (0));
+    return eax;
+#endif
+  }
+
+  static SIMDLevel DetectSIMDLevel() {
+    unsigned int regs[4];
+    CPUID(0, regs);
+    const unsigned int max_leaf = regs[0];
+    if (max_leaf < 1) {
+      return SIMD_NONE;
+    }
+
+    CPUID(1, regs);
+    if (!(regs[3] & (1 << 26))) {
+      return SIMD_NONE;
+    }
+    if (!(regs[2] & (1 << 19))) {
+      return SIMD_SSE2;
+    }
+
+#ifdef ADR_SIMD_AVX2
+    // AVX2 needs OSXSAVE and AVX, the OS saving the YMM registers, and
+    // the AVX2 bit of leaf 7
+    if (max_leaf >= 7 &&
+        (regs[2] & (1 << 27)) && (regs[2] & (1 << 28)) &&
+        (XGETBV0() & 6) == 6)
+    {
+      CPUID(7, regs);
+      if (regs[1] & (1 << 5)) {
+        return SIMD_AVX2;
+      }
+    }
+#endif
+
+    return SIMD_SSE41;
+  }
+
+#else
+
+  static SIMDLevel DetectSIMDLevel() {
+    return SIMD_NONE;
+  }
+
+#endif
+
+
+  SIMDLevel GetCPUSIMDLevel() {
+    if (g_cpu_level < 0) {
+      g_cpu_level = DetectSIMDLevel();
+    }
+    return SIMDLevel(g_cpu_level);
+  }
+
+
+  SIMDLevel GetSIMDLevel() {
+    if (g_limit < 0) {
+      SIMDLevel limit = SIMD_AVX2;
+      const char* env = getenv("AUDIERE_SIMD");
+      if (env && !ParseSIMDLevel(env, limit)) {
+        ADR_LOG("Ignoring unknown AUDIERE_SIMD value");
+        limit = SIMD_AVX2;
+      }
+      g_limit = limit;
+    }
+    return std::min(GetCPUSIMDLevel(), SIMDLevel(g_limit));
+  }
+
+
+  void SetSIMDLimit(SIMDLevel limit) {
+    g_limit = limit;
+  }
+
+
+  static const char* const LEVEL_NAMES[] = {
+    "none",
+    "sse2",
+    "sse4.1",
+    "avx2",
+  };
+
+
+  const char* GetSIMDLevelName(SIMDLevel level) {
+    return LEVEL_NAMES[level];
+  }
+
+
+  bool ParseSIMDLevel(const char* name, SIMDLevel& level) {
+    for (int i = SIMD_NONE; i <= SIMD_AVX2; ++i) {
+      if (strcmp_case(name, LEVEL_NAMES[i]) == 0) {
+        level = SIMDLevel(i);
+        return true;
+      }
+    }
+    return false;
+  }
+
+
+  KernelRegistration::KernelRegistration(
+    const char* name, LevelFunction selected)
+  {
+    m_name     = name;
+    m_selected = selected;
+    m_next     = s_first;
+    s_first    = this;
+  }
+
+
+  std::string KernelRegistration::Describe() {
+    typedef std::pair<std::string, std::string> Entry;
+    std::vector<Entry> entries;
+    for (KernelRegistration* r = s_first; r; r = r->m_next) {
+      entries.push_back(Entry(r->m_name, GetSIMDLevelName(r->m_selected())));
+    }
+    std::sort(entries.begin(), entries.end());
+
+    std::string result;
+    for (size_t i = 0; i < entries.size(); ++i) {
+      if (i > 0) {
+        result += ";";
+      }
+      result += entries[i].first + ":" + entries[i].second;
+    }
+    return result;
+  }
+
+
+  // Every description AdrGetSelectedKernels has returned.  One only
+  // changes when a SIMD limit does, so there are only ever a few, and
+  // keeping them all means a returned string is never overwritten.
+  static Mutex g_kernels_mutex;
+  static std::set<std::string> g_kernels;
+
+
+  ADR_EXPORT(const char*) AdrGetSelectedKernels() {
+    const std::string kernels = KernelRegistration::Describe();
+    SYNCHRONIZED(g_kernels_mutex);
+    return g_kernels.insert(kernels).first->c_str();
+  }
+
+}
@@ -0,0 +1,120 @@
+/**
+ * @file
+ *
+ * Processor feature detection and selection of SIMD kernels at run time.
+ */
+
+#ifndef CPU_H
+#define CPU_H
+
+
+#include <string>
+
+
+// ADR_SIMD_X86:  the compiler can build SSE2 and SSE4.1 kernels.
+// ADR_SIMD_AVX2: it can build AVX2 kernels too.
+//
+// Kernels are marked with ADR_TARGET_SSE2, ADR_TARGET_SSE41 or
+// ADR_TARGET_AVX2 so they can be built into a binary that still runs on
+// processors without those instruction sets.  They must only be called
+// when GetSIMDLevel() allows it.
+#if defined(__GNUC__) && \
+    (defined(__i386__) || defined(__x86_64__)) && \
+    (defined(__clang__) || __GNUC__ > 4 || \
+     (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+  #define ADR_SIMD_X86
+  #define ADR_SIMD_AVX2
+  #define ADR_TARGET_SSE2  __attribute__((target("sse2")))
+  #define ADR_TARGET_SSE41 __attribute__((target("sse4.1")))
+  #define ADR_TARGET_AVX2  __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && _MSC_VER >= 1500 && \
+    (defined(_M_IX86) || defined(_M_X64))
+  #define ADR_SIMD_X86
+  #if _MSC_VER >= 1800
+    #define ADR_SIMD_AVX2
+  #endif
+  #define ADR_TARGET_SSE2
+  #define ADR_TARGET_SSE41
+  #define ADR_TARGET_AVX2
+#endif
+
+
+namespace audiere {
+
+  /// Instruction sets kernels can use, each including the ones before it.
+  enum SIMDLevel {
+    SIMD_NONE,
+    SIMD_SSE2,
+    SIMD_SSE41,
+    SIMD_AVX2,
+  };
+
+  /// Returns the best instruction set both the processor and OS support.
+  SIMDLevel GetCPUSIMDLevel();
+
+  /**
+   * Returns the best instruction set kernels may use: what the processor
+   * supports, limited by the AUDIERE_SIMD environment variable or the
+   * "simd" parameter of OpenDevice.
+   */
+  SIMDLevel GetSIMDLevel();
+
+  /// Limits the instruction sets kernels chosen from now on may use.
+  void SetSIMDLimit(SIMDLevel limit);
+
+  /// Returns "none", "sse2", "sse4.1" or "avx2".
+  const char* GetSIMDLevelName(SIMDLevel level);
+
+  /// Parses a name returned by GetSIMDLevelName, ignoring case.
+  bool ParseSIMDLevel(const char* name, SIMDLevel& level);
+
+
+  /// One implementation of a set of kernels and what it needs to run.
+  template<typename Kernels>
+  struct KernelChoice {
+    SIMDLevel level;
+    const Kernels* kernels;
+  };
+
+  /**
+   * Returns the first choice the current SIMD level allows.  Choices are
+   * listed best first and end with one for SIMD_NONE.
+   */
+  template<typename Kernels>
+  const KernelChoice<Kernels>& ChooseKernels(
+    const KernelChoice<Kernels>* choices)
+  {
+    const SIMDLevel level = GetSIMDLevel();
+    while (choices->level > level) {
+      ++choices;
+    }
+    return *choices;
+  }
+
+
+  /**
+   * Names a set of kernels for GetSelectedKernels().  Define one at
+   * namespace scope next to each set of kernels.
+   */
+  class KernelRegistration {
+  public:
+    typedef SIMDLevel (*LevelFunction)();
+
+    /// @param selected  returns the level of the kernels in use
+    KernelRegistration(const char* name, LevelFunction selected);
+
+    /// Returns "name1:level1;name2:level2;...", sorted by name.
+    static std::string Describe();
+
+  private:
+    const char* m_name;
+    LevelFunction m_selected;
+    KernelRegistration* m_next;
+
+    static KernelRegistration* s_first;
+  };
+
+}
+
+
+#endif
@@ -0,0 +1,49 @@
+#include "decoder_pool.h"
+#include "internal.h"
+
+
+namespace audiere {
+
+  static const int DEFAULT_POOL_SIZE = 4;
+
+  // Plain data, so they are set before any pool is constructed.
+  static DecoderPoolBase* g_pools = 0;
+  static volatile long g_pool_size = DEFAULT_POOL_SIZE;
+
+
+  int GetDecoderPoolSize() {
+    return g_pool_size;
+  }
+
+
+  DecoderPoolBase::DecoderPoolBase() {
+    m_next = g_pools;
+    g_pools = this;
+  }
+
+
+  DecoderPoolBase::~DecoderPoolBase() {
+    DecoderPoolBase** p = &g_pools;
+    while (*p && *p != this) {
+      p = &(*p)->m_next;
+    }
+    if (*p) {
+      *p = m_next;
+    }
+  }
+
+
+  void
+  DecoderPoolBase::TrimAll() {
+    for (DecoderPoolBase* pool = g_pools; pool; pool = pool->m_next) {
+      pool->trim();
+    }
+  }
+
+
+  ADR_EXPORT(void) AdrSetDecoderPoolSize(int size) {
+    g_pool_size = (size > 0 ? size : 0);
+    DecoderPoolBase::TrimAll();
+  }
+
+}
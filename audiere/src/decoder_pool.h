@@ -0,0 +1,113 @@
+#ifndef DECODER_POOL_H
+#define DECODER_POOL_H
+
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4786)
+#endif
+
+
+#include <vector>
+#include "threads.h"
+
+
+namespace audiere {
+
+  /// Most idle decoders each pool keeps, as set by SetDecoderPoolSize.
+  int GetDecoderPoolSize();
+
+
+  /**
+   * Untyped part of DecoderPool.  Every pool links itself into a global
+   * list when it is constructed, so a smaller pool size can be applied to
+   * all of them at once.  Pools must be globals: the list is only changed
+   * during static construction and destruction and isn't locked.
+   */
+  class DecoderPoolBase {
+  public:
+    /// Frees idle decoders beyond GetDecoderPoolSize().
+    virtual void trim() = 0;
+
+    /// Calls trim() on every pool.
+    static void TrimAll();
+
+  protected:
+    DecoderPoolBase();
+    virtual ~DecoderPoolBase();
+
+  private:
+    DecoderPoolBase* m_next;
+  };
+
+
+  /**
+   * Keeps the decoders of closed streams so the next stream of the same
+   * format can reuse one instead of allocating its own.  Streams take a
+   * decoder with acquire() and create one only if that returns 0.  When
+   * they are done, release() keeps the decoder for later, or destroys it
+   * if the pool is already at its size limit.  Resetting a decoder for
+   * its next stream is up to the stream that acquires it.
+   */
+  template<typename T>
+  class DecoderPool : public DecoderPoolBase {
+  public:
+    typedef void (*DestroyFunction)(T* decoder);
+
+    DecoderPool(DestroyFunction destroy) {
+      m_destroy = destroy;
+    }
+
+    ~DecoderPool() {
+      for (size_t i = 0; i < m_decoders.size(); ++i) {
+        m_destroy(m_decoders[i]);
+      }
+    }
+
+    /// @return  an idle decoder, or 0 if there is none
+    T* acquire() {
+      SYNCHRONIZED(m_mutex);
+      if (m_decoders.empty()) {
+        return 0;
+      }
+      T* decoder = m_decoders.back();
+      m_decoders.pop_back();
+      return decoder;
+    }
+
+    void release(T* decoder) {
+      {
+        SYNCHRONIZED(m_mutex);
+        if (int(m_decoders.size()) < GetDecoderPoolSize()) {
+          m_decoders.push_back(decoder);
+          return;
+        }
+      }
+      m_destroy(decoder);
+    }
+
+    void trim() {
+      std::vector<T*> extra;
+      {
+        SYNCHRONIZED(m_mutex);
+        const size_t size = GetDecoderPoolSize();
+        if (m_decoders.size() > size) {
+          extra.assign(m_decoders.begin() + size, m_decoders.end());
+          m_decoders.resize(size);
+        }
+      }
+      // destroy them outside the lock
+      for (size_t i = 0; i < extra.size(); ++i) {
+        m_destroy(extra[i]);
+      }
+    }
+
+  private:
+    Mutex m_mutex;
+    std::vector<T*> m_decoders;
+    DestroyFunction m_destroy;
+  };
+
+}
+
+
+#endif
@@ -4,8 +4,12 @@
 #endif
 
 
+#include <limits.h>
+#include <algorithm>
 #include <string>
+#include "atomic.h"
 #include "audiere.h"
+#include "cpu.h"
 #include "debug.h"
 #include "device_null.h"
 #include "internal.h"
@@ -50,21 +54,21 @@
 
 namespace audiere {
 
-  AbstractDevice::AbstractDevice() {
+  AbstractDevice::AbstractDevice()
+  : m_events(EVENT_QUEUE_SIZE)
+  {
+    m_event_thread_started = false;
     m_thread_exists = false;
     m_thread_should_die = false;
-
-    bool result = AI_CreateThread(eventThread, this, 2);
-    if (!result) {
-      ADR_LOG("THREAD CREATION FAILED");
-    }
+    m_overflowed = 0;
+    m_wake_pending = 0;
   }
 
   AbstractDevice::~AbstractDevice() {
     m_thread_should_die = true;
 
     // Trick the thread into no longer waiting.
-    m_events_available.notify();
+    m_events_available.post();
 
     while (m_thread_exists) {
       AI_Sleep(50);
@@ -88,16 +92,60 @@ namespace audiere {
     m_callbacks.clear();
   }
 
+  int AbstractDevice::pollEvents(int max_events) {
+    if (m_event_thread_started || max_events <= 0) {
+      return 0;
+    }
+
+    std::vector<EventPtr> events;
+    m_poll_mutex.lock();
+    takeEvents(events, max_events);
+    m_poll_mutex.unlock();
+
+    // callbacks may poll again, so don't hold the lock while calling them
+    for (size_t i = 0; i < events.size(); ++i) {
+      processEvent(events[i].get());
+    }
+    return int(events.size());
+  }
+
+  void AbstractDevice::startEventThread() {
+    m_event_thread_started = true;
+    bool result = AI_CreateThread(eventThread, this, 2);
+    if (!result) {
+      ADR_LOG("THREAD CREATION FAILED");
+    }
+  }
+
+  OutputStream* AbstractDevice::openSampleBuffer(SampleBuffer* buffer) {
+    int channel_count, sample_rate;
+    SampleFormat sample_format;
+    buffer->getFormat(channel_count, sample_rate, sample_format);
+    return openBuffer(
+      (void*)buffer->getSamples(), buffer->getLength(),
+      channel_count, sample_rate, sample_format);
+  }
+
+
   void AbstractDevice::fireStopEvent(OutputStreamPtr stream, StopEvent::Reason reason) {
-    StopEventPtr event = new StopEventImpl(stream, reason);
-    fireStopEvent(event);
+    PendingStopEvent event;
+    event.stream = stream;
+    event.reason = reason;
+    if (AtomicLoadAcquire(m_overflowed) || !m_events.push(event)) {
+      ADR_LOG("Event queue full");
+      SYNCHRONIZED(m_overflow_mutex);
+      m_overflow.push_back(event);
+      AtomicStoreRelease(m_overflowed, 1);
+    }
+
+    // only the first event since the thread last woke needs to wake it
+    if (AtomicExchange(m_wake_pending, 1) == 0) {
+      m_events_available.post();
+    }
   }
 
   void AbstractDevice::fireStopEvent(const StopEventPtr& event) {
-    m_event_mutex.lock();
-    m_events.push(event.get());
-    m_event_mutex.unlock();
-    m_events_available.notify();
+    fireStopEvent(event->getOutputStream(), event->getReason());
   }
 
   void AbstractDevice::eventThread(void* arg) {
@@ -111,38 +159,54 @@ namespace audiere {
   void AbstractDevice::eventThread() {
     ADR_GUARD("AbstractDevice::eventThread");
     m_thread_exists = true;
+    std::vector<EventPtr> events;
     while (!m_thread_should_die) {
-      m_event_mutex.lock();
-      while (m_events.empty()) {
-        m_events_available.wait(m_event_mutex, 1);
-        if (m_thread_should_die) {
-          break;
-        }
-      }
+      // The semaphore keeps a post made before the wait, so no wakeup is
+      // lost.  The timeout is only a fallback for shutting down.
+      m_events_available.wait(1);
       if (m_thread_should_die) {
-        m_event_mutex.unlock();
         break;
       }
 
-      // Make a local copy of the events so they can be processed without
-      // leaving the mutex locked.
-      EventQueue events = m_events;
-
-      // Queues don't support clear().  o_o
-      while (!m_events.empty()) {
-        m_events.pop();
+      // Take every waiting event, then deliver them as one batch.
+      AtomicExchange(m_wake_pending, 0);
+      takeEvents(events, INT_MAX);
+      for (size_t i = 0; i < events.size(); ++i) {
+        processEvent(events[i].get());
       }
+      events.clear();
+    }
+    m_thread_exists = false;
+  }
+
+  void AbstractDevice::takeEvents(
+    std::vector<EventPtr>& events,
+    int max_events)
+  {
+    PendingStopEvent pending;
+    while (int(events.size()) < max_events && m_events.pop(pending)) {
+      events.push_back(new StopEventImpl(pending.stream, pending.reason));
+    }
 
-      m_event_mutex.unlock();
+    // The overflow list mostly holds events fired after those in the
+    // queue, though only events from the same thread are sure to be.
+    if (int(events.size()) < max_events && AtomicLoadAcquire(m_overflowed)) {
+      std::vector<PendingStopEvent> overflow;
+      m_overflow_mutex.lock();
+      const size_t count = std::min(
+        m_overflow.size(), size_t(max_events - int(events.size())));
+      overflow.assign(m_overflow.begin(), m_overflow.begin() + count);
+      m_overflow.erase(m_overflow.begin(), m_overflow.begin() + count);
+      if (m_overflow.empty()) {
+        AtomicStoreRelease(m_overflowed, 0);
+      }
+      m_overflow_mutex.unlock();
 
-      // Process the events.
-      while (!events.empty()) {
-        EventPtr event = events.front();
-        events.pop();
-        processEvent(event.get());
+      for (size_t i = 0; i < overflow.size(); ++i) {
+        events.push_back(
+          new StopEventImpl(overflow[i].stream, overflow[i].reason));
       }
     }
-    m_thread_exists = false;
   }
 
   void AbstractDevice::processEvent(Event* event) {
@@ -189,11 +253,11 @@ namespace audiere {
 
   #define NEED_SEMICOLON do ; while (false)
 
-  #define TRY_GROUP(group_name) {                               \
-    AudioDevice* device = DoOpenDevice(group_name, parameters); \
-    if (device) {                                               \
-      return device;                                            \
-    }                                                           \
+  #define TRY_GROUP(group_name) {                                  \
+    AbstractDevice* device = DoOpenDevice(group_name, parameters); \
+    if (device) {                                                  \
+      return device;                                               \
+    }                                                              \
   } NEED_SEMICOLON
 
   #define TRY_DEVICE(DeviceType) {                         \
@@ -204,7 +268,7 @@ namespace audiere {
   } NEED_SEMICOLON
 
 
-  AudioDevice* DoOpenDevice(
+  AbstractDevice* DoOpenDevice(
     const std::string& name,
     const ParameterList& parameters)
   {
@@ -310,7 +374,7 @@ namespace audiere {
 
   class ThreadedDevice : public RefImplementation<AudioDevice> {
   public:
-    ThreadedDevice(AudioDevice* device) {
+    ThreadedDevice(AbstractDevice* device) {
       ADR_GUARD("ThreadedDevice::ThreadedDevice");
       if (device) {
         ADR_LOG("Device is valid");
@@ -369,6 +433,14 @@ namespace audiere {
       m_device->clearCallbacks();
     }
 
+    int ADR_CALL pollEvents(int max_events) {
+      return m_device->pollEvents(max_events);
+    }
+
+    AbstractDevice* getDevice() {
+      return m_device.get();
+    }
+
   private:
     void run() {
       ADR_GUARD("ThreadedDevice::run");
@@ -392,12 +464,21 @@ namespace audiere {
     }
 
   private:
-    RefPtr<AudioDevice> m_device;
+    RefPtr<AbstractDevice> m_device;
     volatile bool m_thread_should_die;
     volatile bool m_thread_exists;
   };
 
 
+  AbstractDevice* GetAbstractDevice(AudioDevice* device) {
+    ThreadedDevice* threaded = dynamic_cast<ThreadedDevice*>(device);
+    if (threaded) {
+      return threaded->getDevice();
+    }
+    return dynamic_cast<AbstractDevice*>(device);
+  }
+
+
   ADR_EXPORT(AudioDevice*) AdrOpenDevice(
     const char* name,
     const char* parameters)
@@ -411,15 +492,27 @@ namespace audiere {
       parameters = "";
     }
 
+    ParameterList parameter_list(parameters);
+    SIMDLevel simd_limit;
+    const std::string simd = parameter_list.getValue("simd", "");
+    if (!simd.empty() && ParseSIMDLevel(simd.c_str(), simd_limit)) {
+      SetSIMDLimit(simd_limit);
+    }
+
     // first, we need an unthreaded audio device
-    AudioDevice* device = DoOpenDevice(
+    AbstractDevice* device = DoOpenDevice(
       std::string(name),
-      ParameterList(parameters));
+      parameter_list);
     if (!device) {
       ADR_LOG("Could not open device");
       return 0;
     }
 
+    // with "events=poll", the application delivers events itself
+    if (parameter_list.getValue("events", "thread") != "poll") {
+      device->startEventThread();
+    }
+
     ADR_LOG("creating threaded device");
     return new ThreadedDevice(device);
   }
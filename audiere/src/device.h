@@ -2,8 +2,9 @@
 #define DEVICE_H
 
 
-#include <queue>
+#include <vector>
 #include "audiere.h"
+#include "lockfree_queue.h"
 #include "threads.h"
 
 
@@ -41,27 +42,71 @@ namespace audiere {
     void ADR_CALL registerCallback(Callback* callback);
     void ADR_CALL unregisterCallback(Callback* callback);
     void ADR_CALL clearCallbacks();
+    int ADR_CALL pollEvents(int max_events);
+
+    /// Starts the thread that delivers events.  Without it, pollEvents does.
+    void startEventThread();
+
+    /**
+     * Plays the samples of a buffer.  Devices that mix in software read
+     * them in place; the default copies them with openBuffer().
+     */
+    virtual OutputStream* openSampleBuffer(SampleBuffer* buffer);
 
   protected:
+    /**
+     * Queues an event for the event thread.  Doesn't block or allocate
+     * while fewer than EVENT_QUEUE_SIZE events are waiting, so mixer
+     * threads can call it while holding their own locks.  Past that it
+     * takes a lock and allocates rather than drop the event.
+     */
     void fireStopEvent(OutputStreamPtr stream, StopEvent::Reason reason);
     void fireStopEvent(const StopEventPtr& event);
 
   private:
     static void eventThread(void* arg);
     void eventThread();
+    void takeEvents(std::vector<EventPtr>& events, int max_events);
     void processEvent(Event* event);
 
+    bool m_event_thread_started;
     volatile bool m_thread_exists;
     volatile bool m_thread_should_die;
 
-    Mutex m_event_mutex;
-    CondVar m_events_available;
-    typedef std::queue<EventPtr> EventQueue;
-    EventQueue m_events;
+    // the queue only allows one thread at a time to take events
+    Mutex m_poll_mutex;
+
+    /// A stop event waiting to be delivered.
+    struct PendingStopEvent {
+      OutputStreamPtr stream;
+      StopEvent::Reason reason;
+    };
+
+    enum { EVENT_QUEUE_SIZE = 1024 };
+    LockFreeQueue<PendingStopEvent> m_events;
+
+    // Where events go when the queue is full.  Events from one thread
+    // stay in order, but an event that lands here can be delivered after
+    // a later one from another thread that found room in the queue.
+    Mutex m_overflow_mutex;
+    std::vector<PendingStopEvent> m_overflow;
+    volatile long m_overflowed;
+
+    // Nonzero while the event thread has been woken but hasn't started
+    // taking events, so a batch of events wakes it only once.
+    volatile long m_wake_pending;
+    Semaphore m_events_available;
 
     std::vector<CallbackPtr> m_callbacks;
   };
 
+
+  /**
+   * Returns the AbstractDevice behind a device OpenDevice returned, or 0
+   * if the device was implemented somewhere else.
+   */
+  AbstractDevice* GetAbstractDevice(AudioDevice* device);
+
 }
 
 
@@ -8,6 +8,12 @@
 #include "utility.h"
 
 
+// mmreg.h isn't included by every SDK
+#ifndef WAVE_FORMAT_IEEE_FLOAT
+#define WAVE_FORMAT_IEEE_FLOAT 0x0003
+#endif
+
+
 namespace audiere {
 
   static const int DEFAULT_BUFFER_LENGTH = 1000;  // one second
@@ -196,7 +202,8 @@ namespace audiere {
     // define the wave format
     WAVEFORMATEX wfx;
     memset(&wfx, 0, sizeof(wfx));
-    wfx.wFormatTag      = WAVE_FORMAT_PCM;
+    wfx.wFormatTag      = (sample_format == SF_F32 ?
+                           WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM);
     wfx.nChannels       = channel_count;
     wfx.nSamplesPerSec  = sample_rate;
     wfx.nAvgBytesPerSec = sample_rate * frame_size;
@@ -246,7 +253,8 @@ namespace audiere {
 
     WAVEFORMATEX wfx;
     memset(&wfx, 0, sizeof(wfx));
-    wfx.wFormatTag      = WAVE_FORMAT_PCM;
+    wfx.wFormatTag      = (sample_format == SF_F32 ?
+                           WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM);
     wfx.nChannels       = channel_count;
     wfx.nSamplesPerSec  = sample_rate;
     wfx.nAvgBytesPerSec = sample_rate * frame_size;
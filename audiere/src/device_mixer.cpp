@@ -33,6 +33,12 @@ namespace audiere {
   }
 
 
+  OutputStream*
+  MixerDevice::openSampleBuffer(SampleBuffer* buffer) {
+    return openStream(buffer->openStream());
+  }
+
+
   int
   MixerDevice::read(const int sample_count, void* samples) {
 //    ADR_GUARD("MixerDevice::read");
@@ -61,31 +67,27 @@ namespace audiere {
     // buffer in which to mix the audio
     static const int BUFFER_SIZE = 4096;
 
-    // mix the output in chunks of BUFFER_SIZE samples
+    // mix the output in chunks of BUFFER_SIZE frames
     s16* out = (s16*)samples;
     int left = sample_count;
     while (left > 0) {
       int to_mix = std::min(BUFFER_SIZE, left);
 
-      s32 mix_buffer[BUFFER_SIZE];
-      memset(mix_buffer, 0, sizeof(mix_buffer));
+      int mix_buffer[BUFFER_SIZE * 2];
+      memset(mix_buffer, 0, to_mix * 2 * sizeof(int));
     
       for (std::list<MixerStream*>::iterator s = m_streams.begin();
            s != m_streams.end();
            ++s)
       {
         if ((*s)->m_is_playing) {
-          s16 stream_buffer[BUFFER_SIZE * 2];
-          (*s)->read(to_mix, stream_buffer);
-          for (int i = 0; i < to_mix * 2; ++i) {
-            mix_buffer[i] += stream_buffer[i];
-          }
+          (*s)->mix(to_mix, mix_buffer);
         }
       }
 
       // clamp each value in the buffer to the valid s16 range
       for (int i = 0; i < to_mix * 2; ++i) {
-        s32 mixed = mix_buffer[i];
+        int mixed = mix_buffer[i];
         if (mixed < -32768) {
           mixed = -32768;
         } else if (mixed > 32767) {
@@ -241,9 +243,23 @@ namespace audiere {
 
 
   void
-  MixerStream::read(int frame_count, s16* buffer) {
-    unsigned read = m_source->read(frame_count, buffer);
-    s16* out = buffer;
+  MixerStream::mix(int frame_count, int* mix_buffer) {
+    // do panning and volume normalization
+    int l_volume, r_volume;
+    if (m_pan < 0) {
+      l_volume = 255;
+      r_volume = 255 + m_pan;
+    } else {
+      l_volume = 255 - m_pan;
+      r_volume = 255;
+    }
+
+    l_volume *= m_volume;
+    r_volume *= m_volume;
+
+    // Resample, clip, scale, and add into the mix buffer in one pass.
+    MixStage stage(mix_buffer, l_volume, r_volume);
+    unsigned read = m_source->pull(frame_count, stage);
 
     // if we are done with the sample source, stop and reset it
     if (read == 0) {
@@ -255,26 +271,6 @@ namespace audiere {
       } else {
         m_is_playing = false;
       }
-    } else {
-      // do panning and volume normalization
-      int l_volume, r_volume;
-      if (m_pan < 0) {
-        l_volume = 255;
-        r_volume = 255 + m_pan;
-      } else {
-        l_volume = 255 - m_pan;
-        r_volume = 255;
-      }
-
-      l_volume *= m_volume;
-      r_volume *= m_volume;
-
-      for (unsigned i = 0; i < read; ++i) {
-        *out = *out * l_volume / 255 / 255;
-        ++out;
-        *out = *out * r_volume / 255 / 255;
-        ++out;
-      }
     }
 
     // if we ready any frames, we can replace the old values
@@ -282,14 +278,15 @@ namespace audiere {
     int new_l = m_last_l;
     int new_r = m_last_r;
     if (read > 0) {
-      new_l = out[-2];
-      new_r = out[-1];
+      new_l = stage.getLastLeft();
+      new_r = stage.getLastRight();
     }
 
     // and apply the last state to the rest of the buffer
+    int* out = mix_buffer + read * 2;
     for (int i = read; i < frame_count; ++i) {
-      *out++ = m_last_l;
-      *out++ = m_last_r;
+      *out++ += m_last_l;
+      *out++ += m_last_r;
     }
 
     m_last_l = new_l;
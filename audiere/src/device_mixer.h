@@ -38,6 +38,8 @@ namespace audiere {
       int sample_rate,
       SampleFormat sample_format);
 
+    OutputStream* openSampleBuffer(SampleBuffer* buffer);
+
   protected:
     int read(int sample_count, void* samples);
 
@@ -74,7 +76,8 @@ namespace audiere {
     int  ADR_CALL getPosition();
 
   private:
-    void read(int frame_count, s16* buffer);
+    /// Adds frame_count frames to an interleaved stereo mix buffer.
+    void mix(int frame_count, int* mix_buffer);
 
   private:
     RefPtr<MixerDevice> m_device;
@@ -74,6 +74,13 @@ namespace audiere {
   }
 
 
+  OutputStream*
+  NullAudioDevice::openSampleBuffer(SampleBuffer* buffer) {
+    RefPtr<SampleSource> source(buffer->openStream());
+    return openStream(source.get());
+  }
+
+
   const char*
   NullAudioDevice::getName() {
     return "null";
@@ -29,6 +29,7 @@ namespace audiere {
     OutputStream* ADR_CALL openBuffer(
       void* samples, int frame_count,
       int channel_count, int sample_rate, SampleFormat sample_format);
+    OutputStream* openSampleBuffer(SampleBuffer* buffer);
     const char* ADR_CALL getName();
 
   private:
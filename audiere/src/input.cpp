@@ -1,7 +1,9 @@
+#include <ctype.h>
 #include <memory>
 #include <string.h>
 #include "debug.h"
 #include "default_file.h"
+#include "input.h"
 #ifndef NO_FLAC
 #include "input_flac.h"
 #endif
@@ -25,6 +27,8 @@
 
 namespace audiere {
 
+  static SampleFormat g_preferred_format = SF_S16;
+
 
   ADR_EXPORT(const char*) AdrGetSupportedFileFormats() {
     return
@@ -66,6 +70,7 @@ namespace audiere {
 #define TRY_SOURCE(source_type) {                             \
   source_type* source = TryInputStream<source_type>(file);    \
   if (source) {                                               \
+    source->setOrigin(file.get(), file_format);               \
     return source;                                            \
   } else {                                                    \
     file->seek(0, File::BEGIN);                               \
@@ -116,13 +121,120 @@ namespace audiere {
   }
 
 
+  static bool IsMPEGAudioHeader(const u8* b) {
+    return (b[0] == 0xFF && (b[1] & 0xE0) == 0xE0 &&  // frame sync
+            ((b[1] >> 3) & 3) != 1 &&                 // MPEG version
+            ((b[1] >> 1) & 3) != 0 &&                 // layer
+            (b[2] >> 4) != 15 &&                      // bitrate index
+            ((b[2] >> 2) & 3) != 3);                  // sample rate index
+  }
+
+
+  static bool IsMODSignature(const u8* b) {
+    static const char* signatures[] = {
+      "M.K.", "M!K!", "M&K!", "FLT4", "FLT8", "CD81", "OKTA", "OCTA",
+    };
+    for (unsigned i = 0; i < sizeof(signatures) / sizeof(*signatures); ++i) {
+      if (memcmp(b, signatures[i], 4) == 0) {
+        return true;
+      }
+    }
+
+    // xCHN and xxCH, where x is a digit
+    return (isdigit(b[0]) && memcmp(b + 1, "CHN", 3) == 0) ||
+           (isdigit(b[0]) && isdigit(b[1]) && memcmp(b + 2, "CH", 2) == 0);
+  }
+
+
   /**
-   * The internal implementation of OpenSampleSource.
+   * Identifies the format of a file from the signature bytes at its
+   * beginning, so autodetection can go straight to the right decoder
+   * instead of initializing each one in turn.  The file position is
+   * undefined afterwards.
    *
-   * @param file         the file to load from.  cannot be 0.
-   * @param filename     the name of the file, or 0 if it is not available
-   * @param file_format  the format of the file or FF_AUTODETECT
+   * @return  the detected format, or FF_AUTODETECT if the header does not
+   *          contain a known signature
    */
+  FileFormat SniffFormat(const FilePtr& file) {
+    ADR_GUARD("SniffFormat");
+
+    // large enough to reach the signature in ProTracker MOD files
+    enum { HEADER_SIZE = 1084 };
+    u8 header[HEADER_SIZE];
+    memset(header, 0, HEADER_SIZE);
+
+    if (!file->seek(0, File::BEGIN)) {
+      return FF_AUTODETECT;
+    }
+    int size = file->read(header, HEADER_SIZE);
+
+    // Skip ID3v2 tags so we see what they are prepended to.  This is usually
+    // an MP3 stream, but FLAC files are sometimes tagged this way too.
+    int skipped = 0;
+    while (size >= 10 && memcmp(header, "ID3", 3) == 0) {
+      int tag_length =
+        ((header[6] & 0x7f) << 21) |
+        ((header[7] & 0x7f) << 14) |
+        ((header[8] & 0x7f) << 7) |
+        (header[9] & 0x7f);
+      skipped += 10 + tag_length;
+      memset(header, 0, HEADER_SIZE);
+      if (!file->seek(skipped, File::BEGIN)) {
+        return FF_MP3;
+      }
+      size = file->read(header, HEADER_SIZE);
+      if (size < 4) {
+        return FF_MP3;
+      }
+    }
+
+    if (size < 4) {
+      return FF_AUTODETECT;
+    }
+
+    if (memcmp(header, "RIFF", 4) == 0 && memcmp(header + 8, "WAVE", 4) == 0) {
+      return FF_WAV;
+    }
+
+    if (memcmp(header, "FORM", 4) == 0 &&
+        (memcmp(header + 8, "AIFF", 4) == 0 ||
+         memcmp(header + 8, "AIFC", 4) == 0)) {
+      return FF_AIFF;
+    }
+
+    if (memcmp(header, "fLaC", 4) == 0) {
+      return FF_FLAC;
+    }
+
+    if (memcmp(header, "OggS", 4) == 0) {
+      // the first packet of the first page identifies the codec
+      int packet = 27 + header[26];
+      if (packet + 8 <= size) {
+        if (memcmp(header + packet, "\x01vorbis", 7) == 0) {
+          return FF_OGG;
+        }
+        if (memcmp(header + packet, "Speex   ", 8) == 0) {
+          return FF_SPEEX;
+        }
+      }
+      return FF_AUTODETECT;
+    }
+
+    if (memcmp(header, "IMPM", 4) == 0 ||
+        memcmp(header, "Extended Module:", 16) == 0 ||
+        memcmp(header + 44, "SCRM", 4) == 0 ||
+        (size == HEADER_SIZE && IsMODSignature(header + 1080))) {
+      return FF_MOD;
+    }
+
+    if (IsMPEGAudioHeader(header) || skipped > 0) {
+      return FF_MP3;
+    }
+
+    return FF_AUTODETECT;
+  }
+
+
   SampleSource* OpenSource(
     const FilePtr& file,
     const char* filename,
@@ -132,25 +244,34 @@ namespace audiere {
     ADR_ASSERT(file != 0, "file must not be null");
 
     switch (file_format) {
-      case FF_AUTODETECT:
-        
+      case FF_AUTODETECT: {
         // if filename is available, use it as a hint
+        FileFormat guessed = FF_AUTODETECT;
         if (filename) {
-          FileFormat format = GuessFormat(filename);
-          if (format != FF_AUTODETECT) {
-            TRY_OPEN(format);
+          guessed = GuessFormat(filename);
+          if (guessed != FF_AUTODETECT) {
+            TRY_OPEN(guessed);
           }
         }
 
-        // autodetect otherwise, in decreasing order of possibility of failure
-        TRY_OPEN(FF_AIFF);
-        TRY_OPEN(FF_WAV);
-        TRY_OPEN(FF_OGG);
-        TRY_OPEN(FF_FLAC);
-        TRY_OPEN(FF_SPEEX);
-        TRY_OPEN(FF_MP3);
-        TRY_OPEN(FF_MOD);
+        // otherwise, look at the file's signature
+        FileFormat sniffed = SniffFormat(file);
+        file->seek(0, File::BEGIN);
+        if (sniffed != FF_AUTODETECT && sniffed != guessed) {
+          TRY_OPEN(sniffed);
+        }
+
+        // MP3 streams may start with garbage and old MOD files have no
+        // signature at all, so those are the only formats left to try.
+        // Every other decoder would reject a file without its signature.
+        if (sniffed != FF_MP3 && guessed != FF_MP3) {
+          TRY_OPEN(FF_MP3);
+        }
+        if (sniffed != FF_MOD && guessed != FF_MOD) {
+          TRY_OPEN(FF_MOD);
+        }
         return 0;
+      }
 
 #ifndef NO_DUMB
       case FF_MOD:
@@ -221,4 +342,16 @@ namespace audiere {
     return OpenSource(file, 0, file_format);
   }
 
+
+  SampleFormat GetPreferredSampleFormat() {
+    return g_preferred_format;
+  }
+
+
+  ADR_EXPORT(void) AdrSetPreferredSampleFormat(SampleFormat format) {
+    if (format == SF_S16 || format == SF_F32) {
+      g_preferred_format = format;
+    }
+  }
+
 }
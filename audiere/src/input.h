@@ -0,0 +1,34 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+
+#include "audiere.h"
+
+
+namespace audiere {
+
+  /// Returns the format implied by a filename's extension, if any.
+  FileFormat GuessFormat(const char* filename);
+
+  /// Returns the format implied by the signature at the start of a file.
+  FileFormat SniffFormat(const FilePtr& file);
+
+  /**
+   * The internal implementation of OpenSampleSource.
+   *
+   * @param file         the file to load from.  cannot be 0.
+   * @param filename     the name of the file, or 0 if it is not available
+   * @param file_format  the format of the file or FF_AUTODETECT
+   */
+  SampleSource* OpenSource(
+    const FilePtr& file,
+    const char* filename,
+    FileFormat file_format);
+
+  /// Format set with SetPreferredSampleFormat, SF_S16 by default.
+  SampleFormat GetPreferredSampleFormat();
+
+}
+
+
+#endif
@@ -11,8 +11,62 @@
 
 namespace audiere {
 
-  static inline bool isValidSampleSize(u32 size) {
-    return (size == 8 || size == 16);
+  /// Integer samples of a given size in bits.
+  static bool GetIntegerFormat(
+    int bits, bool is_signed, RawSampleFormat& format)
+  {
+    // samples narrower than their bytes are padded at the bottom
+    switch ((bits + 7) / 8) {
+      case 1:  format = (is_signed ? RSF_S8 : RSF_U8); return true;
+      case 2:  format = RSF_S16; return true;
+      case 3:  format = RSF_S24; return true;
+      case 4:  format = RSF_S32; return true;
+      default: return false;
+    }
+  }
+
+
+  bool GetAIFFRawFormat(
+    const u8* chunk, int size, bool aifc,
+    RawSampleFormat& format, bool& big_endian)
+  {
+    if (size < 18) {
+      return false;
+    }
+    const int bits_per_sample = read16_be(chunk + 6);
+
+    // plain AIFF files only have big endian, signed integers
+    big_endian = true;
+    if (!aifc) {
+      return GetIntegerFormat(bits_per_sample, true, format);
+    }
+    if (size < 22) {
+      return false;
+    }
+
+    const char* type = (const char*)chunk + 18;
+    if (memcmp(type, "NONE", 4) == 0 || memcmp(type, "twos", 4) == 0) {
+      return GetIntegerFormat(bits_per_sample, true, format);
+    } else if (memcmp(type, "sowt", 4) == 0) {
+      big_endian = false;
+      return GetIntegerFormat(bits_per_sample, true, format);
+    } else if (memcmp(type, "raw ", 4) == 0) {
+      return GetIntegerFormat(bits_per_sample, false, format);
+    } else if (memcmp(type, "in24", 4) == 0) {
+      format = RSF_S24;
+      return true;
+    } else if (memcmp(type, "in32", 4) == 0) {
+      format = RSF_S32;
+      return true;
+    } else if (memcmp(type, "fl32", 4) == 0 || memcmp(type, "FL32", 4) == 0) {
+      format = RSF_F32;
+      return true;
+    } else if (memcmp(type, "fl64", 4) == 0 || memcmp(type, "FL64", 4) == 0) {
+      format = RSF_F64;
+      return true;
+    } else {
+      return false;
+    }
   }
 
 
@@ -22,6 +76,9 @@ namespace audiere {
     m_channel_count = 0;
     m_sample_rate   = 0;
     m_sample_format = SF_U8;  // reasonable default?
+    m_raw_format    = RSF_S8;
+    m_big_endian    = true;
+    m_aifc          = false;
 
     m_data_chunk_location = 0;
     m_data_chunk_length   = 0;
@@ -48,12 +105,14 @@ namespace audiere {
 
     if (memcmp(header, "FORM", 4) != 0 ||
         read32_be(header + 4) == 0 ||
-        memcmp(header + 8, "AIFF", 4) != 0)
+        (memcmp(header + 8, "AIFF", 4) != 0 &&
+         memcmp(header + 8, "AIFC", 4) != 0))
     {
       ADR_LOG("Invalid AIFF header");
       m_file = 0;
       return false;
     }
+    m_aifc = (memcmp(header + 8, "AIFC", 4) == 0);
 
     if (findCommonChunk() && findSoundChunk()) {
       return true;
@@ -83,25 +142,12 @@ namespace audiere {
     }
 
     const int frames_to_read = std::min(frame_count, m_frames_left_in_chunk);
-    const int frame_size = m_channel_count * GetSampleSize(m_sample_format);
-    const int bytes_to_read = frames_to_read * frame_size;
-
-    const int read = m_file->read(buffer, bytes_to_read);
-    const int frames_read = read / frame_size;
-
-#ifndef WORDS_BIGENDIAN
-    if (m_sample_format == SF_S16) {
-      // make little endian into host endian
-      u8* out = (u8*)buffer;
-      for (int i = 0; i < frames_read * m_channel_count; ++i) {
-        std::swap(out[0], out[1]);
-        out += 2;
-      }
-    }
-#endif
+    const int frames_read = ReadRawFrames(
+      m_file.get(), m_raw_format, m_big_endian, m_channel_count,
+      m_sample_format, frames_to_read, buffer);
 
     // assume that if we didn't get a full read, we're done
-    if (read != bytes_to_read) {
+    if (frames_read != frames_to_read) {
       m_frames_left_in_chunk = 0;
       return frames_read;
     }
@@ -135,7 +181,7 @@ namespace audiere {
 
   void
   AIFFInputStream::setPosition(int position) {
-    int frame_size = m_channel_count * GetSampleSize(m_sample_format);
+    int frame_size = m_channel_count * GetRawSampleSize(m_raw_format);
     m_frames_left_in_chunk = m_data_chunk_length - position;
     m_file->seek(m_data_chunk_location + position * frame_size, File::BEGIN);
   }
@@ -166,43 +212,36 @@ namespace audiere {
       if (memcmp(chunk_header, "COMM", 4) == 0 && chunk_length >= 18) {
         ADR_LOG("Found common chunk");
 
-        // read common chunk
-        u8 chunk[18];
-        if (m_file->read(chunk, 18) != 18) {
+        // read common chunk, and the compression type if it's AIFF-C
+        u8 chunk[22];
+        const int size = std::min(chunk_length, u32(22));
+        if (m_file->read(chunk, size) != size) {
           return false;
         }
 
-        chunk_length -= 18;
+        chunk_length -= size;
 
         // parse the memory into useful information
         u16 channel_count   = read16_be(chunk + 0);
         //u32 frame_count     = read32_be(chunk + 2);
-        u16 bits_per_sample = read16_be(chunk + 6);
         u32 sample_rate     = readLD_be(chunk + 8);
 
-        // we only support mono and stereo, 8-bit or 16-bit
-        if (channel_count > 2 ||
-            !isValidSampleSize(bits_per_sample)) {
+        // we only support mono and stereo
+        if (channel_count < 1 || channel_count > 2 ||
+            !GetAIFFRawFormat(chunk, size, m_aifc, m_raw_format, m_big_endian))
+        {
           ADR_LOG("Invalid AIFF");
           return false;
         }
 
         // skip the rest of the chunk
-        if (!skipBytes(chunk_length)) {
+        if (!skipChunk(chunk_length)) {
           ADR_LOG("failed skipping rest of common chunk");
           return false;
         }
 
-        // figure out the sample format
-        if (bits_per_sample == 8) {
-          m_sample_format = SF_U8;
-        } else if (bits_per_sample == 16) {
-          m_sample_format = SF_S16;
-        } else {
-          return false;
-        }
-
         // store the other important attributes
+        m_sample_format = GetDecodedSampleFormat(m_raw_format);
         m_channel_count = channel_count;
         m_sample_rate   = sample_rate;
         return true;
@@ -210,7 +249,7 @@ namespace audiere {
       } else {
 
         // skip the rest of the chunk
-        if (!skipBytes(chunk_length)) {
+        if (!skipChunk(chunk_length)) {
           // oops, end of stream
           return false;
         }
@@ -253,10 +292,14 @@ namespace audiere {
         }
 
         // calculate the frame size so we can truncate the data chunk
-        int frame_size = m_channel_count * GetSampleSize(m_sample_format);
+        int frame_size = m_channel_count * GetRawSampleSize(m_raw_format);
 
+        // streamed and truncated files claim more data than they hold
         m_data_chunk_location  = m_file->tell();
-        m_data_chunk_length    = (chunk_length - 8) / frame_size;
+        const u32 data_bytes   = std::min(
+          chunk_length - std::min(chunk_length, u32(8)),
+          u32(GetFileLength(m_file.get()) - m_data_chunk_location));
+        m_data_chunk_length    = int(data_bytes / frame_size);
         m_frames_left_in_chunk = m_data_chunk_length;
         return true;
 
@@ -271,7 +314,7 @@ namespace audiere {
         }
 
         // skip the rest of the chunk
-        if (!skipBytes(chunk_length)) {
+        if (!skipChunk(chunk_length)) {
           // oops, end of stream
           return false;
         }
@@ -281,9 +324,18 @@ namespace audiere {
   }
 
 
+  /**
+   * Skips the rest of a chunk, plus the pad byte after chunks of odd
+   * length.  Fails rather than seek past the end of the file, so a corrupt
+   * length can't send the chunk search backwards or around in circles.
+   */
   bool
-  AIFFInputStream::skipBytes(int size) {
-    return m_file->seek(size, File::CURRENT);
+  AIFFInputStream::skipChunk(u32 size) {
+    const s64 end = s64(m_file->tell()) + size + (size & 1);
+    if (end > GetFileLength(m_file.get())) {
+      return false;
+    }
+    return m_file->seek(int(end), File::BEGIN);
   }
 
 }
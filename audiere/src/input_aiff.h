@@ -4,11 +4,26 @@
 
 #include "audiere.h"
 #include "basic_source.h"
+#include "convert.h"
 #include "types.h"
 
 
 namespace audiere {
 
+  /**
+   * Finds how the samples of an AIFF or AIFF-C file are stored.
+   *
+   * @param chunk  contents of the common chunk
+   * @param size   size of the common chunk
+   * @param aifc   whether the file is AIFF-C, which has a compression type
+   *
+   * @return  false if the samples aren't PCM in a supported size
+   */
+  bool GetAIFFRawFormat(
+    const u8* chunk, int size, bool aifc,
+    RawSampleFormat& format, bool& big_endian);
+
+
   class AIFFInputStream : public BasicSource {
   public:
     AIFFInputStream();
@@ -30,7 +45,7 @@ namespace audiere {
   private:
     bool findCommonChunk();
     bool findSoundChunk();
-    bool skipBytes(int size);
+    bool skipChunk(u32 size);
 
   private:
     FilePtr m_file;
@@ -39,6 +54,9 @@ namespace audiere {
     int m_channel_count;
     int m_sample_rate;
     SampleFormat m_sample_format;
+    RawSampleFormat m_raw_format;  // as stored in the file
+    bool m_big_endian;
+    bool m_aifc;  // whether the form type is AIFC
 
     // from data chunk
     int m_data_chunk_location; // bytes
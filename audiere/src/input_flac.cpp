@@ -2,6 +2,8 @@
     Modified 2009/08/01 to support the new 1.2.1 FLAC library - Jason A. Petrasko
 */
 
+#include "convert.h"
+#include "decoder_pool.h"
 #include "input_flac.h"
 #include "types.h"
 #include "utility.h"
@@ -9,6 +11,10 @@
 
 namespace audiere {
 
+  static DecoderPool<FLAC__StreamDecoder> g_decoder_pool(
+    FLAC__stream_decoder_delete);
+
+
   FLACInputStream::FLACInputStream() {
     m_decoder = 0;
 
@@ -19,14 +25,24 @@ namespace audiere {
     m_length = 0;
     m_position = 0;
 
+    m_direct_buffer = 0;
+    m_direct_frames = 0;
+
     m_decoder_text = "flac:standard";
   }
 
 
   FLACInputStream::~FLACInputStream() {
+    closeDecoder();
+  }
+
+
+  void
+  FLACInputStream::closeDecoder() {
     if (m_decoder) {
+      // a finished decoder can be initialized again for the next stream
       FLAC__stream_decoder_finish(m_decoder);
-      FLAC__stream_decoder_delete(m_decoder);
+      g_decoder_pool.release(m_decoder);
       m_decoder = 0;
     }
   }
@@ -37,7 +53,10 @@ namespace audiere {
     m_file = file;
 
     // initialize the decoder
-    m_decoder = FLAC__stream_decoder_new();
+    m_decoder = g_decoder_pool.acquire();
+    if (!m_decoder) {
+      m_decoder = FLAC__stream_decoder_new();
+    }
     if (!m_decoder) {
       m_file = 0;
       return false;
@@ -56,27 +75,21 @@ namespace audiere {
         error_callback,
         this);
     if (state != FLAC__STREAM_DECODER_INIT_STATUS_OK) {
-      FLAC__stream_decoder_finish(m_decoder);
-      FLAC__stream_decoder_delete(m_decoder);
-      m_decoder = 0;
+      closeDecoder();
       m_file = 0;
       return false;
     }
 
     // make sure we have metadata before we return!
     if (!FLAC__stream_decoder_process_until_end_of_metadata(m_decoder)) {
-      FLAC__stream_decoder_finish(m_decoder);
-      FLAC__stream_decoder_delete(m_decoder);
-      m_decoder = 0;
+      closeDecoder();
       m_file = 0;
       return false;
     }
 
     // process one frame so we can do something!
     if (!FLAC__stream_decoder_process_single(m_decoder)) {
-      FLAC__stream_decoder_finish(m_decoder);
-      FLAC__stream_decoder_delete(m_decoder);
-      m_decoder = 0;
+      closeDecoder();
       m_file = 0;
       return false;
     }
@@ -114,30 +127,27 @@ namespace audiere {
     const int frame_size = m_channel_count * GetSampleSize(m_sample_format);
     u8* out = (u8*)samples;
 
-    // we keep reading till we finish topping up!
-    int frames_read = 0;
-    while (frames_read < frame_count) {
+    // first hand out whatever the last block left over
+    int frames_read = m_buffer.read(out, frame_count * frame_size) / frame_size;
+    out += frames_read * frame_size;
 
-      // if the buffer is empty, ask FLAC to fill it p
-      if (m_buffer.getSize() < frame_size) {
-        if (!FLAC__stream_decoder_process_single(m_decoder)) {
-          return frames_read;
-        }
-
-        // if the buffer still has a size of 0, we are probably at the
-        // end of the stream
-        if (m_buffer.getSize() < frame_size) {
-          return frames_read;
-        }
+    // then have FLAC decode straight into the caller's buffer, queueing
+    // only what doesn't fit
+    while (frames_read < frame_count) {
+      m_direct_buffer = out;
+      m_direct_frames = frame_count - frames_read;
+      const bool decoded = (FLAC__stream_decoder_process_single(m_decoder) != 0);
+      const int written = (frame_count - frames_read) - m_direct_frames;
+      m_direct_buffer = 0;
+      m_direct_frames = 0;
+
+      out += written * frame_size;
+      frames_read += written;
+
+      // if nothing came out, we are probably at the end of the stream
+      if (!decoded || written == 0) {
+        break;
       }
-
-      // read what we've got!
-      const int to_read = std::min(
-        frame_count - frames_read,
-        m_buffer.getSize() / frame_size);
-      m_buffer.read(out, to_read * frame_size);
-      out += to_read * frame_size;
-      frames_read += to_read;
     }
 
     return frames_read;
@@ -146,10 +156,7 @@ namespace audiere {
 
   void
   FLACInputStream::reset() {
-    m_file->seek(0, File::BEGIN);
-    FLAC__stream_decoder_seek_absolute(m_decoder, 0);
-    m_position = 0;
-    m_buffer.clear();
+    setPosition(0);
   }
 
 
@@ -167,8 +174,13 @@ namespace audiere {
 
   void
   FLACInputStream::setPosition(int position) {
-    if (FLAC__stream_decoder_seek_absolute(m_decoder, position)) {
-      m_position = position;
+    // The decoder hands us the rest of the target block while seeking, so
+    // the queue has to be empty and m_position already updated.
+    const int old_position = m_position;
+    m_buffer.clear();
+    m_position = position;
+    if (!FLAC__stream_decoder_seek_absolute(m_decoder, position)) {
+      m_position = old_position;
     }
   }
 
@@ -180,6 +192,26 @@ namespace audiere {
   }
 
 
+  /// Interleaves samples [begin, end) of each channel into 'out'.
+  static void Interleave(
+    u8* out,
+    const FLAC__int32* const buffer[],
+    int channel_count,
+    int bytes_per_sample,
+    int begin,
+    int end)
+  {
+    // FLAC__int32 is an int everywhere audiere builds
+    const int* channels[FLAC__MAX_CHANNELS];
+    for (int c = 0; c < channel_count; ++c) {
+      channels[c] = (const int*)(buffer[c] + begin);
+    }
+    InterleaveIntegers(
+      channels, channel_count, bytes_per_sample * 8, out,
+      (bytes_per_sample == 1 ? SF_U8 : SF_S16), end - begin);
+  }
+
+
   FLAC__StreamDecoderWriteStatus
   FLACInputStream::write(
     const FLAC__Frame* frame,
@@ -188,31 +220,46 @@ namespace audiere {
     int channel_count = frame->header.channels;
     int samples_per_channel = frame->header.blocksize;
     int bytes_per_sample = frame->header.bits_per_sample / 8;
-    int total_size = channel_count * samples_per_channel * bytes_per_sample;
-
-    m_multiplexer.ensureSize(total_size);
-
-    // do the multiplexing/interleaving
-    if (bytes_per_sample == 1) {
-      u8* out = (u8*)m_multiplexer.get();
-      for (int s = 0; s < samples_per_channel; ++s) {
-        for (int c = 0; c < channel_count; ++c) {
-          // is this right?
-          *out++ = (u8)buffer[c][s];
-        }
+    int frame_size = channel_count * bytes_per_sample;
+
+    if (bytes_per_sample != 1 && bytes_per_sample != 2) {
+      return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
+    }
+
+    // as much as possible goes straight into doRead's output buffer
+    int direct = std::min(samples_per_channel, m_direct_frames);
+    if (direct > 0) {
+      Interleave(m_direct_buffer, buffer, channel_count, bytes_per_sample,
+                 0, direct);
+      m_direct_buffer += direct * frame_size;
+      m_direct_frames -= direct;
+    }
+
+    // the rest is queued for later reads
+    int queued = samples_per_channel - direct;
+    if (queued > 0) {
+      int queued_size = queued * frame_size;
+
+      // Interleave straight into the sample queue if the samples fit
+      // before its wrap point, otherwise go through the multiplexing buffer.
+      m_buffer.reserve(queued_size);
+      u8* target;
+      const bool contiguous = (m_buffer.getWriteSpan(target) >= queued_size);
+      if (!contiguous) {
+        m_multiplexer.ensureSize(queued_size);
+        target = (u8*)m_multiplexer.get();
       }
-    } else if (bytes_per_sample == 2) {
-      s16* out = (s16*)m_multiplexer.get();
-      for (int s = 0; s < samples_per_channel; ++s) {
-        for (int c = 0; c < channel_count; ++c) {
-          *out++ = (s16)buffer[c][s];
-        }
+
+      Interleave(target, buffer, channel_count, bytes_per_sample,
+                 direct, samples_per_channel);
+
+      if (contiguous) {
+        m_buffer.commit(queued_size);
+      } else {
+        m_buffer.write(target, queued_size);
       }
-    } else {
-      return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
     }
 
-    m_buffer.write(m_multiplexer.get(), total_size);
     m_position += samples_per_channel;
     return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
   }
@@ -221,7 +268,7 @@ namespace audiere {
   FLAC__StreamDecoderReadStatus FLACInputStream::read_callback(
     const FLAC__StreamDecoder* decoder,
     FLAC__byte buffer[],
-    unsigned *bytes,
+    size_t* bytes,
     void* client_data)
   {
     *bytes = getFile(client_data)->read(buffer, *bytes);
@@ -68,6 +68,8 @@ namespace audiere {
       FLAC__StreamDecoderErrorStatus status,
       void* client_data);
 
+    void closeDecoder();
+
     static FLACInputStream* getStream(void* client_data);
     static File* getFile(void* client_data);
 
@@ -87,7 +89,15 @@ namespace audiere {
      * this stores a queue of sample data coming from FLAC and being read by
      * the client of the stream
      */
-    QueueBuffer m_buffer;
+    RingBuffer m_buffer;
+
+    /**
+     * While doRead is waiting on the decoder, this is where its output
+     * goes and how many frames still fit there.  Only what doesn't fit
+     * ends up in m_buffer.
+     */
+    u8* m_direct_buffer;
+    int m_direct_frames;
 
     int m_channel_count;
     int m_sample_rate;
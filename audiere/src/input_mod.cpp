@@ -1,6 +1,8 @@
 #include <stdlib.h>
+#include "convert.h"
 #include "input_mod.h"
 #include "debug.h"
+#include "utility.h"
 
 
 namespace audiere {
@@ -8,6 +10,7 @@ namespace audiere {
   MODInputStream::MODInputStream() {
     m_duh = 0;
     m_renderer = 0;
+    m_samples = 0;
   }
 
 
@@ -21,6 +24,11 @@ namespace audiere {
       unload_duh(m_duh);
       m_duh = 0;
     }
+
+    if (m_samples) {
+      destroy_sample_buffer(m_samples);
+      m_samples = 0;
+    }
   }
 
 
@@ -65,6 +73,11 @@ namespace audiere {
     DUMB_IT_SIGRENDERER* renderer = duh_get_it_sigrenderer(m_renderer);
     dumb_it_set_loop_callback(renderer, &MODInputStream::loopCallback, this);
 
+    m_samples = create_sample_buffer(2, RENDER_SIZE);
+    if (!m_samples) {
+      return false;
+    }
+
     return true;
   }
 
@@ -99,8 +112,24 @@ namespace audiere {
   
   int
   MODInputStream::doRead(int frame_count, void* buffer) {
-    return duh_render(m_renderer, 16, 0, 1.0f, 65536.0f / 44100,
-                      frame_count, buffer);
+    // DUMB renders separate channels of 24-bit samples
+    s16* out = (s16*)buffer;
+    int frames_read = 0;
+    while (frames_read < frame_count) {
+      const int to_render = std::min(frame_count - frames_read,
+                                     int(RENDER_SIZE));
+      dumb_silence(m_samples[0], 2 * RENDER_SIZE);
+      const int rendered = duh_sigrenderer_get_samples(
+        m_renderer, 1.0f, 65536.0f / 44100, to_render, m_samples);
+      InterleaveIntegers(m_samples, 2, 24, out, SF_S16, rendered);
+
+      out         += rendered * 2;
+      frames_read += rendered;
+      if (rendered < to_render) {
+        break;
+      }
+    }
+    return frames_read;
   }
 
 
@@ -37,9 +37,12 @@ namespace audiere {
     static int loopCallback(void* ptr);
 
   private:
+    enum { RENDER_SIZE = 1024 };  // frames rendered at a time
+
     FilePtr          m_file;
     DUH*             m_duh;
     DUH_SIGRENDERER* m_renderer;
+    sample_t**       m_samples;   // RENDER_SIZE frames of each channel
   };
 
 }
@@ -7,7 +7,12 @@
 #ifndef NO_MPAUDEC
 
 #include <string.h>
+#include "cpu.h"
+#include "decoder_pool.h"
+#include "input.h"
 #include "input_mp3.h"
+#include "mp3_info.h"
+#include "seek_cache.h"
 #include "utility.h"
 #include "debug.h"
 
@@ -16,13 +21,49 @@ namespace audiere {
   static const int ID3v2_HEADER_SIZE = 10;
 
 
+  /// Everything a stream needs to decode, so it can be pooled.
+  struct MP3Decoder {
+    MPAuDecContext context;
+    u8 output[MPAUDEC_MAX_FLOAT_FRAME_SIZE];
+  };
+
+  /// Returns the best mpaudec kernels the current SIMD level allows.
+  static int GetDecoderSIMDLimit() {
+    switch (GetSIMDLevel()) {
+      case SIMD_AVX2:  return MPAUDEC_SIMD_AVX2;
+      case SIMD_SSE41:
+      case SIMD_SSE2:  return MPAUDEC_SIMD_SSE2;
+      default:         return MPAUDEC_SIMD_NONE;
+    }
+  }
+
+  static SIMDLevel GetDecoderLevel() {
+    switch (std::min(mpaudec_simd_support(), GetDecoderSIMDLimit())) {
+      case MPAUDEC_SIMD_AVX2: return SIMD_AVX2;
+      case MPAUDEC_SIMD_SSE2: return SIMD_SSE2;
+      default:                return SIMD_NONE;
+    }
+  }
+
+  static KernelRegistration g_registration("mpaudec", GetDecoderLevel);
+
+
+  static void DestroyDecoder(MP3Decoder* decoder) {
+    mpaudec_clear(&decoder->context);
+    delete decoder;
+  }
+
+  static DecoderPool<MP3Decoder> g_decoder_pool(DestroyDecoder);
+
+
   MP3InputStream::MP3InputStream() {
     m_eof = false;
 
     m_channel_count = 2;
     m_sample_rate = 44100;
-    m_sample_format = SF_S16;
+    m_sample_format = GetPreferredSampleFormat();
 
+    m_decoder = 0;
     m_context = 0;
 
     m_input_position = 0;
@@ -33,14 +74,20 @@ namespace audiere {
     m_seekable = false;
     m_length = 0;
     m_position = 0;
+
+    m_indexed_length = 0;
+    m_index_complete = false;
+    m_index_unsaved = false;
+    m_next_frame = 0;
   }
 
 
   MP3InputStream::~MP3InputStream() {
-    delete[] m_decode_buffer;
-    if (m_context) {
-      mpaudec_clear(m_context);
-      delete m_context;
+    if (m_index_unsaved) {
+      saveIndex();
+    }
+    if (m_decoder) {
+      g_decoder_pool.release(m_decoder);
     }
   }
 
@@ -49,41 +96,42 @@ namespace audiere {
   MP3InputStream::initialize(FilePtr file) {
     m_file = file;
     m_seekable = m_file->seek(0, File::END);
-    readID3v1Tags();
+    int file_length = m_file->tell();
+    if (readID3v1Tags()) {
+      file_length -= 128;
+    }
     readID3v2Tags();
     m_file->seek(0, File::BEGIN);
     m_eof = false;
 
-    m_context = new MPAuDecContext;
-    if (!m_context)
-      return false;
-    if (mpaudec_init(m_context) < 0) {
-      delete m_context;
-      m_context = 0;
-      return false;
+    m_decoder = g_decoder_pool.acquire();
+    if (m_decoder) {
+      mpaudec_reset(&m_decoder->context);
+    } else {
+      m_decoder = new MP3Decoder;
+      if (mpaudec_init(&m_decoder->context) < 0) {
+        delete m_decoder;
+        m_decoder = 0;
+        return false;
+      }
     }
+    m_context = &m_decoder->context;
+    mpaudec_select_simd(m_context, GetDecoderSIMDLimit());
+    m_decode_buffer = m_decoder->output;
 
     m_input_position = 0;
     m_input_length = 0;
-    m_decode_buffer = new u8[MPAUDEC_MAX_AUDIO_FRAME_SIZE];
-    if (!m_decode_buffer)
-        return false;
     m_first_frame = true;
 
-    if (m_seekable) {
-      // Scan the file to determine the length.
+    if (m_seekable && !loadIndex()) {
+      // Scanning the whole file for its length is far too slow for long
+      // streams, so look at the first frame for a VBR header instead, or
+      // estimate the length from the bitrate.
       m_context->parse_only = 1;
-      while (!m_eof) {
-        if (!decodeFrame())
-          return false;
-        if (!m_eof)
-          m_frame_sizes.push_back(m_context->frame_size);
-          int frame_offset = m_file->tell() -
-                             (m_input_length - m_input_position) -
-                             m_context->coded_frame_size;
-          m_frame_offsets.push_back(frame_offset);
-          m_length += m_context->frame_size;
-      }
+      if (!decodeFrame())
+        return false;
+      if (!m_eof)
+        readVBRHeader(file_length);
       reset();
     }
 
@@ -103,40 +151,53 @@ namespace audiere {
 
   void
   MP3InputStream::setPosition(int position) {
-    if (!m_seekable || position > m_length)
+    if (!m_seekable || position < 0)
       return;
-    int scan_position = 0;
-    int target_frame = 0;
-    int frame_count = m_frame_sizes.size();
-    while (target_frame < frame_count) {
-      int frame_size = m_frame_sizes[target_frame];
-      if (position <= scan_position + frame_size)
-        break;
-      else {
-        scan_position += frame_size;
-        target_frame++;
-      }
-    }
+    if (!m_index_complete && position >= m_indexed_length)
+      extendIndex(position);
+    if (position > m_length || m_frame_offsets.empty())
+      return;
+    int target_frame = std::upper_bound(
+      m_frame_starts.begin(), m_frame_starts.end(), position) -
+      m_frame_starts.begin() - 1;
     // foobar2000's MP3 input plugin decodes and throws away the 10 frames
     // before the target frame whenever possible, presumably to ensure correct
-    // output when jumping into the middle of a stream.  So we'll do that here.
+    // output when jumping into the middle of a stream.  So we'll do that here,
+    // except that only the last two need their samples.  The synthesis filter
+    // and the layer 3 overlap reach no further back, so the others are only
+    // parsed to fill the bit reservoir.
     const int MAX_FRAME_DEPENDENCY = 10;
-    target_frame = std::max(0, target_frame - MAX_FRAME_DEPENDENCY);
+    const int SYNTHESIS_DEPENDENCY = 2;
+    const int first_frame = std::max(0, target_frame - MAX_FRAME_DEPENDENCY);
+    const int decode_frame = std::max(0, target_frame - SYNTHESIS_DEPENDENCY);
     reset();
-    m_file->seek(m_frame_offsets[target_frame], File::BEGIN);
-    int i;
-    for (i = 0; i < target_frame; i++) {
-      m_position += m_frame_sizes[i];
-    }
-    if (!decodeFrame() || m_eof) {
-      reset();
-      return;
+    m_file->seek(m_frame_offsets[first_frame], File::BEGIN);
+    m_next_frame = first_frame;
+
+    m_context->skip_output = 1;
+    while (m_next_frame < decode_frame) {
+      if (!decodeFrame() || m_eof) {
+        reset();
+        return;
+      }
     }
-    int frames_to_consume = position - m_position; // PCM frames now
-    if (frames_to_consume > 0) {
-      u8 *buf = new u8[frames_to_consume * GetFrameSize(this)];
-      doRead(frames_to_consume, buf);
-      delete[] buf;
+    m_context->skip_output = 0;
+    m_position = m_frame_starts[m_next_frame];
+
+    // decode the pre-roll frames and throw away their samples
+    const int frame_size = GetFrameSize(this);
+    while (m_position < position) {
+      if (m_buffer.getSize() < frame_size) {
+        if (!decodeFrame() || m_eof || m_buffer.getSize() < frame_size) {
+          reset();
+          return;
+        }
+      }
+      const int frames_to_discard = std::min(
+        position - m_position,
+        m_buffer.getSize() / frame_size);
+      m_buffer.discard(frames_to_discard * frame_size);
+      m_position += frames_to_discard;
     }
   }
 
@@ -205,26 +266,155 @@ namespace audiere {
 
     m_buffer.clear();
 
-    mpaudec_clear(m_context);
-    mpaudec_init(m_context);
+    mpaudec_reset(m_context);
+    mpaudec_select_simd(m_context, GetDecoderSIMDLimit());
 
     m_input_position = 0;
     m_input_length = 0;
     m_position = 0;
     m_first_frame = true;
+    m_next_frame = 0;
+  }
+
+
+  /**
+   * Reads the Xing/Info or VBRI header that encoders put in the first
+   * frame of a stream, which holds the total number of frames.  Without
+   * one, the stream is assumed to be CBR and the length is computed from
+   * the bitrate.  The frame holding the header decodes to silence, so it
+   * is counted as part of the stream.
+   *
+   * The result is only an estimate until the index is complete, so code
+   * that loads the whole stream must read until read() returns 0 instead
+   * of sizing its buffer by getLength().
+   */
+  void
+  MP3InputStream::readVBRHeader(int file_length) {
+    const u8* frame = *(u8**)m_decode_buffer;
+    int frame_count = GetVBRFrameCount(frame, m_context->coded_frame_size);
+    if (frame_count >= 0) {
+      m_length = frame_count * m_context->frame_size;
+    } else if (m_context->bit_rate > 0) {
+      double audio_bytes = file_length - m_frame_offsets[0];
+      m_length = int(audio_bytes * 8 * m_sample_rate / m_context->bit_rate);
+    }
+  }
+
+
+  /**
+   * Scans frame headers past the end of the index until it covers
+   * 'position' or reaches the end of the stream.  Leaves the stream in an
+   * undefined state, so it must be followed by a seek.
+   */
+  void
+  MP3InputStream::extendIndex(int position) {
+    ADR_GUARD("MP3InputStream::extendIndex");
+
+    reset();
+    m_context->parse_only = 1;
+
+    // the decoder needs to sync on the last frame we know of
+    if (!m_frame_offsets.empty()) {
+      m_next_frame = m_frame_offsets.size() - 1;
+      m_file->seek(m_frame_offsets[m_next_frame], File::BEGIN);
+    }
+
+    while (!m_index_complete && m_indexed_length <= position) {
+      if (!decodeFrame() || m_eof) {
+        break;
+      }
+    }
+
+    m_length = std::max(m_length, m_indexed_length);
+  }
+
+
+  /**
+   * Called when the decoder runs out of data.  If we got here by decoding
+   * every frame since the end of the index, the index now covers the
+   * whole stream and the length is known exactly.
+   */
+  bool
+  MP3InputStream::endOfStream() {
+    m_eof = true;
+    if (!m_index_complete && m_next_frame == int(m_frame_starts.size())) {
+      m_index_complete = true;
+      m_length = m_indexed_length;
+      m_index_unsaved = true;
+    }
+    return true;
+  }
+
+
+  /// Fills in the complete frame index from the seek cache, if possible.
+  bool
+  MP3InputStream::loadIndex() {
+    SeekIndex index;
+    if (!LoadSeekIndex(m_file.get(), "mp3", index, IsMPEGFrameAt) ||
+        index.points.empty())
+    {
+      return false;
+    }
+
+    m_frame_starts.resize(index.points.size());
+    m_frame_offsets.resize(index.points.size());
+    for (size_t i = 0; i < index.points.size(); ++i) {
+      m_frame_starts[i]  = int(index.points[i].position);
+      m_frame_offsets[i] = int(index.points[i].offset);
+    }
+    m_indexed_length = int(index.length);
+    m_length = m_indexed_length;
+    m_index_complete = true;
+    return true;
+  }
+
+
+  void
+  MP3InputStream::saveIndex() {
+    // don't litter the cache with entries for files that weren't MP3s
+    if (m_frame_starts.empty()) {
+      return;
+    }
+
+    SeekIndex index;
+    index.length = m_indexed_length;
+    index.points.resize(m_frame_starts.size());
+    for (size_t i = 0; i < m_frame_starts.size(); ++i) {
+      index.points[i].position = m_frame_starts[i];
+      index.points[i].offset   = m_frame_offsets[i];
+    }
+    SaveSeekIndex(m_file.get(), "mp3", index);
   }
 
 
   bool
   MP3InputStream::decodeFrame() {
+    // mpaudec_reset clears float_output, so set it every time
+    m_context->float_output = (m_sample_format == SF_F32);
+    const int max_output_size = (m_context->float_output ?
+                                 MPAUDEC_MAX_FLOAT_FRAME_SIZE :
+                                 MPAUDEC_MAX_AUDIO_FRAME_SIZE);
+
+    // Decode straight into the sample queue when it has a contiguous run
+    // big enough for any frame, which is nearly always since it is only
+    // refilled once it has been drained.
+    u8* output = m_decode_buffer;
+    const bool keep_output = !m_context->parse_only && !m_context->skip_output;
+    if (keep_output) {
+      m_buffer.reserve(max_output_size);
+      u8* span;
+      if (m_buffer.getWriteSpan(span) >= max_output_size) {
+        output = span;
+      }
+    }
+
     int output_size = 0;
     while (output_size == 0) {
       if (m_input_position == m_input_length) {
         m_input_position = 0;
         m_input_length = m_file->read(m_input_buffer, INPUT_BUFFER_SIZE);
         if (m_input_length == 0) {
-          m_eof = true;
-          return true;
+          return endOfStream();
         }
       }
 
@@ -244,15 +434,14 @@ namespace audiere {
 	      m_input_length = m_file->read(m_input_buffer,
 					    INPUT_BUFFER_SIZE);
 	      if (m_input_length == 0) {
-		  m_eof = true;
-		  return true;
+		  return endOfStream();
 	      }
           }
           m_input_position += len;
       }
 
       int rv = mpaudec_decode_frame(
-          m_context, (s16*)m_decode_buffer,
+          m_context, output,
           &output_size,
           (unsigned char*)m_input_buffer + m_input_position,
           m_input_length - m_input_position);
@@ -265,8 +454,7 @@ namespace audiere {
                                                INPUT_BUFFER_SIZE - left);
           m_input_position = 0;
         } else {
-          m_eof = true;
-          return true;
+          return endOfStream();
         }
       } else {
         m_input_position += rv;
@@ -275,7 +463,6 @@ namespace audiere {
     if (m_first_frame) {
       m_channel_count = m_context->channels;
       m_sample_rate = m_context->sample_rate;
-      m_sample_format = SF_S16;
       m_first_frame = false;
     }
     if (m_context->channels != m_channel_count ||
@@ -283,111 +470,44 @@ namespace audiere {
       // Can't handle format changes mid-stream.
       return false;
     }
-    if (!m_context->parse_only) {
+
+    // add the frame to the index if it's the first time we see it
+    if (m_next_frame == int(m_frame_starts.size())) {
+      int frame_offset = m_file->tell() -
+                         (m_input_length - m_input_position) -
+                         m_context->coded_frame_size;
+      m_frame_starts.push_back(m_indexed_length);
+      m_frame_offsets.push_back(frame_offset);
+      m_indexed_length += m_context->frame_size;
+    }
+    ++m_next_frame;
+    if (keep_output) {
       if (output_size < 0) {
         // Couldn't decode this frame.  Too bad, already lost it.
         // This should only happen when seeking.
-        output_size = m_context->frame_size;
-        memset(m_decode_buffer, 0, output_size * GetFrameSize(this));
+        output_size = m_context->frame_size * GetFrameSize(this);
+        memset(output, 0, output_size);
+      }
+      if (output == m_decode_buffer) {
+        m_buffer.write(m_decode_buffer, output_size);
+      } else {
+        m_buffer.commit(output_size);
       }
-      m_buffer.write(m_decode_buffer, output_size);
     }
     return true;
   }
 
 
-  const char* getGenre(u8 code) {
-    const char* genres[] = {
-      // From Appendix A.3 at http://www.id3.org/id3v2-00.txt and
-
-      "Blues", "Classic Rock", "Country", "Dance", "Disco", "Funk",
-      "Grunge", "Hip-Hop", "Jazz", "Metal", "New Age", "Oldies", "Other",
-      "Pop", "R&B", "Rap", "Reggae", "Rock", "Techno", "Industrial",
-      "Alternative", "Ska", "Death Metal", "Pranks", "Soundtrack",
-      "Euro-Techno", "Ambient", "Trip-Hop", "Vocal", "Jazz+Funk",
-      "Fusion", "Trance", "Classical", "Instrumental", "Acid", "House",
-      "Game", "Sound Clip", "Gospel", "Noise", "AlternRock", "Bass",
-      "Soul", "Punk", "Space", "Meditative", "Instrumental Pop",
-      "Instrumental Rock", "Ethnic", "Gothic", "Darkwave",
-      "Techno-Industrial", "Electronic", "Pop-Folk", "Eurodance",
-      "Dream", "Southern Rock", "Comedy", "Cult", "Gangsta", "Top 40",
-      "Christian Rap", "Pop/Funk", "Jungle", "Native American",
-      "Cabaret", "New Wave", "Psychadelic", "Rave", "Showtunes",
-      "Trailer", "Lo-Fi", "Tribal", "Acid Punk", "Acid Jazz", "Polka",
-      "Retro", "Musical", "Rock & Roll", "Hard Rock", "Folk", "Folk-Rock",
-      "National Folk", "Swing", "Fast Fusion", "Bebob", "Latin", "Revival",
-      "Celtic", "Bluegrass", "Avantgarde", "Gothic Rock",
-      "Progressive Rock", "Psychedelic Rock", "Symphonic Rock",
-      "Slow Rock", "Big Band", "Chorus", "Easy Listening", "Acoustic",
-      "Humour", "Speech", "Chanson", "Opera", "Chamber Music", "Sonata",
-      "Symphony", "Booty Bass", "Primus", "Porn Groove", "Satire",
-      "Slow Jam", "Club", "Tango", "Samba", "Folklore", "Ballad",
-      "Power Ballad", "Rhythmic Soul", "Freestyle", "Duet", "Punk Rock",
-      "Drum Solo", "Acapella", "Euro-House", "Dance Hall",
-
-      // http://lame.sourceforge.net/doc/html/id3.html
-
-      "Goa", "Drum & Bass", "Club-House", "Hardcore", "Terror", "Indie",
-      "BritPop", "Negerpunk", "Polsk Punk", "Beat", "Christian Gangsta",
-      "Heavy Metal", "Black Metal", "Crossover", "Contemporary C",
-      "Christian Rock", "Merengue", "Salsa", "Thrash Metal", "Anime",
-      "JPop", "SynthPop",
-    };
-    const int genre_count = sizeof(genres) / sizeof(*genres);
-
-    return (code < genre_count ? genres[code] : "");
-  }
-
-
-  // Return a null-terminated std::string from the beginning of 'buffer'
-  // up to 'maxlen' chars in length.
-  std::string getString(u8* buffer, int maxlen) {
-    char* begin = reinterpret_cast<char*>(buffer);
-    int end = 0;
-    for (; end < maxlen && begin[end]; ++end) {
-    }
-    return std::string(begin, begin + end);
-  }
-
-
-  void
+  bool
   MP3InputStream::readID3v1Tags() {
-    // Actually, this function reads both ID3v1 and ID3v1.1.
-
-    if (!m_file->seek(-128, File::END)) {
-      return;
-    }
-
-    u8 buffer[128];
-    if (m_file->read(buffer, 128) != 128) {
-      return;
-    }
-
-    // Verify that it's really an ID3 tag.
-    if (memcmp(buffer + 0, "TAG", 3) != 0) {
-      return;
+    std::vector<Tag> tags;
+    if (!ReadID3v1Tags(m_file.get(), tags)) {
+      return false;
     }
-
-    std::string title   = getString(buffer + 3,  30);
-    std::string artist  = getString(buffer + 33, 30);
-    std::string album   = getString(buffer + 63, 30);
-    std::string year    = getString(buffer + 93, 4);
-    std::string comment = getString(buffer + 97, 30);
-    std::string genre   = getGenre(buffer[127]);
-
-    addTag("title",   title,   "ID3v1");
-    addTag("artist",  artist,  "ID3v1");
-    addTag("album",   album,   "ID3v1");
-    addTag("year",    year,    "ID3v1");
-    addTag("comment", comment, "ID3v1");
-    addTag("genre",   genre,   "ID3v1");
-
-    // This is the ID3v1.1 part.
-    if (buffer[97 + 28] == 0 && buffer[97 + 29] != 0) {
-      char track[20];
-      sprintf(track, "%d", int(buffer[97 + 29]));
-      addTag("track", track, "ID3v1.1");
+    for (size_t i = 0; i < tags.size(); ++i) {
+      addTag(tags[i]);
     }
+    return true;
   }
 
   bool MP3InputStream::ID3v2Match(u8* buf)
@@ -13,6 +13,10 @@
 
 namespace audiere {
 
+#ifndef NO_MPAUDEC
+  struct MP3Decoder;
+#endif
+
   class MP3InputStream : public BasicSource {
   public:
     MP3InputStream();
@@ -34,18 +38,31 @@ namespace audiere {
 
 
   private:
+#ifndef NO_MPAUDEC
     bool decodeFrame();
+    bool endOfStream();
+    void readVBRHeader(int file_length);
+    void extendIndex(int position);
+    bool loadIndex();
+    void saveIndex();
 
-#ifndef NO_MPAUDEC
-    void readID3v1Tags();
+    bool readID3v1Tags();
     void readID3v2Tags();
     void ID3v2Parse(u8* buf, int len, u8 version, u8 flags);
     bool ID3v2Match(u8* buf);
+
+    // pooled; m_context and m_decode_buffer point into it
+    MP3Decoder* m_decoder;
     MPAuDecContext* m_context;
 #else
-    int decodeFrames(int frames, void* samples);
+    bool readFormat();
+    void readTags();
     void GetMpg123String(mpg123_string *s, std::string &dest);
-    void GetID3();
+
+    // mpg123 reads the Audiere file through these
+    static ssize_t FileRead(void* opaque, void* buffer, size_t size);
+    static off_t   FileSeek(void* opaque, off_t offset, int whence);
+
     mpg123_handle* mh;
     static bool mpg123_initialized;                             // workaround to make sure we initialize mpg123 when needed
 #endif
@@ -58,7 +75,12 @@ namespace audiere {
     int m_sample_rate;
     SampleFormat m_sample_format;
 
-    QueueBuffer m_buffer;
+    bool m_seekable;
+    int m_length;
+    int m_position;
+
+#ifndef NO_MPAUDEC
+    RingBuffer m_buffer;
 
     enum { INPUT_BUFFER_SIZE = 4096 };
     u8 m_input_buffer[INPUT_BUFFER_SIZE];
@@ -67,11 +89,21 @@ namespace audiere {
     u8* m_decode_buffer;
     bool m_first_frame;
 
-    bool m_seekable;
-    int m_length;
-    int m_position;
-    std::vector<int> m_frame_sizes;
+    // The frame index is built as frames go by, so it covers the start of
+    // the file up to the furthest point decoded.  Until it reaches the end,
+    // m_length is an estimate from the VBR header or the bitrate.
+    // m_frame_starts holds the sample position at which each frame begins,
+    // so the frame containing a position can be found by binary search.
+    std::vector<int> m_frame_starts;
     std::vector<int> m_frame_offsets;
+    int m_indexed_length;
+    bool m_index_complete;
+
+    // The index is completed by decoding, which may be on the mixer thread,
+    // so it goes to the seek cache when the stream is destroyed instead.
+    bool m_index_unsaved;
+    int m_next_frame;
+#endif
   };
 
 }
@@ -1,5 +1,8 @@
+#include <vector>
+#include "convert.h"
 #include "debug.h"
 #include "input_speex.h"
+#include "seek_cache.h"
 
 
 namespace audiere {
@@ -64,7 +67,31 @@ namespace audiere {
 #else
     m_reader.reset(new FileReader(file));
 #endif
-    m_speexfile = new speexfile::speexfile(m_reader.get());
+
+    // Opening a Speex file normally scans all of it for the seek table.
+    SeekIndex index;
+    bool cached = LoadSeekIndex(file.get(), "spx", index);
+    std::vector<speexfile::offset_t> offsets(index.points.size());
+    std::vector<speexfile::int64_t>  samples(index.points.size());
+    for (size_t i = 0; i < index.points.size(); ++i) {
+      offsets[i] = index.points[i].offset;
+      samples[i] = index.points[i].position;
+    }
+    speexfile::speexseektable table;
+    table.count      = index.points.size();
+    table.offsets    = (offsets.empty() ? 0 : &offsets[0]);
+    table.samples    = (samples.empty() ? 0 : &samples[0]);
+    table.streamsize = index.extra;
+
+    m_speexfile = new speexfile::speexfile(
+      m_reader.get(),
+      (cached ? &table : 0));
+    if (cached && !m_speexfile->initialized) {
+      // the cache entry didn't fit the file after all, so do the scan
+      delete m_speexfile;
+      m_speexfile = new speexfile::speexfile(m_reader.get());
+      cached = false;
+    }
 
     // @todo How should we handle files with multiple streams?
     if (m_speexfile->get_streams() != 1) {
@@ -81,6 +108,10 @@ namespace audiere {
       return false;
     }
 
+    if (!cached) {
+      saveSeekTable(file);
+    }
+
     for (int i = 0; i < m_speexfile->stream_get_tagcount(); ++i) {
       const speexfile::speextags* tag = m_speexfile->stream_get_tags()[i];
       addTag(
@@ -93,6 +124,25 @@ namespace audiere {
   }
 
 
+  void
+  SpeexInputStream::saveSeekTable(FilePtr file) {
+    SeekIndex index;
+    index.length = m_speexfile->get_samples();
+    index.extra  = m_speexfile->stream_get_size(0);
+    index.points.resize(m_speexfile->stream_get_seekcount(0));
+    for (size_t i = 0; i < index.points.size(); ++i) {
+      speexfile::offset_t offset;
+      speexfile::int64_t  sample;
+      m_speexfile->stream_get_seekpos(i, &offset, &sample, 0);
+      index.points[i].offset   = offset;
+      index.points[i].position = sample;
+    }
+    if (!index.points.empty()) {
+      SaveSeekIndex(file.get(), "spx", index);
+    }
+  }
+
+
   void
   SpeexInputStream::getFormat(
     int& channel_count,
@@ -113,25 +163,34 @@ namespace audiere {
     while (frame_count > 0) {
       // If the buffer is empty, decode a little from the speex file.
       if (m_read_buffer.getSize() == 0) {
-        float decode_buffer[2000];  // Size defined by speexfile API.
-        int speex_read = m_speexfile->decode(decode_buffer);
-        if (speex_read == 0) {
-          break;
+        const int decode_size = BUFFER_SIZE * sizeof(float);
+        m_read_buffer.reserve(decode_size);
+        u8* span;
+        if (m_read_buffer.getWriteSpan(span) >= decode_size) {
+          int speex_read = m_speexfile->decode((float*)span);
+          if (speex_read == 0) {
+            break;
+          }
+          m_read_buffer.commit(speex_read * sizeof(float));
+        } else {
+          float decode_buffer[BUFFER_SIZE];
+          int speex_read = m_speexfile->decode(decode_buffer);
+          if (speex_read == 0) {
+            break;
+          }
+          m_read_buffer.write(decode_buffer, speex_read * sizeof(float));
         }
-
-        m_read_buffer.write(decode_buffer, speex_read * sizeof(float));
       }
 
-      const int BUFFER_SIZE = 1024;
-      float read_buffer[BUFFER_SIZE];
-
-      int should_read = std::min(frame_count, BUFFER_SIZE);
-      int actual_read = m_read_buffer.read(read_buffer, should_read * sizeof(float)) / sizeof(float);
+      // Convert straight out of the queue.
+      const u8* span;
+      const int span_size = m_read_buffer.getReadSpan(span);
+      const float* in = (const float*)span;
+      int actual_read = std::min(frame_count, int(span_size / sizeof(float)));
       ADR_ASSERT(actual_read != 0, "Read queue should have data");
 
-      for (int i = 0; i < actual_read; ++i) {
-        out[i] = s16(read_buffer[i] * 32767);
-      }
+      ConvertSamples(in, SF_F32, out, SF_S16, actual_read);
+      m_read_buffer.consume(actual_read * sizeof(float));
 
       frame_count -= actual_read;
       total_read += actual_read;
@@ -35,6 +35,7 @@ namespace audiere {
     bool findFormatChunk();
     bool findDataChunk();
     bool skipBytes(int size);
+    void saveSeekTable(FilePtr file);
 
   private:
     // Defined by speexfile API.
@@ -45,7 +46,7 @@ namespace audiere {
     speexfile::speexfile* m_speexfile;
     int m_position;  // Need to remember this because m_speexfile doesn't.
 
-    QueueBuffer m_read_buffer;
+    RingBuffer m_read_buffer;
   };
 
 }
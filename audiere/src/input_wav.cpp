@@ -1,4 +1,5 @@
 #include <string.h>
+#include "adpcm.h"
 #include "debug.h"
 #include "input_wav.h"
 #include "utility.h"
@@ -6,8 +7,50 @@
 
 namespace audiere {
 
-  static inline bool IsValidSampleSize(u32 size) {
-    return (size == 8 || size == 16);
+  /// Format chunks can't be longer than this, since cbSize is 16 bits.
+  static const u32 MAX_FORMAT_CHUNK_SIZE = 18 + 65535;
+
+
+  bool GetWAVRawFormat(const u8* chunk, int size, RawSampleFormat& format) {
+    if (size < 16) {
+      return false;
+    }
+    int format_tag = read16_le(chunk + 0);
+    const int bits_per_sample = read16_le(chunk + 14);
+
+    // WAVE_FORMAT_EXTENSIBLE puts the real format tag at the start of the
+    // subformat GUID, and the rest of the GUID is always the same
+    if (format_tag == WAV_FORMAT_EXTENSIBLE) {
+      static const u8 guid_tail[14] = {
+        0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80,
+        0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71,
+      };
+      if (size < 40 || read16_le(chunk + 16) < 22 ||
+          memcmp(chunk + 26, guid_tail, 14) != 0)
+      {
+        return false;
+      }
+      format_tag = read16_le(chunk + 24);
+    }
+
+    if (format_tag == WAV_FORMAT_PCM) {
+      // samples narrower than their bytes are padded at the bottom
+      switch ((bits_per_sample + 7) / 8) {
+        case 1:  format = RSF_U8;  return true;
+        case 2:  format = RSF_S16; return true;
+        case 3:  format = RSF_S24; return true;
+        case 4:  format = RSF_S32; return true;
+        default: return false;
+      }
+    } else if (format_tag == WAV_FORMAT_IEEE_FLOAT) {
+      switch (bits_per_sample) {
+        case 32: format = RSF_F32; return true;
+        case 64: format = RSF_F64; return true;
+        default: return false;
+      }
+    } else {
+      return false;
+    }
   }
 
 
@@ -17,11 +60,21 @@ namespace audiere {
     m_channel_count = 0;
     m_sample_rate   = 0;
     m_sample_format = SF_U8;  // reasonable default?
+    m_raw_format    = RSF_U8;
+    m_format_tag    = WAV_FORMAT_PCM;
+    m_block_align   = 0;
+
+    m_fact_length = -1;
 
     m_data_chunk_location = 0;
     m_data_chunk_length   = 0;
+    m_data_chunk_bytes    = 0;
 
     m_frames_left_in_chunk = 0;
+
+    m_next_block     = 0;
+    m_block_frames   = 0;
+    m_block_position = 0;
     m_decoder_text = "wav:standard";
   }
 
@@ -82,26 +135,17 @@ namespace audiere {
       return 0;
     }
 
-    const int frames_to_read = std::min(frame_count, m_frames_left_in_chunk);
-    const int frame_size = m_channel_count * GetSampleSize(m_sample_format);
-    const int bytes_to_read = frames_to_read * frame_size;
-
-    const int read = m_file->read(buffer, bytes_to_read);
-    const int frames_read = read / frame_size;
-
-#if WORDS_BIGENDIAN
-    if (m_sample_format == SF_S16) {
-      // make little endian into host endian
-      u8* out = (u8*)buffer;
-      for (int i = 0; i < frames_read * m_channel_count; ++i) {
-        std::swap(out[0], out[1]);
-        out += 2;
-      }
+    if (isADPCM()) {
+      return readADPCM(frame_count, buffer);
     }
-#endif
+
+    const int frames_to_read = std::min(frame_count, m_frames_left_in_chunk);
+    const int frames_read = ReadRawFrames(
+      m_file.get(), m_raw_format, false, m_channel_count,
+      m_sample_format, frames_to_read, buffer);
 
     // assume that if we didn't get a full read, we're done
-    if (read != bytes_to_read) {
+    if (frames_read != frames_to_read) {
       m_frames_left_in_chunk = 0;
       return frames_read;
     }
@@ -111,11 +155,61 @@ namespace audiere {
   }
 
 
+  int
+  WAVInputStream::readADPCM(int frame_count, void* buffer) {
+    s16* out = (s16*)buffer;
+    int frames_read = 0;
+    while (frames_read < frame_count && m_frames_left_in_chunk > 0) {
+      if (m_block_position == m_block_frames && !decodeBlock()) {
+        // assume that if we couldn't get a block, we're done
+        m_frames_left_in_chunk = 0;
+        break;
+      }
+
+      const int count = std::min(
+        std::min(frame_count - frames_read, m_frames_left_in_chunk),
+        m_block_frames - m_block_position);
+      memcpy(out, &m_block_samples[m_block_position * m_channel_count],
+             count * m_channel_count * sizeof(s16));
+
+      out                    += count * m_channel_count;
+      frames_read            += count;
+      m_block_position       += count;
+      m_frames_left_in_chunk -= count;
+    }
+    return frames_read;
+  }
+
+
+  /// Reads and decodes the next block from the file.
+  bool
+  WAVInputStream::decodeBlock() {
+    const int offset = m_next_block * m_block_align;
+    const int size = std::min(m_block_align, m_data_chunk_bytes - offset);
+    if (size <= 0) {
+      return false;
+    }
+
+    const int read = m_file->read(&m_block[0], size);
+    if (m_format_tag == WAV_FORMAT_IMA_ADPCM) {
+      m_block_frames = DecodeIMAWavBlock(
+        &m_block[0], read, m_channel_count, &m_block_samples[0]);
+    } else {
+      m_block_frames = DecodeMSWavBlock(
+        &m_block[0], read, m_channel_count,
+        &m_coefs[0], int(m_coefs.size() / 2), &m_block_samples[0]);
+    }
+
+    ++m_next_block;
+    m_block_position = 0;
+    return (m_block_frames > 0);
+  }
+
+
   void
   WAVInputStream::reset() {
     // seek to the beginning of the data chunk
-    m_frames_left_in_chunk = m_data_chunk_length;
-    m_file->seek(m_data_chunk_location, File::BEGIN);
+    setPosition(0);
   }
 
 
@@ -133,7 +227,25 @@ namespace audiere {
 
   void
   WAVInputStream::setPosition(int position) {
-    int frame_size = m_channel_count * GetSampleSize(m_sample_format);
+    if (isADPCM()) {
+      // decode the block the position is in and skip to it
+      const int frames_per_block = GetADPCMBlockFrames(
+        m_format_tag, m_block_align, m_channel_count);
+      m_next_block = position / frames_per_block;
+      m_file->seek(
+        m_data_chunk_location + m_next_block * m_block_align, File::BEGIN);
+      m_frames_left_in_chunk = m_data_chunk_length - position;
+      if (decodeBlock() && position % frames_per_block <= m_block_frames) {
+        m_block_position = position % frames_per_block;
+      } else {
+        m_block_frames = 0;
+        m_block_position = 0;
+        m_frames_left_in_chunk = 0;
+      }
+      return;
+    }
+
+    int frame_size = m_channel_count * GetRawSampleSize(m_raw_format);
     m_frames_left_in_chunk = m_data_chunk_length - position;
     m_file->seek(m_data_chunk_location + position * frame_size, File::BEGIN);
   }
@@ -171,50 +283,76 @@ namespace audiere {
 
         ADR_LOG("Found format chunk");
 
-        // read format chunk
-        u8 chunk[16];
-        size = m_file->read(chunk, 16);
-
-        // could we read the entire format chunk?
-        if (size < 16) {
+        // read the whole format chunk, including any extension
+        if (chunk_length > MAX_FORMAT_CHUNK_SIZE) {
+          ADR_LOG("Format chunk too large");
+          return false;
+        }
+        std::vector<u8> chunk(chunk_length);
+        if (m_file->read(&chunk[0], chunk_length) != int(chunk_length)) {
           return false;
         }
-
-        chunk_length -= size;
 
         // parse the memory into useful information
-        u16 format_tag         = read16_le(chunk + 0);
-        u16 channel_count      = read16_le(chunk + 2);
-        u32 samples_per_second = read32_le(chunk + 4);
-        //u32 bytes_per_second   = read32_le(chunk + 8);
-        //u16 block_align        = read16_le(chunk + 12);
-        u16 bits_per_sample    = read16_le(chunk + 14);
-
-        // format_tag must be 1 (WAVE_FORMAT_PCM)
+        u16 format_tag         = read16_le(&chunk[0]);
+        u16 channel_count      = read16_le(&chunk[2]);
+        u32 samples_per_second = read32_le(&chunk[4]);
+        //u32 bytes_per_second   = read32_le(&chunk[8]);
+        u16 block_align        = read16_le(&chunk[12]);
+
         // we only support mono and stereo
-        if (format_tag != 1 ||
-            channel_count > 2 ||
-            !IsValidSampleSize(bits_per_sample)) {
+        if (channel_count < 1 || channel_count > 2) {
           ADR_LOG("Invalid WAV");
           return false;
         }
 
-        // skip the rest of the chunk
-        if (!skipBytes(chunk_length)) {
-          // oops, end of stream
-          return false;
-        }
+        if (format_tag == WAV_FORMAT_IMA_ADPCM ||
+            format_tag == WAV_FORMAT_MS_ADPCM)
+        {
+          if (GetADPCMBlockFrames(format_tag, block_align, channel_count) < 2) {
+            ADR_LOG("Invalid ADPCM block alignment");
+            return false;
+          }
+
+          if (format_tag == WAV_FORMAT_MS_ADPCM) {
+            // the extension holds cbSize, wSamplesPerBlock, wNumCoef, and
+            // then the coefficient pairs
+            const int coef_count =
+              (chunk_length >= 22 ? read16_le(&chunk[20]) : 0);
+            if (coef_count > 0 && int(chunk_length) >= 22 + coef_count * 4) {
+              for (int i = 0; i < coef_count * 2; ++i) {
+                m_coefs.push_back(s16(read16_le(&chunk[22 + i * 2])));
+              }
+            } else {
+              m_coefs.assign(MS_ADPCM_DEFAULT_COEFS[0],
+                             MS_ADPCM_DEFAULT_COEFS[0] + 14);
+            }
+            m_decoder_text = "wav:ms_adpcm";
+          } else {
+            m_decoder_text = "wav:ima_adpcm";
+          }
+
+          m_format_tag    = format_tag;
+          m_block_align   = block_align;
+          m_block.resize(block_align);
+          m_block_samples.resize(
+            GetADPCMBlockFrames(format_tag, block_align, channel_count) *
+            channel_count);
 
-        // figure out the sample format
-        if (bits_per_sample == 8) {
-          m_sample_format = SF_U8;
-        } else if (bits_per_sample == 16) {
           m_sample_format = SF_S16;
-        } else {
+          m_channel_count = channel_count;
+          m_sample_rate   = samples_per_second;
+          return true;
+        }
+
+        // otherwise it must be integer or float PCM
+        if (!GetWAVRawFormat(&chunk[0], chunk_length, m_raw_format)) {
+          ADR_LOG("Invalid WAV");
           return false;
         }
 
         // store the other important .wav attributes
+        m_sample_format = GetDecodedSampleFormat(m_raw_format);
         m_channel_count = channel_count;
         m_sample_rate   = samples_per_second;
         return true;
@@ -222,7 +360,7 @@ namespace audiere {
       } else {
 
         // skip the rest of the chunk
-        if (!skipBytes(chunk_length)) {
+        if (!skipChunk(chunk_length)) {
           // oops, end of stream
           return false;
         }
@@ -259,14 +397,39 @@ namespace audiere {
 
         ADR_LOG("Found data chunk");
 
+        // streamed and truncated files claim more data than they hold
+        m_data_chunk_location  = m_file->tell();
+        m_data_chunk_bytes     = int(std::min(
+          chunk_length,
+          u32(GetFileLength(m_file.get()) - m_data_chunk_location)));
+
+        if (isADPCM()) {
+          // the fact chunk has the exact length, since the last block
+          // may be padded
+          m_data_chunk_length = GetADPCMFrameCount(
+            m_format_tag, m_data_chunk_bytes, m_block_align, m_channel_count);
+          if (m_fact_length >= 0 && m_fact_length < m_data_chunk_length) {
+            m_data_chunk_length = m_fact_length;
+          }
+          setPosition(0);
+          return true;
+        }
+
         // calculate the frame size so we can truncate the data chunk
-        int frame_size = m_channel_count * GetSampleSize(m_sample_format);
+        int frame_size = m_channel_count * GetRawSampleSize(m_raw_format);
 
-        m_data_chunk_location  = m_file->tell();
-        m_data_chunk_length    = chunk_length / frame_size;
+        m_data_chunk_length    = m_data_chunk_bytes / frame_size;
         m_frames_left_in_chunk = m_data_chunk_length;
         return true;
 
+      } else if (memcmp(chunk_id, "fact", 4) == 0 && chunk_length >= 4) {
+
+        u8 fact[4];
+        if (m_file->read(fact, 4) != 4 || !skipChunk(chunk_length - 4)) {
+          return false;
+        }
+        m_fact_length = read32_le(fact);
+
       } else {
 
         ADR_IF_DEBUG {
@@ -278,7 +441,7 @@ namespace audiere {
         }
 
         // skip the rest of the chunk
-        if (!skipBytes(chunk_length)) {
+        if (!skipChunk(chunk_length)) {
           // oops, end of stream
           return false;
         }
@@ -289,8 +452,24 @@ namespace audiere {
 
 
   bool
-  WAVInputStream::skipBytes(int size) {
-    return m_file->seek(size, File::CURRENT);
+  WAVInputStream::isADPCM() const {
+    return (m_format_tag == WAV_FORMAT_IMA_ADPCM ||
+            m_format_tag == WAV_FORMAT_MS_ADPCM);
+  }
+
+
+  /**
+   * Skips the rest of a chunk, plus the pad byte after chunks of odd
+   * length.  Fails rather than seek past the end of the file, so a corrupt
+   * length can't send the chunk search backwards or around in circles.
+   */
+  bool
+  WAVInputStream::skipChunk(u32 size) {
+    const s64 end = s64(m_file->tell()) + size + (size & 1);
+    if (end > GetFileLength(m_file.get())) {
+      return false;
+    }
+    return m_file->seek(int(end), File::BEGIN);
   }
 
 
@@ -2,13 +2,36 @@
 #define INPUT_WAV_H
 
 
+#ifdef _MSC_VER
+#pragma warning(disable : 4786)
+#endif
+
+
+#include <vector>
 #include "audiere.h"
 #include "basic_source.h"
+#include "convert.h"
 #include "types.h"
 
 
 namespace audiere {
 
+  const int WAV_FORMAT_PCM        = 0x0001;
+  const int WAV_FORMAT_IEEE_FLOAT = 0x0003;
+  const int WAV_FORMAT_EXTENSIBLE = 0xFFFE;
+
+  /**
+   * Finds how the samples of an integer or float PCM file are stored,
+   * looking through WAVE_FORMAT_EXTENSIBLE to the real format.
+   *
+   * @param chunk  contents of the format chunk
+   * @param size   size of the format chunk
+   *
+   * @return  false if the samples aren't PCM in a supported size
+   */
+  bool GetWAVRawFormat(const u8* chunk, int size, RawSampleFormat& format);
+
+
   class WAVInputStream : public BasicSource {
   public:
     WAVInputStream();
@@ -30,7 +53,11 @@ namespace audiere {
   private:
     bool findFormatChunk();
     bool findDataChunk();
-    bool skipBytes(int size);
+    bool skipChunk(u32 size);
+
+    bool isADPCM() const;
+    int readADPCM(int frame_count, void* buffer);
+    bool decodeBlock();
 
   private:
     FilePtr m_file;
@@ -39,12 +66,27 @@ namespace audiere {
     int m_channel_count;
     int m_sample_rate;
     SampleFormat m_sample_format;
+    RawSampleFormat m_raw_format;  // as stored in the file, if PCM
+    int m_format_tag;
+    int m_block_align;
+    std::vector<s16> m_coefs;  // MS ADPCM predictor coefficient pairs
+
+    // from fact chunk, if there is one
+    int m_fact_length;         // in frames, -1 if unknown
 
     // from data chunk
     int m_data_chunk_location; // bytes
     int m_data_chunk_length;   // in frames
+    int m_data_chunk_bytes;
 
     int m_frames_left_in_chunk;
+
+    // ADPCM files are decoded a block at a time
+    int m_next_block;
+    std::vector<u8>  m_block;
+    std::vector<s16> m_block_samples;
+    int m_block_frames;        // frames decoded from the current block
+    int m_block_position;      // next frame to return from it
   };
 
 }
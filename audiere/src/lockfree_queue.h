@@ -0,0 +1,108 @@
+/**
+ * @file
+ *
+ * Bounded queue that any number of threads can push onto without locking
+ * or allocating, and one thread pops from.
+ */
+
+#ifndef LOCKFREE_QUEUE_H
+#define LOCKFREE_QUEUE_H
+
+
+#include "atomic.h"
+#include "debug.h"
+
+
+namespace audiere {
+
+  /**
+   * A ring of preallocated slots.  Each slot has a sequence number that
+   * says whose turn it is: a pusher claims the slot at the push position
+   * with a compare-and-swap, fills it, and publishes it by advancing its
+   * sequence; the popper empties it and advances the sequence by a lap so
+   * it can be reused.
+   *
+   * T must be assignable, and T() is stored in empty slots, so RefPtrs
+   * are released when popped.
+   */
+  template<typename T>
+  class LockFreeQueue {
+  public:
+    /// @param capacity  a power of two
+    LockFreeQueue(int capacity) {
+      ADR_ASSERT((capacity & (capacity - 1)) == 0,
+                 "queue capacity must be a power of two");
+      m_slots = new Slot[capacity];
+      for (int i = 0; i < capacity; ++i) {
+        m_slots[i].sequence = i;
+      }
+      m_mask          = capacity - 1;
+      m_push_position = 0;
+      m_pop_position  = 0;
+    }
+
+    ~LockFreeQueue() {
+      delete[] m_slots;
+    }
+
+    /**
+     * Adds an item.  Safe to call from any number of threads at once.
+     *
+     * @return  false if the queue is full
+     */
+    bool push(const T& item) {
+      long position = AtomicLoadAcquire(m_push_position);
+      for (;;) {
+        Slot& slot = m_slots[position & m_mask];
+        const long difference = AtomicLoadAcquire(slot.sequence) - position;
+        if (difference == 0) {
+          if (AtomicCompareExchange(m_push_position, position, position + 1)) {
+            slot.item = item;
+            AtomicStoreRelease(slot.sequence, position + 1);
+            return true;
+          }
+          position = AtomicLoadAcquire(m_push_position);
+        } else if (difference < 0) {
+          // the slot from the last lap hasn't been popped yet
+          return false;
+        } else {
+          // another thread took this slot
+          position = AtomicLoadAcquire(m_push_position);
+        }
+      }
+    }
+
+    /**
+     * Removes the oldest item.  Only one thread may pop.
+     *
+     * @return  false if the queue is empty, or the oldest item is still
+     *          being pushed
+     */
+    bool pop(T& item) {
+      Slot& slot = m_slots[m_pop_position & m_mask];
+      if (AtomicLoadAcquire(slot.sequence) != m_pop_position + 1) {
+        return false;
+      }
+      item = slot.item;
+      slot.item = T();
+      AtomicStoreRelease(slot.sequence, m_pop_position + m_mask + 1);
+      ++m_pop_position;
+      return true;
+    }
+
+  private:
+    struct Slot {
+      volatile long sequence;
+      T item;
+    };
+
+    Slot* m_slots;
+    long m_mask;
+    volatile long m_push_position;
+    long m_pop_position;  // only touched by the popping thread
+  };
+
+}
+
+
+#endif
@@ -91,4 +91,43 @@ namespace audiere {
     m_size = min_size;
   }
 
+
+  BorrowedMemoryFile::BorrowedMemoryFile(
+    const void* buffer, int size, RefCounted* owner)
+  {
+    m_owner = owner;
+    m_buffer = (const u8*)buffer;
+    m_position = 0;
+    m_size = size;
+  }
+
+  int ADR_CALL BorrowedMemoryFile::read(void* buffer, int size) {
+    int real_read = std::min((m_size - m_position), size);
+    memcpy(buffer, m_buffer + m_position, real_read);
+    m_position += real_read;
+    return real_read;
+  }
+
+  bool ADR_CALL BorrowedMemoryFile::seek(int position, SeekMode mode) {
+    int real_pos;
+    switch (mode) {
+      case BEGIN:   real_pos = position;              break;
+      case CURRENT: real_pos = m_position + position; break;
+      case END:     real_pos = m_size + position;     break;
+      default:      return false;
+    }
+
+    if (real_pos < 0 || real_pos > m_size) {
+      m_position = 0;
+      return false;
+    } else {
+      m_position = real_pos;
+      return true;
+    }
+  }
+
+  int ADR_CALL BorrowedMemoryFile::tell() {
+    return m_position;
+  }
+
 };
@@ -29,6 +29,27 @@ namespace audiere {
     int m_capacity;
   };
 
+
+  /**
+   * Read-only file over memory that belongs to something else, which the
+   * file keeps a reference to while it is open.  Several can share the
+   * same memory without copying it.
+   */
+  class BorrowedMemoryFile : public RefImplementation<File> {
+  public:
+    BorrowedMemoryFile(const void* buffer, int size, RefCounted* owner);
+
+    int  ADR_CALL read(void* buffer, int size);
+    bool ADR_CALL seek(int position, SeekMode mode);
+    int  ADR_CALL tell();
+
+  private:
+    RefPtr<RefCounted> m_owner;
+    const u8* m_buffer;
+    int m_position;
+    int m_size;
+  };
+
 }
 
 
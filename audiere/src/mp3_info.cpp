@@ -0,0 +1,197 @@
+#include <stdio.h>
+#include <string.h>
+#include "mp3_info.h"
+#include "utility.h"
+
+
+namespace audiere {
+
+  static const int sample_rates[3] = { 44100, 48000, 32000 };
+
+  // in kbit/s, indexed by [lsf][layer - 1][bitrate index]
+  static const int bit_rates[2][3][15] = {
+    {
+      { 0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448 },
+      { 0, 32, 48, 56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320, 384 },
+      { 0, 32, 40, 48,  56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320 },
+    },
+    {
+      { 0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256 },
+      { 0,  8, 16, 24, 32, 40, 48,  56,  64,  80,  96, 112, 128, 144, 160 },
+      { 0,  8, 16, 24, 32, 40, 48,  56,  64,  80,  96, 112, 128, 144, 160 },
+    },
+  };
+
+
+  bool ParseMPEGFrameHeader(const u8* b, MPEGFrameHeader& header) {
+    int version       = (b[1] >> 3) & 3;  // 0 = 2.5, 2 = 2, 3 = 1
+    int layer_bits    = (b[1] >> 1) & 3;
+    int bitrate_index = b[2] >> 4;
+    int rate_index    = (b[2] >> 2) & 3;
+    int padding       = (b[2] >> 1) & 1;
+    if (b[0] != 0xFF || (b[1] & 0xE0) != 0xE0 || version == 1 ||
+        layer_bits == 0 || bitrate_index == 15 || rate_index == 3)
+    {
+      return false;
+    }
+
+    int lsf = (version == 3 ? 0 : 1);
+    header.layer         = 4 - layer_bits;
+    header.sample_rate   = sample_rates[rate_index] >> (version == 3 ? 0 : (version == 2 ? 1 : 2));
+    header.channel_count = ((b[3] >> 6) == 3 ? 1 : 2);
+    header.bit_rate      = bit_rates[lsf][header.layer - 1][bitrate_index] * 1000;
+
+    if (header.layer == 1) {
+      header.samples_per_frame = 384;
+      header.frame_bytes = (12 * header.bit_rate / header.sample_rate + padding) * 4;
+    } else if (header.layer == 3 && lsf) {
+      header.samples_per_frame = 576;
+      header.frame_bytes = 72 * header.bit_rate / header.sample_rate + padding;
+    } else {
+      header.samples_per_frame = 1152;
+      header.frame_bytes = 144 * header.bit_rate / header.sample_rate + padding;
+    }
+    if (header.bit_rate == 0) {
+      header.frame_bytes = 0;
+    }
+    return true;
+  }
+
+
+  bool IsMPEGFrameAt(File* file, s64 offset) {
+    u8 b[4];
+    MPEGFrameHeader header;
+    return (offset >= 0 && offset <= 0x7FFFFFFF &&
+            file->seek(int(offset), File::BEGIN) &&
+            file->read(b, 4) == 4 &&
+            ParseMPEGFrameHeader(b, header));
+  }
+
+
+  int GetVBRFrameCount(const u8* frame, int frame_bytes) {
+    MPEGFrameHeader header;
+    if (frame_bytes < 4 ||
+        !ParseMPEGFrameHeader(frame, header) ||
+        header.layer != 3)
+    {
+      return -1;
+    }
+
+    bool mpeg1 = ((frame[1] >> 3) & 3) == 3;
+    bool mono  = header.channel_count == 1;
+    int xing = 4 + (mpeg1 ? (mono ? 17 : 32) : (mono ? 9 : 17));
+
+    if (xing + 12 <= frame_bytes &&
+        (memcmp(frame + xing, "Xing", 4) == 0 ||
+         memcmp(frame + xing, "Info", 4) == 0))
+    {
+      const u32 XING_FRAMES = 0x0001;
+      if (read32_be(frame + xing + 4) & XING_FRAMES) {
+        return int(read32_be(frame + xing + 8)) + 1;
+      }
+    }
+
+    const int vbri = 4 + 32;
+    if (vbri + 18 <= frame_bytes && memcmp(frame + vbri, "VBRI", 4) == 0) {
+      return int(read32_be(frame + vbri + 14)) + 1;
+    }
+
+    return -1;
+  }
+
+
+  static const char* GetGenre(u8 code) {
+    const char* genres[] = {
+      // From Appendix A.3 at http://www.id3.org/id3v2-00.txt and
+
+      "Blues", "Classic Rock", "Country", "Dance", "Disco", "Funk",
+      "Grunge", "Hip-Hop", "Jazz", "Metal", "New Age", "Oldies", "Other",
+      "Pop", "R&B", "Rap", "Reggae", "Rock", "Techno", "Industrial",
+      "Alternative", "Ska", "Death Metal", "Pranks", "Soundtrack",
+      "Euro-Techno", "Ambient", "Trip-Hop", "Vocal", "Jazz+Funk",
+      "Fusion", "Trance", "Classical", "Instrumental", "Acid", "House",
+      "Game", "Sound Clip", "Gospel", "Noise", "AlternRock", "Bass",
+      "Soul", "Punk", "Space", "Meditative", "Instrumental Pop",
+      "Instrumental Rock", "Ethnic", "Gothic", "Darkwave",
+      "Techno-Industrial", "Electronic", "Pop-Folk", "Eurodance",
+      "Dream", "Southern Rock", "Comedy", "Cult", "Gangsta", "Top 40",
+      "Christian Rap", "Pop/Funk", "Jungle", "Native American",
+      "Cabaret", "New Wave", "Psychadelic", "Rave", "Showtunes",
+      "Trailer", "Lo-Fi", "Tribal", "Acid Punk", "Acid Jazz", "Polka",
+      "Retro", "Musical", "Rock & Roll", "Hard Rock", "Folk", "Folk-Rock",
+      "National Folk", "Swing", "Fast Fusion", "Bebob", "Latin", "Revival",
+      "Celtic", "Bluegrass", "Avantgarde", "Gothic Rock",
+      "Progressive Rock", "Psychedelic Rock", "Symphonic Rock",
+      "Slow Rock", "Big Band", "Chorus", "Easy Listening", "Acoustic",
+      "Humour", "Speech", "Chanson", "Opera", "Chamber Music", "Sonata",
+      "Symphony", "Booty Bass", "Primus", "Porn Groove", "Satire",
+      "Slow Jam", "Club", "Tango", "Samba", "Folklore", "Ballad",
+      "Power Ballad", "Rhythmic Soul", "Freestyle", "Duet", "Punk Rock",
+      "Drum Solo", "Acapella", "Euro-House", "Dance Hall",
+
+      // http://lame.sourceforge.net/doc/html/id3.html
+
+      "Goa", "Drum & Bass", "Club-House", "Hardcore", "Terror", "Indie",
+      "BritPop", "Negerpunk", "Polsk Punk", "Beat", "Christian Gangsta",
+      "Heavy Metal", "Black Metal", "Crossover", "Contemporary C",
+      "Christian Rock", "Merengue", "Salsa", "Thrash Metal", "Anime",
+      "JPop", "SynthPop",
+    };
+    const int genre_count = sizeof(genres) / sizeof(*genres);
+
+    return (code < genre_count ? genres[code] : "");
+  }
+
+
+  // Return a null-terminated std::string from the beginning of 'buffer'
+  // up to 'maxlen' chars in length.
+  static std::string GetString(u8* buffer, int maxlen) {
+    char* begin = reinterpret_cast<char*>(buffer);
+    int end = 0;
+    for (; end < maxlen && begin[end]; ++end) {
+    }
+    return std::string(begin, begin + end);
+  }
+
+
+  bool ReadID3v1Tags(File* file, std::vector<Tag>& tags) {
+    // Actually, this function reads both ID3v1 and ID3v1.1.
+
+    if (!file->seek(-128, File::END)) {
+      return false;
+    }
+
+    u8 buffer[128];
+    if (file->read(buffer, 128) != 128) {
+      return false;
+    }
+
+    // Verify that it's really an ID3 tag.
+    if (memcmp(buffer + 0, "TAG", 3) != 0) {
+      return false;
+    }
+
+    std::string title   = GetString(buffer + 3,  30);
+    std::string artist  = GetString(buffer + 33, 30);
+    std::string album   = GetString(buffer + 63, 30);
+    std::string year    = GetString(buffer + 93, 4);
+    std::string comment = GetString(buffer + 97, 30);
+    std::string genre   = GetGenre(buffer[127]);
+
+    tags.push_back(Tag("title", title, "ID3v1"));
+    tags.push_back(Tag("artist", artist, "ID3v1"));
+    tags.push_back(Tag("album", album, "ID3v1"));
+    tags.push_back(Tag("year", year, "ID3v1"));
+    tags.push_back(Tag("comment", comment, "ID3v1"));
+    tags.push_back(Tag("genre", genre, "ID3v1"));
+
+    // This is the ID3v1.1 part.
+    if (buffer[97 + 28] == 0 && buffer[97 + 29] != 0) {
+      char track[20];
+      sprintf(track, "%d", int(buffer[97 + 29]));
+      tags.push_back(Tag("track", track, "ID3v1.1"));
+    }
+    return true;
+  }
+
+}
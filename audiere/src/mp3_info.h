@@ -0,0 +1,58 @@
+#ifndef MP3_INFO_H
+#define MP3_INFO_H
+
+
+#include <vector>
+#include "audiere.h"
+#include "basic_source.h"
+#include "types.h"
+
+
+namespace audiere {
+
+  /// Fields of an MPEG audio frame header.
+  struct MPEGFrameHeader {
+    int layer;
+    int sample_rate;
+    int channel_count;
+    int bit_rate;           ///< in bits per second, 0 for free format
+    int frame_bytes;        ///< 0 for free format
+    int samples_per_frame;
+  };
+
+  /**
+   * Decodes the four-byte MPEG audio header at 'b'.
+   *
+   * @return  false if 'b' does not hold a valid header
+   */
+  bool ParseMPEGFrameHeader(const u8* b, MPEGFrameHeader& header);
+
+  /**
+   * Checks for a valid frame header at byte 'offset' of 'file', for
+   * telling whether a cached seek index still fits the file.  The file
+   * position is undefined afterwards.
+   */
+  bool IsMPEGFrameAt(File* file, s64 offset);
+
+  /**
+   * Looks for a Xing/Info or VBRI header in the first frame of a Layer III
+   * stream.  The frame holding it decodes to silence, so the returned count
+   * includes that frame.
+   *
+   * @return  number of frames in the stream, or -1 if there is no header
+   *          with a frame count
+   */
+  int GetVBRFrameCount(const u8* frame, int frame_bytes);
+
+  /**
+   * Reads the ID3v1 or ID3v1.1 tag at the end of 'file'.  The file position
+   * is undefined afterwards.
+   *
+   * @return  true if the file has an ID3v1 tag
+   */
+  bool ReadID3v1Tags(File* file, std::vector<Tag>& tags);
+
+}
+
+
+#endif
@@ -102,7 +102,7 @@ static int alloc_table(VLC *vlc, int size)
     vlc->table_size += size;
     if (vlc->table_size > vlc->table_allocated) {
         vlc->table_allocated += (1 << vlc->bits);
-        vlc->table = realloc(vlc->table,
+        vlc->table = realloc((void *)vlc->table,
                              sizeof(VLC_TYPE) * 2 * vlc->table_allocated);
         if (!vlc->table)
             return -1;
@@ -128,7 +128,7 @@ static int build_table(VLC *vlc, int table_nb_bits,
 #endif
     if (table_index < 0)
         return -1;
-    table = &vlc->table[table_index];
+    table = (VLC_TYPE (*)[2])&vlc->table[table_index];
 
     for(i=0;i<table_size;i++) {
         table[i][1] = 0; /*bits*/
@@ -195,7 +195,7 @@ static int build_table(VLC *vlc, int table_nb_bits,
             if (index < 0)
                 return -1;
             /* note: realloc has been done, so reload tables */
-            table = &vlc->table[table_index];
+            table = (VLC_TYPE (*)[2])&vlc->table[table_index];
             table[i][0] = index; /*code*/
         }
     }
@@ -240,7 +240,7 @@ int init_vlc(VLC *vlc, int nb_bits, int nb_codes,
                     bits, bits_wrap, bits_size,
                     codes, codes_wrap, codes_size,
                     0, 0) < 0) {
-        free(vlc->table);
+        free((void *)vlc->table);
         return -1;
     }
     return 0;
@@ -249,7 +249,7 @@ int init_vlc(VLC *vlc, int nb_bits, int nb_codes,
 
 void free_vlc(VLC *vlc)
 {
-    free(vlc->table);
+    free((void *)vlc->table);
 }
 
 int get_vlc(GetBitContext *s, const VLC *vlc)
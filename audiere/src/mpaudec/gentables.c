@@ -0,0 +1,424 @@
+/*
+ * Writes mpaudectab_gen.h, the decoder tables that used to be computed
+ * by mpaudec_init.  The code is the initialization from mpegaudiodec.c
+ * in libavcodec, moved here so the decoder only holds read-only data and
+ * needs no global setup.
+ *
+ * Build with bits.c and run after changing fixed.h or the source tables
+ * in mpaudectab.h ("make tables" does both):
+ *
+ *     gentables > mpaudectab_gen.h
+ */
+
+#include "fixed.h"
+#include "mpegaudio.h"
+
+/* layer 3 huffman tables */
+typedef struct HuffTable {
+    int xsize;
+    const uint8_t *bits;
+    const uint16_t *codes;
+} HuffTable;
+
+#define MPAUDEC_GENTABLES
+#include "mpaudectab.h"
+
+#define TABLE_4_3_SIZE (8191 + 16)
+
+static int8_t  table_4_3_exp[TABLE_4_3_SIZE];
+static uint32_t table_4_3_value[TABLE_4_3_SIZE];
+static int32_t is_table[2][16];
+static int32_t is_table_lsf[2][2][16];
+static int32_t csa_table[8][2];
+static int32_t mdct_win[8][36];
+static uint16_t scale_factor_modshift[64];
+static int32_t scale_factor_mult[15][3];
+static uint16_t band_index_long[9][23];
+static MPA_INT window[512];
+static VLC huff_vlc[16];
+static VLC huff_quad_vlc[2];
+
+/* all integer n^(4/3) computation code */
+#define DEV_ORDER 13
+
+#define POW_FRAC_BITS 24
+#define POW_FRAC_ONE    (1 << POW_FRAC_BITS)
+#define POW_FIX(a)   ((int)((a) * POW_FRAC_ONE))
+#define POW_MULL(a,b) (((int64_t)(a) * (int64_t)(b)) >> POW_FRAC_BITS)
+
+static int dev_4_3_coefs[DEV_ORDER];
+
+static int pow_mult3[3] = {
+    POW_FIX(1.0),
+    POW_FIX(1.25992104989487316476),
+    POW_FIX(1.58740105196819947474),
+};
+
+static void int_pow_init(void)
+{
+    int i, a;
+
+    a = POW_FIX(1.0);
+    for(i=0;i<DEV_ORDER;i++) {
+        a = POW_MULL(a, POW_FIX(4.0 / 3.0) - i * POW_FIX(1.0)) / (i + 1);
+        dev_4_3_coefs[i] = a;
+    }
+}
+
+/* return the mantissa and the binary exponent */
+static int int_pow(int i, int *exp_ptr)
+{
+    int e, er, eq, j;
+    int a, a1;
+
+    /* renormalize */
+    a = i;
+    e = POW_FRAC_BITS;
+    while (a < (1 << (POW_FRAC_BITS - 1))) {
+        a = a << 1;
+        e--;
+    }
+    a -= (1 << POW_FRAC_BITS);
+    a1 = 0;
+    for(j = DEV_ORDER - 1; j >= 0; j--)
+        a1 = POW_MULL(a, dev_4_3_coefs[j] + a1);
+    a = (1 << POW_FRAC_BITS) + a1;
+    /* exponent compute (exact) */
+    e = e * 4;
+    er = e % 3;
+    eq = e / 3;
+    a = POW_MULL(a, pow_mult3[er]);
+    while (a >= 2 * POW_FRAC_ONE) {
+        a = a >> 1;
+        eq++;
+    }
+    /* convert to float */
+    while (a < POW_FRAC_ONE) {
+        a = a << 1;
+        eq--;
+    }
+    /* now POW_FRAC_ONE <= a < 2 * POW_FRAC_ONE */
+#if POW_FRAC_BITS > FRAC_BITS
+    a = (a + (1 << (POW_FRAC_BITS - FRAC_BITS - 1))) >> (POW_FRAC_BITS - FRAC_BITS);
+    /* correct overflow */
+    if (a >= 2 * (1 << FRAC_BITS)) {
+        a = a >> 1;
+        eq++;
+    }
+#endif
+    *exp_ptr = eq;
+    return a;
+}
+
+static int init_tables(void)
+{
+    int i, j, k;
+
+    /* scale factors table for layer 1/2 */
+    for(i=0;i<64;i++) {
+        int shift, mod;
+        /* 1.0 (i = 3) is normalized to 2 ^ FRAC_BITS */
+        shift = (i / 3);
+        mod = i % 3;
+        scale_factor_modshift[i] = mod | (shift << 2);
+    }
+
+    /* scale factor multiply for layer 1 */
+    for(i=0;i<15;i++) {
+        int n, norm;
+        n = i + 2;
+        norm = (((int64_t)(1) << n) * FRAC_ONE) / ((1 << n) - 1);
+        scale_factor_mult[i][0] = MULL(FIXR(1.0 * 2.0), norm);
+        scale_factor_mult[i][1] = MULL(FIXR(0.7937005259 * 2.0), norm);
+        scale_factor_mult[i][2] = MULL(FIXR(0.6299605249 * 2.0), norm);
+    }
+
+    /* window */
+    /* max = 18760, max sum over all 16 coefs : 44736 */
+    for(i=0;i<257;i++) {
+        int v;
+        v = mpa_enwindow[i];
+#if WFRAC_BITS < 16
+        v = (v + (1 << (16 - WFRAC_BITS - 1))) >> (16 - WFRAC_BITS);
+#endif
+        window[i] = v;
+        if ((i & 63) != 0)
+            v = -v;
+        if (i != 0)
+            window[512 - i] = v;
+    }
+
+    /* huffman decode tables */
+    for(i=1;i<16;i++) {
+        const HuffTable *h = &mpa_huff_tables[i];
+        if (init_vlc(&huff_vlc[i], 8, h->xsize * h->xsize,
+                     h->bits, 1, 1, h->codes, 2, 2) < 0)
+            return -1;
+    }
+    for(i=0;i<2;i++) {
+        if (init_vlc(&huff_quad_vlc[i], i == 0 ? 7 : 4, 16,
+                     mpa_quad_bits[i], 1, 1, mpa_quad_codes[i], 1, 1) < 0)
+            return -1;
+    }
+
+    for(i=0;i<9;i++) {
+        k = 0;
+        for(j=0;j<22;j++) {
+            band_index_long[i][j] = k;
+            k += band_size_long[i][j];
+        }
+        band_index_long[i][22] = k;
+    }
+
+    /* compute n ^ (4/3) and store it in mantissa/exp format */
+    int_pow_init();
+    for(i=1;i<TABLE_4_3_SIZE;i++) {
+        int e, m;
+        m = int_pow(i, &e);
+        /* normalized to FRAC_BITS */
+        table_4_3_value[i] = m;
+        table_4_3_exp[i] = e;
+    }
+
+    for(i=0;i<7;i++) {
+        float f;
+        int v;
+        if (i != 6) {
+            f = tan((double)i * M_PI / 12.0);
+            v = FIXR(f / (1.0 + f));
+        } else {
+            v = FIXR(1.0);
+        }
+        is_table[0][i] = v;
+        is_table[1][6 - i] = v;
+    }
+    /* invalid values */
+    for(i=7;i<16;i++)
+        is_table[0][i] = is_table[1][i] = 0;
+
+    for(i=0;i<16;i++) {
+        double f;
+        int e, k;
+
+        for(j=0;j<2;j++) {
+            e = -(j + 1) * ((i + 1) >> 1);
+            f = pow(2.0, e / 4.0);
+            k = i & 1;
+            is_table_lsf[j][k ^ 1][i] = FIXR(f);
+            is_table_lsf[j][k][i] = FIXR(1.0);
+        }
+    }
+
+    for(i=0;i<8;i++) {
+        float ci, cs, ca;
+        ci = ci_table[i];
+        cs = 1.0 / sqrt(1.0 + ci * ci);
+        ca = cs * ci;
+        csa_table[i][0] = FIX(cs);
+        csa_table[i][1] = FIX(ca);
+    }
+
+    /* compute mdct windows */
+    for(i=0;i<36;i++) {
+        int v;
+        v = FIXR(sin(M_PI * (i + 0.5) / 36.0));
+        mdct_win[0][i] = v;
+        mdct_win[1][i] = v;
+        mdct_win[3][i] = v;
+    }
+    for(i=0;i<6;i++) {
+        mdct_win[1][18 + i] = FIXR(1.0);
+        mdct_win[1][24 + i] = FIXR(sin(M_PI * ((i + 6) + 0.5) / 12.0));
+        mdct_win[1][30 + i] = FIXR(0.0);
+
+        mdct_win[3][i] = FIXR(0.0);
+        mdct_win[3][6 + i] = FIXR(sin(M_PI * (i + 0.5) / 12.0));
+        mdct_win[3][12 + i] = FIXR(1.0);
+    }
+
+    for(i=0;i<12;i++)
+        mdct_win[2][i] = FIXR(sin(M_PI * (i + 0.5) / 12.0));
+
+    /* NOTE: we do frequency inversion adter the MDCT by changing
+       the sign of the right window coefs */
+    for(j=0;j<4;j++) {
+        for(i=0;i<36;i+=2) {
+            mdct_win[j + 4][i] = mdct_win[j][i];
+            mdct_win[j + 4][i + 1] = -mdct_win[j][i + 1];
+        }
+    }
+    return 0;
+}
+
+/* output */
+
+/* prints 'n' values separated by commas, 'per_line' to a line */
+static void print_values(const char *indent, const void *values, int size,
+                         int is_signed, int n, int per_line)
+{
+    int i;
+    long v;
+
+    for(i=0;i<n;i++) {
+        switch (size) {
+        case 1:
+            v = is_signed ? (long)((const int8_t *)values)[i] :
+                            (long)((const uint8_t *)values)[i];
+            break;
+        case 2:
+            v = is_signed ? (long)((const int16_t *)values)[i] :
+                            (long)((const uint16_t *)values)[i];
+            break;
+        default:
+            v = is_signed ? (long)((const int32_t *)values)[i] :
+                            (long)((const uint32_t *)values)[i];
+            break;
+        }
+        if (i % per_line == 0)
+            printf("%s", indent);
+        printf("%ld,", v);
+        printf((i % per_line == per_line - 1 || i == n - 1) ? "\n" : " ");
+    }
+}
+
+/* 'rows' rows of 'n' values each, as a two dimensional initializer */
+static void print_rows(const char *decl, const void *values, int size,
+                       int is_signed, int rows, int n, int per_line)
+{
+    int i;
+
+    printf("%s = {\n", decl);
+    for(i=0;i<rows;i++) {
+        printf("{\n");
+        print_values("    ", (const uint8_t *)values + i * n * size,
+                     size, is_signed, n, per_line);
+        printf("},\n");
+    }
+    printf("};\n\n");
+}
+
+static void print_array(const char *decl, const void *values, int size,
+                        int is_signed, int n, int per_line)
+{
+    printf("%s = {\n", decl);
+    print_values("    ", values, size, is_signed, n, per_line);
+    printf("};\n\n");
+}
+
+static void print_vlc(const char *name, const VLC *vlc, int count)
+{
+    int i, j;
+
+    for(i=0;i<count;i++) {
+        if (!vlc[i].table)
+            continue;
+        printf("static const VLC_TYPE %s_table_%d[%d][2] = {\n",
+               name, i, vlc[i].table_size);
+        for(j=0;j<vlc[i].table_size;j++) {
+            printf("%s{ %d, %d },", j % 4 == 0 ? "    " : " ",
+                   vlc[i].table[j][0], vlc[i].table[j][1]);
+            if (j % 4 == 3 || j == vlc[i].table_size - 1)
+                printf("\n");
+        }
+        printf("};\n\n");
+    }
+
+    printf("static const VLC %s[%d] = {\n", name, count);
+    for(i=0;i<count;i++) {
+        if (vlc[i].table) {
+            printf("    { %d, %s_table_%d, %d, %d },\n", vlc[i].bits,
+                   name, i, vlc[i].table_size, vlc[i].table_size);
+        } else {
+            printf("    { 0, NULL, 0, 0 },\n");
+        }
+    }
+    printf("};\n\n");
+}
+
+int main(void)
+{
+    int i, x, y;
+
+    if (init_tables() < 0) {
+        fprintf(stderr, "gentables: could not build the huffman tables\n");
+        return 1;
+    }
+
+    printf("/* Generated by gentables.c; do not edit. */\n\n");
+    printf("#if FRAC_BITS != %d || WFRAC_BITS != %d\n", FRAC_BITS, WFRAC_BITS);
+    printf("#error \"mpaudectab_gen.h was generated for other precision "
+           "settings; rerun gentables\"\n");
+    printf("#endif\n\n");
+
+    printf("#define TABLE_4_3_SIZE %d\n\n", TABLE_4_3_SIZE);
+
+    /* vlc structure for decoding layer 3 huffman tables */
+    print_vlc("huff_vlc", huff_vlc, 16);
+    print_vlc("huff_quad_vlc", huff_quad_vlc, 2);
+
+    /* code -> (x << 4) | y for the big value tables */
+    for(i=1;i<16;i++) {
+        const int xsize = mpa_huff_tables[i].xsize;
+        printf("static const uint8_t huff_code_table_%d[%d] = {\n",
+               i, xsize * xsize);
+        for(x=0;x<xsize;x++) {
+            printf("   ");
+            for(y=0;y<xsize;y++)
+                printf(" %d,", (x << 4) | y);
+            printf("\n");
+        }
+        printf("};\n\n");
+    }
+    printf("static const uint8_t *const huff_code_table[16] = {\n");
+    printf("    NULL,\n");
+    for(i=1;i<16;i++)
+        printf("    huff_code_table_%d,\n", i);
+    printf("};\n\n");
+
+    print_rows("/* computed from band_size_long */\n"
+               "static const uint16_t band_index_long[9][23]",
+               band_index_long, 2, 0, 9, 23, 12);
+
+    print_array("static const int8_t table_4_3_exp[TABLE_4_3_SIZE]",
+                table_4_3_exp, 1, 1, TABLE_4_3_SIZE, 16);
+    if (FRAC_BITS <= 15) {
+        uint16_t *values = malloc(sizeof(uint16_t) * TABLE_4_3_SIZE);
+        for(i=0;i<TABLE_4_3_SIZE;i++)
+            values[i] = table_4_3_value[i];
+        print_array("static const uint16_t table_4_3_value[TABLE_4_3_SIZE]",
+                    values, 2, 0, TABLE_4_3_SIZE, 8);
+        free(values);
+    } else {
+        print_array("static const uint32_t table_4_3_value[TABLE_4_3_SIZE]",
+                    table_4_3_value, 4, 0, TABLE_4_3_SIZE, 8);
+    }
+
+    print_rows("/* intensity stereo coef table */\n"
+               "static const int32_t is_table[2][16]",
+               is_table, 4, 1, 2, 16, 8);
+    printf("static const int32_t is_table_lsf[2][2][16] = {\n");
+    for(i=0;i<2;i++) {
+        printf("{\n");
+        for(x=0;x<2;x++) {
+            printf("{\n");
+            print_values("    ", is_table_lsf[i][x], 4, 1, 16, 8);
+            printf("},\n");
+        }
+        printf("},\n");
+    }
+    printf("};\n\n");
+    print_rows("static const int32_t csa_table[8][2]",
+               csa_table, 4, 1, 8, 2, 2);
+    print_rows("static const int32_t mdct_win[8][36]",
+               mdct_win, 4, 1, 8, 36, 8);
+
+    print_array("/* lower 2 bits: modulo 3, higher bits: shift */\n"
+                "static const uint16_t scale_factor_modshift[64]",
+                scale_factor_modshift, 2, 0, 64, 16);
+    print_rows("/* [i][j]:  2^(-j/3) * FRAC_ONE * 2^(i+2) / (2^(i+2) - 1) */\n"
+               "static const int32_t scale_factor_mult[15][3]",
+               scale_factor_mult, 4, 1, 15, 3, 3);
+
+    print_array("static const MPA_INT window[512]", window, sizeof(MPA_INT), 1, 512, 8);
+    return 0;
+}
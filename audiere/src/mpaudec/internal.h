@@ -65,9 +65,11 @@ int get_bits_count(const GetBitContext *s);
 
 #define VLC_TYPE int16_t
 
+/* the table is const so the generated tables in mpaudectab_gen.h can be
+   used directly; init_vlc casts it away while building one */
 typedef struct VLC {
     int bits;
-    VLC_TYPE (*table)[2];
+    const VLC_TYPE (*table)[2];
     int table_size, table_allocated;
 } VLC;
 
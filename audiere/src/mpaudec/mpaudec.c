@@ -37,32 +37,8 @@
  *  - test lsf / mpeg25 extensively.
  */
 
-/* define USE_HIGHPRECISION to have a bit exact (but slower) mpeg
-   audio decoder */
-#define USE_HIGHPRECISION
-
-#ifdef USE_HIGHPRECISION
-#define FRAC_BITS   23   /* fractional bits for sb_samples and dct */
-#define WFRAC_BITS  16   /* fractional bits for window */
-#else
-#define FRAC_BITS   15   /* fractional bits for sb_samples and dct */
-#define WFRAC_BITS  14   /* fractional bits for window */
-#endif
-
-#define FRAC_ONE    (1 << FRAC_BITS)
-
-#define MULL(a,b) (((int64_t)(a) * (int64_t)(b)) >> FRAC_BITS)
-#define MUL64(a,b) ((int64_t)(a) * (int64_t)(b))
-#define FIX(a)   ((int)((a) * FRAC_ONE))
-/* WARNING: only correct for posititive numbers */
-#define FIXR(a)   ((int)((a) * FRAC_ONE + 0.5))
-#define FRAC_RND(a) (((a) + (FRAC_ONE/2)) >> FRAC_BITS)
-
-#if FRAC_BITS <= 15
-typedef int16_t MPA_INT;
-#else
-typedef int32_t MPA_INT;
-#endif
+#include "fixed.h"
+#include "simd.h"
 
 /****************/
 
@@ -92,6 +68,12 @@ typedef struct MPADecodeContext {
     int synth_buf_offset[MPA_MAX_CHANNELS];
     int32_t sb_samples[MPA_MAX_CHANNELS][36][SBLIMIT];
     int32_t mdct_buf[MPA_MAX_CHANNELS][SBLIMIT * 18]; /* previous samples, for layer 3 MDCT */
+    int float_output; /* copied from MPAuDecContext for each frame */
+#ifdef MPAUDEC_SIMD
+    /* SIMD kernels picked by mpaudec_init, or null for the scalar code */
+    MPASynthWindowFunc synth_window_simd;
+    MPAIMDCT36Func imdct36_x4_simd;
+#endif
 #ifdef DEBUG
     int frame_count;
 #endif
@@ -120,59 +102,30 @@ typedef struct GranuleDef {
 #define MODE_EXT_MS_STEREO 2
 #define MODE_EXT_I_STEREO  1
 
-/* layer 3 huffman tables */
-typedef struct HuffTable {
-    int xsize;
-    const uint8_t *bits;
-    const uint16_t *codes;
-} HuffTable;
-
 #include "mpaudectab.h"
 
-/* vlc structure for decoding layer 3 huffman tables */
-static VLC huff_vlc[16];
-static uint8_t *huff_code_table[16];
-static VLC huff_quad_vlc[2];
-/* computed from band_size_long */
-static uint16_t band_index_long[9][23];
-/* XXX: free when all decoders are closed */
-#define TABLE_4_3_SIZE (8191 + 16)
-static int8_t  table_4_3_exp[TABLE_4_3_SIZE];
-#if FRAC_BITS <= 15
-static uint16_t table_4_3_value[TABLE_4_3_SIZE];
-#else
-static uint32_t table_4_3_value[TABLE_4_3_SIZE];
-#endif
-/* intensity stereo coef table */
-static int32_t is_table[2][16];
-static int32_t is_table_lsf[2][2][16];
-static int32_t csa_table[8][2];
-static int32_t mdct_win[8][36];
-
-/* lower 2 bits: modulo 3, higher bits: shift */
-static uint16_t scale_factor_modshift[64];
-/* [i][j]:  2^(-j/3) * FRAC_ONE * 2^(i+2) / (2^(i+2) - 1) */
-static int32_t scale_factor_mult[15][3];
+/* everything mpaudec_init used to compute, generated by gentables.c */
+#include "mpaudectab_gen.h"
+
 /* mult table for layer 2 group quantization */
 
 #define SCALE_GEN(v) \
 { FIXR(1.0 * (v)), FIXR(0.7937005259 * (v)), FIXR(0.6299605249 * (v)) }
 
-static int32_t scale_factor_mult2[3][3] = {
+static const int32_t scale_factor_mult2[3][3] = {
     SCALE_GEN(4.0 / 3.0), /* 3 steps */
     SCALE_GEN(4.0 / 5.0), /* 5 steps */
     SCALE_GEN(4.0 / 9.0), /* 9 steps */
 };
 
 /* 2^(n/4) */
-static uint32_t scale_factor_mult3[4] = {
+static const uint32_t scale_factor_mult3[4] = {
     FIXR(1.0),
     FIXR(1.18920711500272106671),
     FIXR(1.41421356237309504880),
     FIXR(1.68179283050742908605),
 };
 
-static MPA_INT window[512];
 
 /* layer 1 unscaling */
 /* n = number of bits of the mantissa minus 1 */
@@ -234,268 +187,86 @@ static int l3_unscale(int value, int exponent)
 #endif
 }
 
-/* all integer n^(4/3) computation code */
-#define DEV_ORDER 13
-
-#define POW_FRAC_BITS 24
-#define POW_FRAC_ONE    (1 << POW_FRAC_BITS)
-#define POW_FIX(a)   ((int)((a) * POW_FRAC_ONE))
-#define POW_MULL(a,b) (((int64_t)(a) * (int64_t)(b)) >> POW_FRAC_BITS)
-
-static int dev_4_3_coefs[DEV_ORDER];
-
-static int pow_mult3[3] = {
-    POW_FIX(1.0),
-    POW_FIX(1.25992104989487316476),
-    POW_FIX(1.58740105196819947474),
-};
-
-static void int_pow_init(void)
+/* points the decoder at the kernels for an instruction set it supports,
+   and returns the level of the kernels actually chosen */
+static int select_kernels(MPADecodeContext *s, int level)
 {
-    int i, a;
-
-    a = POW_FIX(1.0);
-    for(i=0;i<DEV_ORDER;i++) {
-        a = POW_MULL(a, POW_FIX(4.0 / 3.0) - i * POW_FIX(1.0)) / (i + 1);
-        dev_4_3_coefs[i] = a;
+#ifdef MPAUDEC_SIMD
+    switch (level) {
+#ifdef MPAUDEC_AVX2
+    case MPAUDEC_SIMD_AVX2:
+        s->synth_window_simd = mpa_synth_window_avx2;
+        s->imdct36_x4_simd = mpa_imdct36_x4_avx2;
+        return MPAUDEC_SIMD_AVX2;
+#else
+    case MPAUDEC_SIMD_AVX2:
+#endif
+    case MPAUDEC_SIMD_SSE2:
+        s->synth_window_simd = mpa_synth_window_sse2;
+        s->imdct36_x4_simd = mpa_imdct36_x4_sse2;
+        return MPAUDEC_SIMD_SSE2;
     }
+    s->synth_window_simd = NULL;
+    s->imdct36_x4_simd = NULL;
+#endif
+    return MPAUDEC_SIMD_NONE;
 }
 
-/* return the mantissa and the binary exponent */
-static int int_pow(int i, int *exp_ptr)
+/* sets up a zeroed decoder context */
+static void init_context(MPADecodeContext *s)
 {
-    int e, er, eq, j;
-    int a, a1;
-
-    /* renormalize */
-    a = i;
-    e = POW_FRAC_BITS;
-    while (a < (1 << (POW_FRAC_BITS - 1))) {
-        a = a << 1;
-        e--;
-    }
-    a -= (1 << POW_FRAC_BITS);
-    a1 = 0;
-    for(j = DEV_ORDER - 1; j >= 0; j--)
-        a1 = POW_MULL(a, dev_4_3_coefs[j] + a1);
-    a = (1 << POW_FRAC_BITS) + a1;
-    /* exponent compute (exact) */
-    e = e * 4;
-    er = e % 3;
-    eq = e / 3;
-    a = POW_MULL(a, pow_mult3[er]);
-    while (a >= 2 * POW_FRAC_ONE) {
-        a = a >> 1;
-        eq++;
-    }
-    /* convert to float */
-    while (a < POW_FRAC_ONE) {
-        a = a << 1;
-        eq--;
-    }
-    /* now POW_FRAC_ONE <= a < 2 * POW_FRAC_ONE */
-#if POW_FRAC_BITS > FRAC_BITS
-    a = (a + (1 << (POW_FRAC_BITS - FRAC_BITS - 1))) >> (POW_FRAC_BITS - FRAC_BITS);
-    /* correct overflow */
-    if (a >= 2 * (1 << FRAC_BITS)) {
-        a = a >> 1;
-        eq++;
-    }
+    /* the tables are all constant, so there is nothing global to set up
+       and decoders can be created from any thread */
+    select_kernels(s, mpaudec_simd_support());
+
+    s->inbuf_index = 0;
+    s->inbuf = &s->inbuf1[s->inbuf_index][BACKSTEP_SIZE];
+    s->inbuf_ptr = s->inbuf;
+#ifdef DEBUG
+    s->frame_count = 0;
 #endif
-    *exp_ptr = eq;
-    return a;
 }
 
 int mpaudec_init(MPAuDecContext * mpctx)
 {
-    MPADecodeContext *s;
-    static int init=0;
-    int i, j, k;
     assert(mpctx != NULL);
     memset(mpctx, 0, sizeof(MPAuDecContext));
     mpctx->priv_data = calloc(1, sizeof(MPADecodeContext));
     if (mpctx->priv_data == NULL)
         return -1;
-    s = mpctx->priv_data;
-
-    if (!init && !mpctx->parse_only) {
-        /* scale factors table for layer 1/2 */
-        for(i=0;i<64;i++) {
-            int shift, mod;
-            /* 1.0 (i = 3) is normalized to 2 ^ FRAC_BITS */
-            shift = (i / 3);
-            mod = i % 3;
-            scale_factor_modshift[i] = mod | (shift << 2);
-        }
-
-        /* scale factor multiply for layer 1 */
-        for(i=0;i<15;i++) {
-            int n, norm;
-            n = i + 2;
-            norm = (((int64_t)(1) << n) * FRAC_ONE) / ((1 << n) - 1);
-            scale_factor_mult[i][0] = MULL(FIXR(1.0 * 2.0), norm);
-            scale_factor_mult[i][1] = MULL(FIXR(0.7937005259 * 2.0), norm);
-            scale_factor_mult[i][2] = MULL(FIXR(0.6299605249 * 2.0), norm);
-#ifdef DEBUG
-            printf("%d: norm=%x s=%x %x %x\n",
-                   i, norm,
-                   scale_factor_mult[i][0],
-                   scale_factor_mult[i][1],
-                   scale_factor_mult[i][2]);
-#endif
-        }
-
-        /* window */
-        /* max = 18760, max sum over all 16 coefs : 44736 */
-        for(i=0;i<257;i++) {
-            int v;
-            v = mpa_enwindow[i];
-#if WFRAC_BITS < 16
-            v = (v + (1 << (16 - WFRAC_BITS - 1))) >> (16 - WFRAC_BITS);
-#endif
-            window[i] = v;
-            if ((i & 63) != 0)
-                v = -v;
-            if (i != 0)
-                window[512 - i] = v;
-        }
-
-        /* huffman decode tables */
-        huff_code_table[0] = NULL;
-        for(i=1;i<16;i++) {
-            const HuffTable *h = &mpa_huff_tables[i];
-            int xsize, x, y;
-            unsigned int n;
-            uint8_t *code_table;
-
-            xsize = h->xsize;
-            n = xsize * xsize;
-            /* XXX: fail test */
-            init_vlc(&huff_vlc[i], 8, n,
-                     h->bits, 1, 1, h->codes, 2, 2);
-
-            code_table = calloc(n, 1);
-            j = 0;
-            for(x=0;x<xsize;x++) {
-                for(y=0;y<xsize;y++)
-                    code_table[j++] = (x << 4) | y;
-            }
-            huff_code_table[i] = code_table;
-        }
-        for(i=0;i<2;i++) {
-            init_vlc(&huff_quad_vlc[i], i == 0 ? 7 : 4, 16,
-                     mpa_quad_bits[i], 1, 1, mpa_quad_codes[i], 1, 1);
-        }
-
-        for(i=0;i<9;i++) {
-            k = 0;
-            for(j=0;j<22;j++) {
-                band_index_long[i][j] = k;
-                k += band_size_long[i][j];
-            }
-            band_index_long[i][22] = k;
-        }
-
-        /* compute n ^ (4/3) and store it in mantissa/exp format */
-        int_pow_init();
-        for(i=1;i<TABLE_4_3_SIZE;i++) {
-            int e, m;
-            m = int_pow(i, &e);
-            /* normalized to FRAC_BITS */
-            table_4_3_value[i] = m;
-            table_4_3_exp[i] = e;
-        }
-
-        for(i=0;i<7;i++) {
-            float f;
-            int v;
-            if (i != 6) {
-                f = tan((double)i * M_PI / 12.0);
-                v = FIXR(f / (1.0 + f));
-            } else {
-                v = FIXR(1.0);
-            }
-            is_table[0][i] = v;
-            is_table[1][6 - i] = v;
-        }
-        /* invalid values */
-        for(i=7;i<16;i++)
-            is_table[0][i] = is_table[1][i] = 0.0;
-
-        for(i=0;i<16;i++) {
-            double f;
-            int e, k;
-
-            for(j=0;j<2;j++) {
-                e = -(j + 1) * ((i + 1) >> 1);
-                f = pow(2.0, e / 4.0);
-                k = i & 1;
-                is_table_lsf[j][k ^ 1][i] = FIXR(f);
-                is_table_lsf[j][k][i] = FIXR(1.0);
-#ifdef DEBUG
-                printf("is_table_lsf %d %d: %x %x\n",
-                       i, j, is_table_lsf[j][0][i], is_table_lsf[j][1][i]);
-#endif
-            }
-        }
-
-        for(i=0;i<8;i++) {
-            float ci, cs, ca;
-            ci = ci_table[i];
-            cs = 1.0 / sqrt(1.0 + ci * ci);
-            ca = cs * ci;
-            csa_table[i][0] = FIX(cs);
-            csa_table[i][1] = FIX(ca);
-        }
-
-        /* compute mdct windows */
-        for(i=0;i<36;i++) {
-            int v;
-            v = FIXR(sin(M_PI * (i + 0.5) / 36.0));
-            mdct_win[0][i] = v;
-            mdct_win[1][i] = v;
-            mdct_win[3][i] = v;
-        }
-        for(i=0;i<6;i++) {
-            mdct_win[1][18 + i] = FIXR(1.0);
-            mdct_win[1][24 + i] = FIXR(sin(M_PI * ((i + 6) + 0.5) / 12.0));
-            mdct_win[1][30 + i] = FIXR(0.0);
-
-            mdct_win[3][i] = FIXR(0.0);
-            mdct_win[3][6 + i] = FIXR(sin(M_PI * (i + 0.5) / 12.0));
-            mdct_win[3][12 + i] = FIXR(1.0);
-        }
-
-        for(i=0;i<12;i++)
-            mdct_win[2][i] = FIXR(sin(M_PI * (i + 0.5) / 12.0));
+    init_context(mpctx->priv_data);
+    return 0;
+}
 
-        /* NOTE: we do frequency inversion adter the MDCT by changing
-           the sign of the right window coefs */
-        for(j=0;j<4;j++) {
-            for(i=0;i<36;i+=2) {
-                mdct_win[j + 4][i] = mdct_win[j][i];
-                mdct_win[j + 4][i + 1] = -mdct_win[j][i + 1];
-            }
-        }
+void mpaudec_reset(MPAuDecContext *mpctx)
+{
+    void *priv_data;
+    assert(mpctx != NULL);
+    assert(mpctx->priv_data != NULL);
+    priv_data = mpctx->priv_data;
+    memset(mpctx, 0, sizeof(MPAuDecContext));
+    memset(priv_data, 0, sizeof(MPADecodeContext));
+    mpctx->priv_data = priv_data;
+    init_context(priv_data);
+}
 
-#if defined(DEBUG)
-        for(j=0;j<8;j++) {
-            printf("win%d=\n", j);
-            for(i=0;i<36;i++)
-                printf("%f, ", (double)mdct_win[j][i] / FRAC_ONE);
-            printf("\n");
-        }
+int mpaudec_simd_support(void)
+{
+#ifdef MPAUDEC_SIMD
+    return mpa_simd_detect();
+#else
+    return MPAUDEC_SIMD_NONE;
 #endif
-        init = 1;
-    }
+}
 
-    s->inbuf_index = 0;
-    s->inbuf = &s->inbuf1[s->inbuf_index][BACKSTEP_SIZE];
-    s->inbuf_ptr = s->inbuf;
-#ifdef DEBUG
-    s->frame_count = 0;
-#endif
-    return 0;
+int mpaudec_select_simd(MPAuDecContext *mpctx, int max_level)
+{
+    int level = mpaudec_simd_support();
+    assert(mpctx != NULL);
+    assert(mpctx->priv_data != NULL);
+    if (level > max_level)
+        level = max_level;
+    return select_kernels(mpctx->priv_data, level);
 }
 
 /* tab[i][j] = 1.0 / (2.0 * cos(pi*(2*k+1) / 2^(6 - j))) */
@@ -719,8 +490,13 @@ static void dct32(int32_t *out, int32_t *tab)
 
 #define OUT_SHIFT (WFRAC_BITS + FRAC_BITS - 15)
 
+/* maps a window sum to a float with 32768 -> 1.0 */
+#define OUT_FLOAT_SCALE (1.0f / (float)((int64_t)1 << (OUT_SHIFT + 15)))
+
 #if FRAC_BITS <= 15
 
+typedef int32_t SYNTH_SUM;
+
 static int round_sample(int sum)
 {
     int sum1;
@@ -740,6 +516,8 @@ static int round_sample(int sum)
 
 #else
 
+typedef int64_t SYNTH_SUM;
+
 static int round_sample(int64_t sum)
 {
     int sum1;
@@ -797,45 +575,22 @@ static int round_sample(int64_t sum)
 }
 
 
-/* 32 sub band synthesis filter. Input: 32 sub band samples, Output:
-   32 samples. */
-/* XXX: optimize by avoiding ring buffer usage */
-static void synth_filter(MPADecodeContext *s1,
-                         int ch, int16_t *samples, int incr,
-                         int32_t sb_samples[SBLIMIT])
+/* sum of the synthesis window for every output sample, in the order
+   they are written */
+static void synth_window(const MPADecodeContext *s1,
+                         const MPA_INT *synth_buf, SYNTH_SUM sums[32])
 {
-    int32_t tmp[32];
-    MPA_INT *synth_buf;
     const MPA_INT *w, *w2, *p;
-    int j, offset, v;
-    int16_t *samples2;
-#if FRAC_BITS <= 15
-    int32_t sum, sum2;
-#else
-    int64_t sum, sum2;
-#endif
-
-    dct32(tmp, sb_samples);
+    SYNTH_SUM sum, sum2;
+    int j;
 
-    offset = s1->synth_buf_offset[ch];
-    synth_buf = s1->synth_buf[ch] + offset;
-
-    for(j=0;j<32;j++) {
-        v = tmp[j];
-#if FRAC_BITS <= 15
-        /* NOTE: can cause a loss in precision if very high amplitude
-           sound */
-        if (v > 32767)
-            v = 32767;
-        else if (v < -32768)
-            v = -32768;
-#endif
-        synth_buf[j] = v;
+#ifdef MPAUDEC_SIMD
+    if (s1->synth_window_simd) {
+        s1->synth_window_simd(window, synth_buf, sums);
+        return;
     }
-    /* copy to avoid wrap */
-    memcpy(synth_buf + 512, synth_buf, 32 * sizeof(MPA_INT));
+#endif
 
-    samples2 = samples + 31 * incr;
     w = window;
     w2 = window + 31;
 
@@ -844,8 +599,7 @@ static void synth_filter(MPADecodeContext *s1,
     SUM8(sum, +=, w, p);
     p = synth_buf + 48;
     SUM8(sum, -=, w + 32, p);
-    *samples = round_sample(sum);
-    samples += incr;
+    sums[0] = sum;
     w++;
 
     /* we calculate two samples at the same time to avoid one memory
@@ -858,10 +612,8 @@ static void synth_filter(MPADecodeContext *s1,
         p = synth_buf + 48 - j;
         SUM8P2(sum, -=, sum2, -=, w + 32, w2 + 32, p);
 
-        *samples = round_sample(sum);
-        samples += incr;
-        *samples2 = round_sample(sum2);
-        samples2 -= incr;
+        sums[j] = sum;
+        sums[32 - j] = sum2;
         w++;
         w2--;
     }
@@ -869,7 +621,58 @@ static void synth_filter(MPADecodeContext *s1,
     p = synth_buf + 32;
     sum = 0;
     SUM8(sum, -=, w + 32, p);
-    *samples = round_sample(sum);
+    sums[16] = sum;
+}
+
+/* 32 sub band synthesis filter. Input: 32 sub band samples, Output:
+   32 samples, either 16 bit integers or floats in [-1, 1] depending on
+   float_output. */
+/* XXX: optimize by avoiding ring buffer usage */
+static void synth_filter(MPADecodeContext *s1,
+                         int ch, void *samples, int incr,
+                         int32_t sb_samples[SBLIMIT])
+{
+    int32_t tmp[32];
+    SYNTH_SUM sums[32];
+    MPA_INT *synth_buf;
+    int j, offset, v;
+
+    dct32(tmp, sb_samples);
+
+    offset = s1->synth_buf_offset[ch];
+    synth_buf = s1->synth_buf[ch] + offset;
+
+    for(j=0;j<32;j++) {
+        v = tmp[j];
+#if FRAC_BITS <= 15
+        /* NOTE: can cause a loss in precision if very high amplitude
+           sound */
+        if (v > 32767)
+            v = 32767;
+        else if (v < -32768)
+            v = -32768;
+#endif
+        synth_buf[j] = v;
+    }
+    /* copy to avoid wrap */
+    memcpy(synth_buf + 512, synth_buf, 32 * sizeof(MPA_INT));
+
+    synth_window(s1, synth_buf, sums);
+
+    if (s1->float_output) {
+        /* no rounding or clipping: peaks above full scale survive */
+        float *out = samples;
+        for(j=0;j<32;j++) {
+            *out = (float)sums[j] * OUT_FLOAT_SCALE;
+            out += incr;
+        }
+    } else {
+        int16_t *out = samples;
+        for(j=0;j<32;j++) {
+            *out = round_sample(sums[j]);
+            out += incr;
+        }
+    }
 
     offset = (offset - 32) & 511;
     s1->synth_buf_offset[ch] = offset;
@@ -939,7 +742,7 @@ static void imdct12(int *out, int *in)
 #define C8 FIXR(0.17364817766693034885)
 
 /* 0.5 / cos(pi*(2*i+1)/36) */
-static const int icos36[9] = {
+const int mpa_icos36[9] = {
     FIXR(0.50190991877167369479),
     FIXR(0.51763809020504152469),
     FIXR(0.55168895948124587824),
@@ -951,7 +754,7 @@ static const int icos36[9] = {
     FIXR(5.73685662283492756461),
 };
 
-static const int icos72[18] = {
+const int mpa_icos72[18] = {
     /* 0.5 / cos(pi*(2*i+19)/72) */
     FIXR(0.74009361646113053152),
     FIXR(0.82133981585229078570),
@@ -1025,18 +828,18 @@ static void imdct36(int *out, int *in)
 
         t2 = tmp[i + 1];
         t3 = tmp[i + 3];
-        s1 = MULL(t3 + t2, icos36[j]);
-        s3 = MULL(t3 - t2, icos36[8 - j]);
+        s1 = MULL(t3 + t2, mpa_icos36[j]);
+        s3 = MULL(t3 - t2, mpa_icos36[8 - j]);
 
-        t0 = MULL(s0 + s1, icos72[9 + 8 - j]);
-        t1 = MULL(s0 - s1, icos72[8 - j]);
+        t0 = MULL(s0 + s1, mpa_icos72[9 + 8 - j]);
+        t1 = MULL(s0 - s1, mpa_icos72[8 - j]);
         out[18 + 9 + j] = t0;
         out[18 + 8 - j] = t0;
         out[9 + j] = -t1;
         out[8 - j] = t1;
 
-        t0 = MULL(s2 + s3, icos72[9+j]);
-        t1 = MULL(s2 - s3, icos72[j]);
+        t0 = MULL(s2 + s3, mpa_icos72[9+j]);
+        t1 = MULL(s2 - s3, mpa_icos72[j]);
         out[18 + 9 + (8 - j)] = t0;
         out[18 + j] = t0;
         out[9 + (8 - j)] = -t1;
@@ -1045,9 +848,9 @@ static void imdct36(int *out, int *in)
     }
 
     s0 = tmp[16];
-    s1 = MULL(tmp[17], icos36[4]);
-    t0 = MULL(s0 + s1, icos72[9 + 4]);
-    t1 = MULL(s0 - s1, icos72[4]);
+    s1 = MULL(tmp[17], mpa_icos36[4]);
+    t0 = MULL(s0 + s1, mpa_icos72[9 + 4]);
+    t1 = MULL(s0 - s1, mpa_icos72[4]);
     out[18 + 9 + 4] = t0;
     out[18 + 8 - 4] = t0;
     out[9 + 4] = -t1;
@@ -1565,8 +1368,8 @@ static int huffman_decode(MPADecodeContext *s, GranuleDef *g,
     int s_index;
     int linbits, code, x, y, l, v, i, j, k, pos;
     GetBitContext last_gb;
-    VLC *vlc;
-    uint8_t *code_table;
+    const VLC *vlc;
+    const uint8_t *code_table;
 
     /* low frequencies (called big values) */
     s_index = 0;
@@ -1707,7 +1510,7 @@ static void compute_stereo(MPADecodeContext *s,
     int i, j, k, l;
     int32_t v1, v2;
     int sf_max, tmp0, tmp1, sf, len, non_zero_found;
-    int32_t (*is_tab)[16];
+    const int32_t (*is_tab)[16];
     int32_t *tab0, *tab1;
     int non_zero_found_short[3];
 
@@ -1831,7 +1634,8 @@ static void compute_stereo(MPADecodeContext *s,
 static void compute_antialias(MPADecodeContext *s,
                               GranuleDef *g)
 {
-    int32_t *ptr, *p0, *p1, *csa;
+    int32_t *ptr, *p0, *p1;
+    const int32_t *csa;
     int n, tmp0, tmp1, i, j;
 
     /* we antialias only "long" bands */
@@ -1867,7 +1671,8 @@ static void compute_imdct(MPADecodeContext *s,
                           int32_t *sb_samples,
                           int32_t *mdct_buf)
 {
-    int32_t *ptr, *win, *win1, *buf, *buf2, *out_ptr, *ptr1;
+    int32_t *ptr, *buf, *buf2, *out_ptr, *ptr1;
+    const int32_t *win, *win1;
     int32_t in[6];
     int32_t out[36];
     int32_t out2[12];
@@ -1896,7 +1701,25 @@ static void compute_imdct(MPADecodeContext *s,
 
     buf = mdct_buf;
     ptr = g->sb_hybrid;
-    for(j=0;j<mdct_long_end;j++) {
+    j = 0;
+#ifdef MPAUDEC_SIMD
+    if (s->imdct36_x4_simd) {
+        const int32_t *win4[4];
+        for(;j+4<=mdct_long_end;j+=4) {
+            for(k=0;k<4;k++) {
+                if (g->switch_point && j + k < 2)
+                    win1 = mdct_win[0];
+                else
+                    win1 = mdct_win[g->block_type];
+                win4[k] = win1 + ((4 * 36) & -((j + k) & 1));
+            }
+            s->imdct36_x4_simd(sb_samples + j, buf, ptr, win4);
+            ptr += 4 * 18;
+            buf += 4 * 18;
+        }
+    }
+#endif
+    for(;j<mdct_long_end;j++) {
         imdct36(out, ptr);
         /* apply window & overlap with previous buffer */
         out_ptr = sb_samples + j;
@@ -2258,11 +2081,52 @@ static int mp_decode_layer3(MPADecodeContext *s)
     return nb_granules * 18;
 }
 
+/* Parse a frame without decoding it.  Only a layer 3 frame is needed by
+   the frames after it, for the bit reservoir, and keeping that up to date
+   just takes its main_data_begin field. */
+static int mp_skip_frame(MPADecodeContext *s)
+{
+    int nb_frames, sample_size, main_data_begin, side_info_size;
+
+    sample_size = s->float_output ? sizeof(float) : sizeof(int16_t);
+
+    switch(s->layer) {
+    case 1:
+        nb_frames = 12;
+        break;
+    case 2:
+        nb_frames = 36;
+        break;
+    case 3:
+    default:
+        init_get_bits(&s->gb, s->inbuf + HEADER_SIZE,
+                      (s->inbuf_ptr - s->inbuf - HEADER_SIZE)*8);
+        if (s->error_protection)
+            skip_bits(&s->gb, 16);
+        if (s->lsf) {
+            main_data_begin = get_bits(&s->gb, 8);
+            side_info_size = (s->nb_channels == 1) ? 9 : 17;
+            nb_frames = 18;
+        } else {
+            main_data_begin = get_bits(&s->gb, 9);
+            side_info_size = (s->nb_channels == 1) ? 17 : 32;
+            nb_frames = 36;
+        }
+        /* seek_to_maindata works from the end of the side info */
+        skip_bits(&s->gb, side_info_size * 8 - (s->lsf ? 8 : 9));
+        seek_to_maindata(s, main_data_begin);
+        break;
+    }
+    return nb_frames * 32 * sample_size * s->nb_channels;
+}
+
 static int mp_decode_frame(MPADecodeContext *s,
-                           int16_t *samples)
+                           void *samples)
 {
-    int i, nb_frames, ch;
-    int16_t *samples_ptr;
+    int i, nb_frames, ch, sample_size;
+    uint8_t *samples_ptr;
+
+    sample_size = s->float_output ? sizeof(float) : sizeof(int16_t);
 
     init_get_bits(&s->gb, s->inbuf + HEADER_SIZE,
                   (s->inbuf_ptr - s->inbuf - HEADER_SIZE)*8);
@@ -2299,17 +2163,17 @@ static int mp_decode_frame(MPADecodeContext *s,
 #endif
     /* apply the synthesis filter */
     for(ch=0;ch<s->nb_channels;ch++) {
-        samples_ptr = samples + ch;
+        samples_ptr = (uint8_t *)samples + ch * sample_size;
         for(i=0;i<nb_frames;i++) {
             synth_filter(s, ch, samples_ptr, s->nb_channels,
                          s->sb_samples[ch][i]);
-            samples_ptr += 32 * s->nb_channels;
+            samples_ptr += 32 * s->nb_channels * sample_size;
         }
     }
 #ifdef DEBUG
     s->frame_count++;
 #endif
-    return nb_frames * 32 * sizeof(short) * s->nb_channels;
+    return nb_frames * 32 * sample_size * s->nb_channels;
 }
 
 int mpaudec_decode_frame(MPAuDecContext * mpctx,
@@ -2319,7 +2183,6 @@ int mpaudec_decode_frame(MPAuDecContext * mpctx,
     MPADecodeContext *s;
     const uint8_t *buf_ptr = buf;
     int out_size = 0;
-    int16_t *out_samples = data;
     assert(mpctx != NULL);
     assert(mpctx->priv_data != NULL);
     s = mpctx->priv_data;
@@ -2454,8 +2317,12 @@ int mpaudec_decode_frame(MPAuDecContext * mpctx,
                 /* simply return the frame data */
                 *(uint8_t **)data = s->inbuf;
                 out_size = s->inbuf_ptr - s->inbuf;
+            } else if (mpctx->skip_output) {
+                s->float_output = mpctx->float_output;
+                out_size = mp_skip_frame(s);
             } else {
-                out_size = mp_decode_frame(s, out_samples);
+                s->float_output = mpctx->float_output;
+                out_size = mp_decode_frame(s, data);
             }
             if (free_format_next_header != 0) {
                 s->inbuf[0] = free_format_next_header >> 24;
@@ -9,6 +9,8 @@ extern "C" {
 
 /* in bytes */
 #define MPAUDEC_MAX_AUDIO_FRAME_SIZE 4608
+/* in bytes, when float_output is set */
+#define MPAUDEC_MAX_FLOAT_FRAME_SIZE 9216
 
 typedef struct MPAuDecContext {
     int bit_rate;
@@ -19,14 +21,37 @@ typedef struct MPAuDecContext {
     void *priv_data;
     int parse_only;
     int coded_frame_size;
+    /* if nonzero, decoded samples are floats in [-1, 1] instead of
+       16 bit integers, and are not clipped */
+    int float_output;
+    /* if nonzero, frames are only parsed far enough to keep the layer 3
+       bit reservoir current.  Nothing is written to data, but data_size
+       is still set to the size the decoded samples would have had. */
+    int skip_output;
 } MPAuDecContext;
 
 int mpaudec_init(MPAuDecContext *mpctx);
+/* returns a decoder to the state mpaudec_init left it in, without
+   allocating anything */
+void mpaudec_reset(MPAuDecContext *mpctx);
 int mpaudec_decode_frame(MPAuDecContext * mpctx,
                          void *data, int *data_size,
                          const unsigned char * buf, int buf_size);
 void mpaudec_clear(MPAuDecContext *mpctx);
 
+/* instruction sets the decoder can use, each including the ones before */
+enum {
+    MPAUDEC_SIMD_NONE,
+    MPAUDEC_SIMD_SSE2,
+    MPAUDEC_SIMD_AVX2
+};
+
+/* best instruction set supported by this build, the CPU and the OS */
+int mpaudec_simd_support(void);
+/* mpaudec_init and mpaudec_reset pick the best kernels; this limits a
+   decoder to max_level and returns the level it will use */
+int mpaudec_select_simd(MPAuDecContext *mpctx, int max_level);
+
 #ifdef __cplusplus
 }
 #endif
@@ -13,6 +13,9 @@ static const uint16_t mpa_bitrate_tab[2][3][15] = {
 
 static const uint16_t mpa_freq_tab[3] = { 44100, 48000, 32000 };
 
+#ifdef MPAUDEC_GENTABLES
+/* only needed to generate mpaudectab_gen.h */
+
 /*******************************************************/
 /* half mpeg encoding window (full precision) */
 static const int32_t mpa_enwindow[257] = {
@@ -54,6 +57,8 @@ static const int32_t mpa_enwindow[257] = {
 /*******************************************************/
 /* layer 2 tables */
 
+#endif /* MPAUDEC_GENTABLES */
+
 static const int sblimit_table[5] = { 27 , 30 , 8, 12 , 30 };
 
 static const int quant_steps[17] = {
@@ -195,7 +200,7 @@ static const unsigned char alloc_table_4[] = {
  2,  0,  1,  3, 
 };
 
-static const unsigned char *alloc_tables[5] = 
+static const unsigned char *const alloc_tables[5] = 
 { alloc_table_0, alloc_table_1, alloc_table_2, alloc_table_3, alloc_table_4, };
 
 /*******************************************************/
@@ -219,6 +224,8 @@ static const uint8_t lsf_nsf_table[6][3][4] = {
 
 /* mpegaudio layer 3 huffman tables */
 
+#ifdef MPAUDEC_GENTABLES
+
 static const uint16_t mpa_huffcodes_1[4] = {
  0x0001, 0x0001, 0x0001, 0x0000,
 };
@@ -680,6 +687,8 @@ static const HuffTable mpa_huff_tables[16] = {
 { 16, mpa_huffbits_24, mpa_huffcodes_24 },
 };
 
+#endif /* MPAUDEC_GENTABLES */
+
 static const uint8_t mpa_huff_data[32][2] = {
 { 0, 0 },
 { 1, 0 },
@@ -716,6 +725,8 @@ static const uint8_t mpa_huff_data[32][2] = {
 };
 
 
+#ifdef MPAUDEC_GENTABLES
+
 /* huffman tables for quadrules */
 static uint8_t mpa_quad_codes[2][16] = {
     {  1,  5,  4,  5,  6,  5,  4,  4, 7,  3,  6,  0,  7,  2,  3,  1, },
@@ -727,6 +738,8 @@ static uint8_t mpa_quad_bits[2][16] = {
     { 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, },
 };
 
+#endif /* MPAUDEC_GENTABLES */
+
 /* band size tables */
 static const uint8_t band_size_long[9][22] = {
 { 4, 4, 4, 4, 4, 4, 6, 6, 8, 8, 10,
@@ -766,7 +779,10 @@ static const uint8_t mpa_pretab[2][22] = {
     { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 3, 2, 0 },
 };
 
+#ifdef MPAUDEC_GENTABLES
 /* table for alias reduction (XXX: store it as integer !) */
 static const float ci_table[8] = {
     -0.6f, -0.535f, -0.33f, -0.185f, -0.095f, -0.041f, -0.0142f, -0.0037f,
 };
+
+#endif /* MPAUDEC_GENTABLES */
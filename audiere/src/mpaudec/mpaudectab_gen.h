@@ -0,0 +1,3509 @@
+/* Generated by gentables.c; do not edit. */
+
+#if FRAC_BITS != 23 || WFRAC_BITS != 16
+#error "mpaudectab_gen.h was generated for other precision settings; rerun gentables"
+#endif
+
+#define TABLE_4_3_SIZE 8207
+
+static const VLC_TYPE huff_vlc_table_1[256][2] = {
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 2, 2 }, { 2, 2 }, { 2, 2 }, { 2, 2 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_2[256][2] = {
+    { 8, 6 }, { 8, 6 }, { 8, 6 }, { 8, 6 },
+    { 2, 6 }, { 2, 6 }, { 2, 6 }, { 2, 6 },
+    { 5, 5 }, { 5, 5 }, { 5, 5 }, { 5, 5 },
+    { 5, 5 }, { 5, 5 }, { 5, 5 }, { 5, 5 },
+    { 7, 5 }, { 7, 5 }, { 7, 5 }, { 7, 5 },
+    { 7, 5 }, { 7, 5 }, { 7, 5 }, { 7, 5 },
+    { 6, 5 }, { 6, 5 }, { 6, 5 }, { 6, 5 },
+    { 6, 5 }, { 6, 5 }, { 6, 5 }, { 6, 5 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_3[256][2] = {
+    { 8, 6 }, { 8, 6 }, { 8, 6 }, { 8, 6 },
+    { 2, 6 }, { 2, 6 }, { 2, 6 }, { 2, 6 },
+    { 5, 5 }, { 5, 5 }, { 5, 5 }, { 5, 5 },
+    { 5, 5 }, { 5, 5 }, { 5, 5 }, { 5, 5 },
+    { 7, 5 }, { 7, 5 }, { 7, 5 }, { 7, 5 },
+    { 7, 5 }, { 7, 5 }, { 7, 5 }, { 7, 5 },
+    { 6, 5 }, { 6, 5 }, { 6, 5 }, { 6, 5 },
+    { 6, 5 }, { 6, 5 }, { 6, 5 }, { 6, 5 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 3, 3 }, { 3, 3 }, { 3, 3 }, { 3, 3 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 4, 2 }, { 4, 2 }, { 4, 2 }, { 4, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+};
+
+static const VLC_TYPE huff_vlc_table_4[256][2] = {
+    { 15, 8 }, { 11, 8 }, { 14, 7 }, { 14, 7 },
+    { 13, 6 }, { 13, 6 }, { 13, 6 }, { 13, 6 },
+    { 7, 7 }, { 7, 7 }, { 3, 7 }, { 3, 7 },
+    { 12, 7 }, { 12, 7 }, { 10, 7 }, { 10, 7 },
+    { 6, 6 }, { 6, 6 }, { 6, 6 }, { 6, 6 },
+    { 9, 6 }, { 9, 6 }, { 9, 6 }, { 9, 6 },
+    { 2, 6 }, { 2, 6 }, { 2, 6 }, { 2, 6 },
+    { 8, 6 }, { 8, 6 }, { 8, 6 }, { 8, 6 },
+    { 5, 3 }, { 5, 3 }, { 5, 3 }, { 5, 3 },
+    { 5, 3 }, { 5, 3 }, { 5, 3 }, { 5, 3 },
+    { 5, 3 }, { 5, 3 }, { 5, 3 }, { 5, 3 },
+    { 5, 3 }, { 5, 3 }, { 5, 3 }, { 5, 3 },
+    { 5, 3 }, { 5, 3 }, { 5, 3 }, { 5, 3 },
+    { 5, 3 }, { 5, 3 }, { 5, 3 }, { 5, 3 },
+    { 5, 3 }, { 5, 3 }, { 5, 3 }, { 5, 3 },
+    { 5, 3 }, { 5, 3 }, { 5, 3 }, { 5, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_5[256][2] = {
+    { 15, 7 }, { 15, 7 }, { 3, 7 }, { 3, 7 },
+    { 11, 6 }, { 11, 6 }, { 11, 6 }, { 11, 6 },
+    { 14, 6 }, { 14, 6 }, { 14, 6 }, { 14, 6 },
+    { 12, 6 }, { 12, 6 }, { 12, 6 }, { 12, 6 },
+    { 7, 5 }, { 7, 5 }, { 7, 5 }, { 7, 5 },
+    { 7, 5 }, { 7, 5 }, { 7, 5 }, { 7, 5 },
+    { 13, 5 }, { 13, 5 }, { 13, 5 }, { 13, 5 },
+    { 13, 5 }, { 13, 5 }, { 13, 5 }, { 13, 5 },
+    { 10, 5 }, { 10, 5 }, { 10, 5 }, { 10, 5 },
+    { 10, 5 }, { 10, 5 }, { 10, 5 }, { 10, 5 },
+    { 2, 5 }, { 2, 5 }, { 2, 5 }, { 2, 5 },
+    { 2, 5 }, { 2, 5 }, { 2, 5 }, { 2, 5 },
+    { 6, 4 }, { 6, 4 }, { 6, 4 }, { 6, 4 },
+    { 6, 4 }, { 6, 4 }, { 6, 4 }, { 6, 4 },
+    { 6, 4 }, { 6, 4 }, { 6, 4 }, { 6, 4 },
+    { 6, 4 }, { 6, 4 }, { 6, 4 }, { 6, 4 },
+    { 9, 4 }, { 9, 4 }, { 9, 4 }, { 9, 4 },
+    { 9, 4 }, { 9, 4 }, { 9, 4 }, { 9, 4 },
+    { 9, 4 }, { 9, 4 }, { 9, 4 }, { 9, 4 },
+    { 9, 4 }, { 9, 4 }, { 9, 4 }, { 9, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 5, 2 }, { 5, 2 }, { 5, 2 }, { 5, 2 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 4, 3 }, { 4, 3 }, { 4, 3 }, { 4, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+};
+
+static const VLC_TYPE huff_vlc_table_6[268][2] = {
+    { 256, -2 }, { 260, -1 }, { 262, -1 }, { 11, 8 },
+    { 31, 8 }, { 264, -1 }, { 30, 8 }, { 266, -1 },
+    { 16, 8 }, { 26, 8 }, { 10, 7 }, { 10, 7 },
+    { 25, 7 }, { 25, 7 }, { 24, 7 }, { 24, 7 },
+    { 4, 8 }, { 15, 8 }, { 20, 8 }, { 3, 8 },
+    { 9, 7 }, { 9, 7 }, { 19, 7 }, { 19, 7 },
+    { 18, 7 }, { 18, 7 }, { 14, 7 }, { 14, 7 },
+    { 8, 6 }, { 8, 6 }, { 8, 6 }, { 8, 6 },
+    { 13, 5 }, { 13, 5 }, { 13, 5 }, { 13, 5 },
+    { 13, 5 }, { 13, 5 }, { 13, 5 }, { 13, 5 },
+    { 2, 6 }, { 2, 6 }, { 2, 6 }, { 2, 6 },
+    { 12, 6 }, { 12, 6 }, { 12, 6 }, { 12, 6 },
+    { 7, 4 }, { 7, 4 }, { 7, 4 }, { 7, 4 },
+    { 7, 4 }, { 7, 4 }, { 7, 4 }, { 7, 4 },
+    { 7, 4 }, { 7, 4 }, { 7, 4 }, { 7, 4 },
+    { 7, 4 }, { 7, 4 }, { 7, 4 }, { 7, 4 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 35, 2 }, { 29, 2 }, { 34, 2 }, { 33, 2 },
+    { 23, 1 }, { 28, 1 }, { 17, 1 }, { 32, 1 },
+    { 5, 1 }, { 22, 1 }, { 27, 1 }, { 21, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_7[274][2] = {
+    { 256, -3 }, { 264, -2 }, { 268, -1 }, { 11, 8 },
+    { 31, 8 }, { 270, -1 }, { 272, -1 }, { 16, 8 },
+    { 26, 8 }, { 10, 8 }, { 25, 7 }, { 25, 7 },
+    { 4, 8 }, { 24, 8 }, { 15, 8 }, { 20, 8 },
+    { 9, 8 }, { 19, 8 }, { 3, 8 }, { 18, 8 },
+    { 14, 6 }, { 14, 6 }, { 14, 6 }, { 14, 6 },
+    { 2, 6 }, { 2, 6 }, { 2, 6 }, { 2, 6 },
+    { 12, 6 }, { 12, 6 }, { 12, 6 }, { 12, 6 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 13, 4 }, { 13, 4 }, { 13, 4 }, { 13, 4 },
+    { 13, 4 }, { 13, 4 }, { 13, 4 }, { 13, 4 },
+    { 13, 4 }, { 13, 4 }, { 13, 4 }, { 13, 4 },
+    { 13, 4 }, { 13, 4 }, { 13, 4 }, { 13, 4 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 7, 2 }, { 7, 2 }, { 7, 2 }, { 7, 2 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 35, 3 }, { 34, 3 }, { 29, 2 }, { 29, 2 },
+    { 33, 1 }, { 33, 1 }, { 33, 1 }, { 33, 1 },
+    { 23, 2 }, { 28, 2 }, { 17, 1 }, { 17, 1 },
+    { 32, 1 }, { 5, 1 }, { 22, 1 }, { 27, 1 },
+    { 30, 1 }, { 21, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_8[260][2] = {
+    { 256, -1 }, { 23, 8 }, { 33, 8 }, { 258, -1 },
+    { 28, 8 }, { 17, 8 }, { 32, 8 }, { 11, 8 },
+    { 31, 7 }, { 31, 7 }, { 22, 7 }, { 22, 7 },
+    { 27, 7 }, { 27, 7 }, { 30, 8 }, { 4, 8 },
+    { 16, 7 }, { 16, 7 }, { 26, 7 }, { 26, 7 },
+    { 21, 7 }, { 21, 7 }, { 24, 7 }, { 24, 7 },
+    { 10, 6 }, { 10, 6 }, { 10, 6 }, { 10, 6 },
+    { 25, 6 }, { 25, 6 }, { 25, 6 }, { 25, 6 },
+    { 15, 6 }, { 15, 6 }, { 15, 6 }, { 15, 6 },
+    { 20, 6 }, { 20, 6 }, { 20, 6 }, { 20, 6 },
+    { 9, 5 }, { 9, 5 }, { 9, 5 }, { 9, 5 },
+    { 9, 5 }, { 9, 5 }, { 9, 5 }, { 9, 5 },
+    { 19, 5 }, { 19, 5 }, { 19, 5 }, { 19, 5 },
+    { 19, 5 }, { 19, 5 }, { 19, 5 }, { 19, 5 },
+    { 3, 6 }, { 3, 6 }, { 3, 6 }, { 3, 6 },
+    { 18, 6 }, { 18, 6 }, { 18, 6 }, { 18, 6 },
+    { 14, 5 }, { 14, 5 }, { 14, 5 }, { 14, 5 },
+    { 14, 5 }, { 14, 5 }, { 14, 5 }, { 14, 5 },
+    { 2, 5 }, { 2, 5 }, { 2, 5 }, { 2, 5 },
+    { 2, 5 }, { 2, 5 }, { 2, 5 }, { 2, 5 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 13, 4 }, { 13, 4 }, { 13, 4 }, { 13, 4 },
+    { 13, 4 }, { 13, 4 }, { 13, 4 }, { 13, 4 },
+    { 13, 4 }, { 13, 4 }, { 13, 4 }, { 13, 4 },
+    { 13, 4 }, { 13, 4 }, { 13, 4 }, { 13, 4 },
+    { 12, 4 }, { 12, 4 }, { 12, 4 }, { 12, 4 },
+    { 12, 4 }, { 12, 4 }, { 12, 4 }, { 12, 4 },
+    { 12, 4 }, { 12, 4 }, { 12, 4 }, { 12, 4 },
+    { 12, 4 }, { 12, 4 }, { 12, 4 }, { 12, 4 },
+    { 7, 3 }, { 7, 3 }, { 7, 3 }, { 7, 3 },
+    { 7, 3 }, { 7, 3 }, { 7, 3 }, { 7, 3 },
+    { 7, 3 }, { 7, 3 }, { 7, 3 }, { 7, 3 },
+    { 7, 3 }, { 7, 3 }, { 7, 3 }, { 7, 3 },
+    { 7, 3 }, { 7, 3 }, { 7, 3 }, { 7, 3 },
+    { 7, 3 }, { 7, 3 }, { 7, 3 }, { 7, 3 },
+    { 7, 3 }, { 7, 3 }, { 7, 3 }, { 7, 3 },
+    { 7, 3 }, { 7, 3 }, { 7, 3 }, { 7, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 6, 3 }, { 6, 3 }, { 6, 3 }, { 6, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 35, 1 }, { 29, 1 }, { 34, 1 }, { 5, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_9[306][2] = {
+    { 256, -3 }, { 264, -2 }, { 268, -3 }, { 276, -1 },
+    { 278, -2 }, { 282, -2 }, { 286, -2 }, { 15, 8 },
+    { 57, 8 }, { 290, -1 }, { 292, -2 }, { 296, -2 },
+    { 14, 8 }, { 49, 8 }, { 48, 8 }, { 300, -1 },
+    { 302, -1 }, { 304, -1 }, { 12, 8 }, { 33, 8 },
+    { 32, 8 }, { 19, 8 }, { 26, 8 }, { 3, 8 },
+    { 11, 7 }, { 11, 7 }, { 25, 7 }, { 25, 7 },
+    { 24, 7 }, { 24, 7 }, { 18, 7 }, { 18, 7 },
+    { 10, 6 }, { 10, 6 }, { 10, 6 }, { 10, 6 },
+    { 17, 6 }, { 17, 6 }, { 17, 6 }, { 17, 6 },
+    { 2, 6 }, { 2, 6 }, { 2, 6 }, { 2, 6 },
+    { 16, 6 }, { 16, 6 }, { 16, 6 }, { 16, 6 },
+    { 9, 4 }, { 9, 4 }, { 9, 4 }, { 9, 4 },
+    { 9, 4 }, { 9, 4 }, { 9, 4 }, { 9, 4 },
+    { 9, 4 }, { 9, 4 }, { 9, 4 }, { 9, 4 },
+    { 9, 4 }, { 9, 4 }, { 9, 4 }, { 9, 4 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 63, 3 }, { 55, 3 }, { 62, 3 }, { 47, 3 },
+    { 61, 3 }, { 54, 3 }, { 39, 2 }, { 39, 2 },
+    { 60, 2 }, { 46, 2 }, { 53, 2 }, { 31, 2 },
+    { 59, 2 }, { 59, 2 }, { 38, 2 }, { 38, 2 },
+    { 45, 3 }, { 44, 3 }, { 51, 2 }, { 51, 2 },
+    { 23, 1 }, { 58, 1 }, { 52, 2 }, { 7, 2 },
+    { 56, 1 }, { 56, 1 }, { 50, 1 }, { 50, 1 },
+    { 37, 2 }, { 29, 2 }, { 6, 1 }, { 6, 1 },
+    { 43, 2 }, { 36, 2 }, { 30, 1 }, { 22, 1 },
+    { 21, 2 }, { 42, 2 }, { 13, 1 }, { 13, 1 },
+    { 41, 1 }, { 41, 1 }, { 28, 2 }, { 35, 2 },
+    { 5, 1 }, { 40, 1 }, { 20, 1 }, { 34, 1 },
+    { 27, 1 }, { 4, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_10[286][2] = {
+    { 256, -2 }, { 260, -3 }, { 268, -2 }, { 272, -1 },
+    { 274, -2 }, { 23, 8 }, { 58, 8 }, { 278, -1 },
+    { 57, 7 }, { 57, 7 }, { 15, 8 }, { 56, 8 },
+    { 30, 8 }, { 51, 8 }, { 48, 8 }, { 280, -1 },
+    { 282, -1 }, { 13, 8 }, { 50, 7 }, { 50, 7 },
+    { 22, 8 }, { 6, 8 }, { 14, 7 }, { 14, 7 },
+    { 49, 7 }, { 49, 7 }, { 41, 8 }, { 28, 8 },
+    { 40, 8 }, { 284, -1 }, { 20, 8 }, { 34, 8 },
+    { 12, 8 }, { 33, 8 }, { 4, 8 }, { 32, 8 },
+    { 19, 7 }, { 19, 7 }, { 26, 7 }, { 26, 7 },
+    { 11, 6 }, { 11, 6 }, { 11, 6 }, { 11, 6 },
+    { 25, 6 }, { 25, 6 }, { 25, 6 }, { 25, 6 },
+    { 3, 7 }, { 3, 7 }, { 24, 7 }, { 24, 7 },
+    { 18, 6 }, { 18, 6 }, { 18, 6 }, { 18, 6 },
+    { 17, 5 }, { 17, 5 }, { 17, 5 }, { 17, 5 },
+    { 17, 5 }, { 17, 5 }, { 17, 5 }, { 17, 5 },
+    { 10, 4 }, { 10, 4 }, { 10, 4 }, { 10, 4 },
+    { 10, 4 }, { 10, 4 }, { 10, 4 }, { 10, 4 },
+    { 10, 4 }, { 10, 4 }, { 10, 4 }, { 10, 4 },
+    { 10, 4 }, { 10, 4 }, { 10, 4 }, { 10, 4 },
+    { 2, 5 }, { 2, 5 }, { 2, 5 }, { 2, 5 },
+    { 2, 5 }, { 2, 5 }, { 2, 5 }, { 2, 5 },
+    { 16, 5 }, { 16, 5 }, { 16, 5 }, { 16, 5 },
+    { 16, 5 }, { 16, 5 }, { 16, 5 }, { 16, 5 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 0, 2 }, { 0, 2 }, { 0, 2 }, { 0, 2 },
+    { 63, 2 }, { 55, 2 }, { 62, 2 }, { 61, 2 },
+    { 54, 2 }, { 54, 2 }, { 39, 2 }, { 39, 2 },
+    { 60, 2 }, { 60, 2 }, { 47, 3 }, { 45, 3 },
+    { 46, 2 }, { 53, 2 }, { 31, 1 }, { 31, 1 },
+    { 59, 1 }, { 38, 1 }, { 37, 2 }, { 44, 2 },
+    { 29, 2 }, { 43, 2 }, { 52, 1 }, { 7, 1 },
+    { 36, 1 }, { 21, 1 }, { 42, 1 }, { 5, 1 },
+    { 35, 1 }, { 27, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_11[272][2] = {
+    { 256, -2 }, { 260, -1 }, { 262, -1 }, { 264, -1 },
+    { 46, 8 }, { 31, 8 }, { 266, -1 }, { 23, 8 },
+    { 58, 8 }, { 38, 8 }, { 52, 8 }, { 15, 8 },
+    { 57, 8 }, { 268, -1 }, { 30, 8 }, { 51, 8 },
+    { 37, 8 }, { 44, 8 }, { 36, 8 }, { 270, -1 },
+    { 22, 7 }, { 22, 7 }, { 50, 7 }, { 50, 7 },
+    { 49, 7 }, { 49, 7 }, { 14, 8 }, { 48, 8 },
+    { 29, 8 }, { 43, 8 }, { 21, 8 }, { 42, 8 },
+    { 13, 7 }, { 13, 7 }, { 41, 7 }, { 41, 7 },
+    { 28, 7 }, { 28, 7 }, { 35, 7 }, { 35, 7 },
+    { 40, 8 }, { 4, 8 }, { 20, 7 }, { 20, 7 },
+    { 34, 7 }, { 34, 7 }, { 12, 7 }, { 12, 7 },
+    { 27, 6 }, { 27, 6 }, { 27, 6 }, { 27, 6 },
+    { 33, 6 }, { 33, 6 }, { 33, 6 }, { 33, 6 },
+    { 19, 6 }, { 19, 6 }, { 19, 6 }, { 19, 6 },
+    { 26, 6 }, { 26, 6 }, { 26, 6 }, { 26, 6 },
+    { 32, 7 }, { 32, 7 }, { 3, 7 }, { 3, 7 },
+    { 24, 6 }, { 24, 6 }, { 24, 6 }, { 24, 6 },
+    { 11, 5 }, { 11, 5 }, { 11, 5 }, { 11, 5 },
+    { 11, 5 }, { 11, 5 }, { 11, 5 }, { 11, 5 },
+    { 25, 5 }, { 25, 5 }, { 25, 5 }, { 25, 5 },
+    { 25, 5 }, { 25, 5 }, { 25, 5 }, { 25, 5 },
+    { 18, 5 }, { 18, 5 }, { 18, 5 }, { 18, 5 },
+    { 18, 5 }, { 18, 5 }, { 18, 5 }, { 18, 5 },
+    { 10, 4 }, { 10, 4 }, { 10, 4 }, { 10, 4 },
+    { 10, 4 }, { 10, 4 }, { 10, 4 }, { 10, 4 },
+    { 10, 4 }, { 10, 4 }, { 10, 4 }, { 10, 4 },
+    { 10, 4 }, { 10, 4 }, { 10, 4 }, { 10, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 2, 5 }, { 2, 5 }, { 2, 5 }, { 2, 5 },
+    { 2, 5 }, { 2, 5 }, { 2, 5 }, { 2, 5 },
+    { 16, 5 }, { 16, 5 }, { 16, 5 }, { 16, 5 },
+    { 16, 5 }, { 16, 5 }, { 16, 5 }, { 16, 5 },
+    { 0, 4 }, { 0, 4 }, { 0, 4 }, { 0, 4 },
+    { 0, 4 }, { 0, 4 }, { 0, 4 }, { 0, 4 },
+    { 0, 4 }, { 0, 4 }, { 0, 4 }, { 0, 4 },
+    { 0, 4 }, { 0, 4 }, { 0, 4 }, { 0, 4 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 9, 3 }, { 9, 3 }, { 9, 3 }, { 9, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 1, 3 }, { 1, 3 }, { 1, 3 }, { 1, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 8, 3 }, { 8, 3 }, { 8, 3 }, { 8, 3 },
+    { 63, 2 }, { 55, 2 }, { 62, 1 }, { 62, 1 },
+    { 47, 1 }, { 61, 1 }, { 54, 1 }, { 39, 1 },
+    { 60, 1 }, { 53, 1 }, { 59, 1 }, { 45, 1 },
+    { 7, 1 }, { 56, 1 }, { 6, 1 }, { 5, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_12[732][2] = {
+    { 256, -8 }, { 522, -5 }, { 554, -5 }, { 586, -4 },
+    { 602, -4 }, { 618, -4 }, { 634, -3 }, { 642, -3 },
+    { 650, -3 }, { 658, -3 }, { 666, -3 }, { 674, -3 },
+    { 682, -1 }, { 684, -2 }, { 688, -3 }, { 696, -1 },
+    { 698, -2 }, { 702, -2 }, { 706, -2 }, { 710, -2 },
+    { 129, 8 }, { 714, -1 }, { 716, -1 }, { 718, -1 },
+    { 720, -2 }, { 724, -1 }, { 21, 8 }, { 81, 8 },
+    { 726, -1 }, { 728, -1 }, { 730, -1 }, { 20, 8 },
+    { 65, 7 }, { 65, 7 }, { 4, 8 }, { 64, 8 },
+    { 35, 8 }, { 50, 8 }, { 19, 7 }, { 19, 7 },
+    { 49, 7 }, { 49, 7 }, { 3, 7 }, { 3, 7 },
+    { 48, 7 }, { 48, 7 }, { 34, 7 }, { 34, 7 },
+    { 18, 6 }, { 18, 6 }, { 18, 6 }, { 18, 6 },
+    { 33, 6 }, { 33, 6 }, { 33, 6 }, { 33, 6 },
+    { 2, 6 }, { 2, 6 }, { 2, 6 }, { 2, 6 },
+    { 32, 6 }, { 32, 6 }, { 32, 6 }, { 32, 6 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 512, -3 }, { 255, 8 }, { 239, 8 }, { 223, 8 },
+    { 238, 8 }, { 207, 8 }, { 222, 8 }, { 191, 8 },
+    { 251, 8 }, { 206, 8 }, { 220, 8 }, { 520, -1 },
+    { 236, 7 }, { 236, 7 }, { 221, 7 }, { 221, 7 },
+    { 250, 8 }, { 205, 8 }, { 190, 7 }, { 190, 7 },
+    { 235, 7 }, { 235, 7 }, { 159, 7 }, { 159, 7 },
+    { 249, 7 }, { 249, 7 }, { 234, 7 }, { 234, 7 },
+    { 189, 7 }, { 189, 7 }, { 219, 7 }, { 219, 7 },
+    { 143, 7 }, { 143, 7 }, { 248, 7 }, { 248, 7 },
+    { 204, 7 }, { 204, 7 }, { 174, 8 }, { 158, 8 },
+    { 142, 7 }, { 142, 7 }, { 127, 8 }, { 126, 8 },
+    { 247, 6 }, { 247, 6 }, { 247, 6 }, { 247, 6 },
+    { 218, 6 }, { 218, 6 }, { 218, 6 }, { 218, 6 },
+    { 173, 7 }, { 173, 7 }, { 188, 7 }, { 188, 7 },
+    { 203, 7 }, { 203, 7 }, { 246, 7 }, { 246, 7 },
+    { 111, 6 }, { 111, 6 }, { 111, 6 }, { 111, 6 },
+    { 232, 6 }, { 232, 6 }, { 232, 6 }, { 232, 6 },
+    { 95, 6 }, { 95, 6 }, { 95, 6 }, { 95, 6 },
+    { 157, 6 }, { 157, 6 }, { 157, 6 }, { 157, 6 },
+    { 217, 6 }, { 217, 6 }, { 217, 6 }, { 217, 6 },
+    { 245, 6 }, { 245, 6 }, { 245, 6 }, { 245, 6 },
+    { 231, 6 }, { 231, 6 }, { 231, 6 }, { 231, 6 },
+    { 172, 6 }, { 172, 6 }, { 172, 6 }, { 172, 6 },
+    { 187, 6 }, { 187, 6 }, { 187, 6 }, { 187, 6 },
+    { 79, 6 }, { 79, 6 }, { 79, 6 }, { 79, 6 },
+    { 244, 6 }, { 244, 6 }, { 244, 6 }, { 244, 6 },
+    { 202, 7 }, { 202, 7 }, { 230, 7 }, { 230, 7 },
+    { 243, 6 }, { 243, 6 }, { 243, 6 }, { 243, 6 },
+    { 63, 5 }, { 63, 5 }, { 63, 5 }, { 63, 5 },
+    { 63, 5 }, { 63, 5 }, { 63, 5 }, { 63, 5 },
+    { 141, 6 }, { 141, 6 }, { 141, 6 }, { 141, 6 },
+    { 216, 6 }, { 216, 6 }, { 216, 6 }, { 216, 6 },
+    { 47, 5 }, { 47, 5 }, { 47, 5 }, { 47, 5 },
+    { 47, 5 }, { 47, 5 }, { 47, 5 }, { 47, 5 },
+    { 242, 5 }, { 242, 5 }, { 242, 5 }, { 242, 5 },
+    { 242, 5 }, { 242, 5 }, { 242, 5 }, { 242, 5 },
+    { 110, 6 }, { 110, 6 }, { 110, 6 }, { 110, 6 },
+    { 156, 6 }, { 156, 6 }, { 156, 6 }, { 156, 6 },
+    { 15, 5 }, { 15, 5 }, { 15, 5 }, { 15, 5 },
+    { 15, 5 }, { 15, 5 }, { 15, 5 }, { 15, 5 },
+    { 201, 6 }, { 201, 6 }, { 201, 6 }, { 201, 6 },
+    { 94, 6 }, { 94, 6 }, { 94, 6 }, { 94, 6 },
+    { 171, 5 }, { 171, 5 }, { 171, 5 }, { 171, 5 },
+    { 171, 5 }, { 171, 5 }, { 171, 5 }, { 171, 5 },
+    { 125, 6 }, { 125, 6 }, { 125, 6 }, { 125, 6 },
+    { 215, 6 }, { 215, 6 }, { 215, 6 }, { 215, 6 },
+    { 78, 5 }, { 78, 5 }, { 78, 5 }, { 78, 5 },
+    { 78, 5 }, { 78, 5 }, { 78, 5 }, { 78, 5 },
+    { 200, 6 }, { 200, 6 }, { 200, 6 }, { 200, 6 },
+    { 214, 6 }, { 214, 6 }, { 214, 6 }, { 214, 6 },
+    { 62, 5 }, { 62, 5 }, { 62, 5 }, { 62, 5 },
+    { 62, 5 }, { 62, 5 }, { 62, 5 }, { 62, 5 },
+    { 185, 5 }, { 185, 5 }, { 185, 5 }, { 185, 5 },
+    { 185, 5 }, { 185, 5 }, { 185, 5 }, { 185, 5 },
+    { 155, 6 }, { 155, 6 }, { 155, 6 }, { 155, 6 },
+    { 170, 6 }, { 170, 6 }, { 170, 6 }, { 170, 6 },
+    { 31, 4 }, { 31, 4 }, { 31, 4 }, { 31, 4 },
+    { 31, 4 }, { 31, 4 }, { 31, 4 }, { 31, 4 },
+    { 31, 4 }, { 31, 4 }, { 31, 4 }, { 31, 4 },
+    { 31, 4 }, { 31, 4 }, { 31, 4 }, { 31, 4 },
+    { 241, 4 }, { 241, 4 }, { 241, 4 }, { 241, 4 },
+    { 241, 4 }, { 241, 4 }, { 241, 4 }, { 241, 4 },
+    { 241, 4 }, { 241, 4 }, { 241, 4 }, { 241, 4 },
+    { 241, 4 }, { 241, 4 }, { 241, 4 }, { 241, 4 },
+    { 254, 3 }, { 252, 3 }, { 253, 2 }, { 253, 2 },
+    { 237, 1 }, { 237, 1 }, { 237, 1 }, { 237, 1 },
+    { 175, 1 }, { 233, 1 }, { 240, 4 }, { 240, 4 },
+    { 186, 5 }, { 229, 5 }, { 228, 5 }, { 140, 5 },
+    { 109, 5 }, { 227, 5 }, { 226, 4 }, { 226, 4 },
+    { 46, 5 }, { 14, 5 }, { 30, 4 }, { 30, 4 },
+    { 225, 4 }, { 225, 4 }, { 224, 5 }, { 93, 5 },
+    { 213, 5 }, { 124, 5 }, { 199, 5 }, { 77, 5 },
+    { 139, 5 }, { 184, 5 }, { 212, 5 }, { 154, 5 },
+    { 169, 5 }, { 108, 5 }, { 198, 4 }, { 198, 4 },
+    { 61, 4 }, { 61, 4 }, { 211, 5 }, { 123, 5 },
+    { 45, 4 }, { 45, 4 }, { 210, 4 }, { 210, 4 },
+    { 29, 4 }, { 29, 4 }, { 183, 4 }, { 183, 4 },
+    { 92, 5 }, { 197, 5 }, { 153, 5 }, { 122, 5 },
+    { 195, 4 }, { 195, 4 }, { 167, 5 }, { 151, 5 },
+    { 75, 4 }, { 75, 4 }, { 209, 3 }, { 209, 3 },
+    { 209, 3 }, { 209, 3 }, { 13, 4 }, { 13, 4 },
+    { 208, 4 }, { 208, 4 }, { 138, 4 }, { 138, 4 },
+    { 168, 4 }, { 168, 4 }, { 76, 4 }, { 196, 4 },
+    { 107, 4 }, { 182, 4 }, { 60, 3 }, { 60, 3 },
+    { 44, 3 }, { 44, 3 }, { 194, 3 }, { 194, 3 },
+    { 91, 3 }, { 91, 3 }, { 181, 4 }, { 137, 4 },
+    { 28, 3 }, { 28, 3 }, { 193, 3 }, { 193, 3 },
+    { 152, 4 }, { 12, 4 }, { 192, 3 }, { 192, 3 },
+    { 180, 4 }, { 106, 4 }, { 166, 4 }, { 121, 4 },
+    { 59, 3 }, { 59, 3 }, { 179, 3 }, { 179, 3 },
+    { 136, 4 }, { 90, 4 }, { 43, 3 }, { 43, 3 },
+    { 165, 4 }, { 105, 4 }, { 164, 3 }, { 164, 3 },
+    { 120, 4 }, { 135, 4 }, { 148, 3 }, { 148, 3 },
+    { 119, 4 }, { 118, 4 }, { 178, 2 }, { 178, 2 },
+    { 178, 2 }, { 178, 2 }, { 27, 2 }, { 27, 2 },
+    { 177, 2 }, { 177, 2 }, { 11, 3 }, { 176, 3 },
+    { 150, 3 }, { 74, 3 }, { 58, 3 }, { 163, 3 },
+    { 89, 3 }, { 149, 3 }, { 42, 2 }, { 42, 2 },
+    { 162, 2 }, { 162, 2 }, { 26, 2 }, { 26, 2 },
+    { 161, 2 }, { 161, 2 }, { 10, 3 }, { 104, 3 },
+    { 160, 2 }, { 160, 2 }, { 134, 3 }, { 73, 3 },
+    { 147, 2 }, { 147, 2 }, { 57, 3 }, { 88, 3 },
+    { 133, 3 }, { 103, 3 }, { 41, 2 }, { 41, 2 },
+    { 146, 2 }, { 146, 2 }, { 87, 3 }, { 117, 3 },
+    { 56, 2 }, { 56, 2 }, { 131, 2 }, { 131, 2 },
+    { 102, 3 }, { 71, 3 }, { 116, 3 }, { 86, 3 },
+    { 101, 3 }, { 115, 3 }, { 25, 1 }, { 145, 1 },
+    { 9, 2 }, { 144, 2 }, { 72, 2 }, { 132, 2 },
+    { 114, 2 }, { 114, 2 }, { 70, 3 }, { 100, 3 },
+    { 40, 1 }, { 40, 1 }, { 40, 1 }, { 40, 1 },
+    { 130, 1 }, { 24, 1 }, { 55, 2 }, { 39, 2 },
+    { 23, 1 }, { 23, 1 }, { 113, 1 }, { 113, 1 },
+    { 85, 2 }, { 7, 2 }, { 112, 2 }, { 54, 2 },
+    { 99, 2 }, { 69, 2 }, { 84, 2 }, { 38, 2 },
+    { 98, 2 }, { 53, 2 }, { 8, 1 }, { 128, 1 },
+    { 22, 1 }, { 97, 1 }, { 6, 1 }, { 96, 1 },
+    { 83, 2 }, { 68, 2 }, { 37, 1 }, { 37, 1 },
+    { 82, 1 }, { 5, 1 }, { 52, 1 }, { 67, 1 },
+    { 80, 1 }, { 36, 1 }, { 66, 1 }, { 51, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_13[534][2] = {
+    { 256, -5 }, { 288, -5 }, { 320, -4 }, { 336, -4 },
+    { 352, -4 }, { 368, -3 }, { 376, -3 }, { 384, -4 },
+    { 400, -3 }, { 408, -3 }, { 416, -3 }, { 424, -3 },
+    { 432, -2 }, { 436, -3 }, { 444, -3 }, { 452, -2 },
+    { 456, -2 }, { 460, -2 }, { 464, -2 }, { 468, -2 },
+    { 472, -2 }, { 476, -2 }, { 480, -2 }, { 484, -2 },
+    { 488, -1 }, { 490, -1 }, { 492, -1 }, { 494, -2 },
+    { 498, -1 }, { 500, -1 }, { 502, -2 }, { 506, -1 },
+    { 508, -1 }, { 510, -1 }, { 145, 8 }, { 512, -1 },
+    { 514, -1 }, { 516, -1 }, { 518, -1 }, { 520, -1 },
+    { 40, 8 }, { 130, 8 }, { 24, 8 }, { 129, 8 },
+    { 522, -1 }, { 524, -1 }, { 526, -1 }, { 528, -1 },
+    { 39, 8 }, { 114, 8 }, { 100, 8 }, { 23, 8 },
+    { 85, 8 }, { 113, 8 }, { 530, -1 }, { 54, 8 },
+    { 99, 8 }, { 69, 8 }, { 84, 8 }, { 38, 8 },
+    { 98, 8 }, { 22, 8 }, { 532, -1 }, { 53, 8 },
+    { 97, 7 }, { 97, 7 }, { 83, 8 }, { 68, 8 },
+    { 37, 7 }, { 37, 7 }, { 82, 7 }, { 82, 7 },
+    { 21, 7 }, { 21, 7 }, { 81, 7 }, { 81, 7 },
+    { 5, 8 }, { 80, 8 }, { 52, 7 }, { 52, 7 },
+    { 67, 7 }, { 67, 7 }, { 36, 7 }, { 36, 7 },
+    { 66, 7 }, { 66, 7 }, { 51, 7 }, { 51, 7 },
+    { 65, 6 }, { 65, 6 }, { 65, 6 }, { 65, 6 },
+    { 20, 7 }, { 20, 7 }, { 4, 7 }, { 4, 7 },
+    { 35, 6 }, { 35, 6 }, { 35, 6 }, { 35, 6 },
+    { 50, 6 }, { 50, 6 }, { 50, 6 }, { 50, 6 },
+    { 64, 7 }, { 64, 7 }, { 3, 7 }, { 3, 7 },
+    { 19, 6 }, { 19, 6 }, { 19, 6 }, { 19, 6 },
+    { 49, 6 }, { 49, 6 }, { 49, 6 }, { 49, 6 },
+    { 48, 6 }, { 48, 6 }, { 48, 6 }, { 48, 6 },
+    { 34, 5 }, { 34, 5 }, { 34, 5 }, { 34, 5 },
+    { 34, 5 }, { 34, 5 }, { 34, 5 }, { 34, 5 },
+    { 18, 5 }, { 18, 5 }, { 18, 5 }, { 18, 5 },
+    { 18, 5 }, { 18, 5 }, { 18, 5 }, { 18, 5 },
+    { 33, 5 }, { 33, 5 }, { 33, 5 }, { 33, 5 },
+    { 33, 5 }, { 33, 5 }, { 33, 5 }, { 33, 5 },
+    { 2, 5 }, { 2, 5 }, { 2, 5 }, { 2, 5 },
+    { 2, 5 }, { 2, 5 }, { 2, 5 }, { 2, 5 },
+    { 32, 5 }, { 32, 5 }, { 32, 5 }, { 32, 5 },
+    { 32, 5 }, { 32, 5 }, { 32, 5 }, { 32, 5 },
+    { 17, 3 }, { 17, 3 }, { 17, 3 }, { 17, 3 },
+    { 17, 3 }, { 17, 3 }, { 17, 3 }, { 17, 3 },
+    { 17, 3 }, { 17, 3 }, { 17, 3 }, { 17, 3 },
+    { 17, 3 }, { 17, 3 }, { 17, 3 }, { 17, 3 },
+    { 17, 3 }, { 17, 3 }, { 17, 3 }, { 17, 3 },
+    { 17, 3 }, { 17, 3 }, { 17, 3 }, { 17, 3 },
+    { 17, 3 }, { 17, 3 }, { 17, 3 }, { 17, 3 },
+    { 17, 3 }, { 17, 3 }, { 17, 3 }, { 17, 3 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 16, 4 }, { 16, 4 }, { 16, 4 }, { 16, 4 },
+    { 16, 4 }, { 16, 4 }, { 16, 4 }, { 16, 4 },
+    { 16, 4 }, { 16, 4 }, { 16, 4 }, { 16, 4 },
+    { 16, 4 }, { 16, 4 }, { 16, 4 }, { 16, 4 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 0, 3 }, { 0, 3 }, { 0, 3 }, { 0, 3 },
+    { 255, 5 }, { 239, 5 }, { 254, 5 }, { 223, 5 },
+    { 238, 4 }, { 238, 4 }, { 253, 5 }, { 207, 5 },
+    { 252, 5 }, { 222, 5 }, { 237, 5 }, { 191, 5 },
+    { 251, 4 }, { 251, 4 }, { 206, 5 }, { 236, 5 },
+    { 221, 4 }, { 221, 4 }, { 175, 4 }, { 175, 4 },
+    { 250, 4 }, { 250, 4 }, { 190, 4 }, { 190, 4 },
+    { 235, 4 }, { 235, 4 }, { 205, 4 }, { 205, 4 },
+    { 220, 4 }, { 220, 4 }, { 159, 4 }, { 159, 4 },
+    { 249, 4 }, { 249, 4 }, { 234, 4 }, { 234, 4 },
+    { 189, 4 }, { 189, 4 }, { 219, 4 }, { 219, 4 },
+    { 143, 4 }, { 143, 4 }, { 248, 4 }, { 248, 4 },
+    { 204, 4 }, { 204, 4 }, { 158, 4 }, { 158, 4 },
+    { 233, 4 }, { 233, 4 }, { 127, 4 }, { 127, 4 },
+    { 247, 4 }, { 247, 4 }, { 173, 4 }, { 173, 4 },
+    { 218, 4 }, { 218, 4 }, { 188, 4 }, { 188, 4 },
+    { 111, 4 }, { 111, 4 }, { 174, 5 }, { 15, 5 },
+    { 203, 3 }, { 203, 3 }, { 246, 3 }, { 246, 3 },
+    { 142, 4 }, { 232, 4 }, { 95, 4 }, { 157, 4 },
+    { 245, 3 }, { 245, 3 }, { 126, 3 }, { 126, 3 },
+    { 231, 3 }, { 231, 3 }, { 172, 3 }, { 172, 3 },
+    { 202, 3 }, { 202, 3 }, { 187, 3 }, { 187, 3 },
+    { 217, 4 }, { 141, 4 }, { 79, 3 }, { 79, 3 },
+    { 244, 3 }, { 244, 3 }, { 63, 3 }, { 63, 3 },
+    { 243, 3 }, { 243, 3 }, { 216, 3 }, { 216, 3 },
+    { 230, 3 }, { 230, 3 }, { 47, 3 }, { 47, 3 },
+    { 242, 3 }, { 242, 3 }, { 110, 4 }, { 240, 4 },
+    { 31, 3 }, { 31, 3 }, { 241, 3 }, { 241, 3 },
+    { 156, 3 }, { 156, 3 }, { 201, 3 }, { 201, 3 },
+    { 94, 3 }, { 171, 3 }, { 186, 3 }, { 229, 3 },
+    { 125, 3 }, { 215, 3 }, { 78, 3 }, { 228, 3 },
+    { 140, 3 }, { 200, 3 }, { 62, 3 }, { 109, 3 },
+    { 214, 3 }, { 227, 3 }, { 155, 3 }, { 185, 3 },
+    { 46, 3 }, { 46, 3 }, { 170, 3 }, { 170, 3 },
+    { 226, 3 }, { 226, 3 }, { 30, 3 }, { 30, 3 },
+    { 225, 3 }, { 225, 3 }, { 14, 4 }, { 224, 4 },
+    { 93, 3 }, { 93, 3 }, { 213, 3 }, { 213, 3 },
+    { 124, 3 }, { 199, 3 }, { 77, 3 }, { 139, 3 },
+    { 212, 2 }, { 212, 2 }, { 184, 3 }, { 154, 3 },
+    { 169, 3 }, { 108, 3 }, { 198, 3 }, { 61, 3 },
+    { 211, 2 }, { 211, 2 }, { 210, 2 }, { 210, 2 },
+    { 45, 3 }, { 13, 3 }, { 29, 2 }, { 29, 2 },
+    { 123, 2 }, { 123, 2 }, { 183, 2 }, { 183, 2 },
+    { 209, 2 }, { 209, 2 }, { 92, 3 }, { 208, 3 },
+    { 197, 2 }, { 197, 2 }, { 138, 2 }, { 138, 2 },
+    { 168, 2 }, { 76, 2 }, { 196, 2 }, { 107, 2 },
+    { 182, 2 }, { 182, 2 }, { 153, 3 }, { 12, 3 },
+    { 60, 2 }, { 60, 2 }, { 195, 2 }, { 195, 2 },
+    { 122, 2 }, { 122, 2 }, { 167, 2 }, { 167, 2 },
+    { 166, 2 }, { 166, 2 }, { 192, 3 }, { 11, 3 },
+    { 194, 1 }, { 194, 1 }, { 44, 2 }, { 91, 2 },
+    { 181, 2 }, { 28, 2 }, { 137, 2 }, { 152, 2 },
+    { 193, 2 }, { 75, 2 }, { 180, 2 }, { 106, 2 },
+    { 59, 2 }, { 121, 2 }, { 179, 1 }, { 179, 1 },
+    { 151, 2 }, { 136, 2 }, { 43, 2 }, { 90, 2 },
+    { 178, 1 }, { 178, 1 }, { 165, 2 }, { 27, 2 },
+    { 177, 1 }, { 177, 1 }, { 176, 2 }, { 105, 2 },
+    { 150, 2 }, { 74, 2 }, { 164, 2 }, { 120, 2 },
+    { 135, 2 }, { 58, 2 }, { 163, 1 }, { 163, 1 },
+    { 89, 1 }, { 149, 1 }, { 42, 1 }, { 162, 1 },
+    { 26, 1 }, { 161, 1 }, { 10, 2 }, { 160, 2 },
+    { 104, 1 }, { 104, 1 }, { 134, 1 }, { 73, 1 },
+    { 148, 1 }, { 57, 1 }, { 147, 1 }, { 147, 1 },
+    { 119, 2 }, { 9, 2 }, { 88, 1 }, { 133, 1 },
+    { 41, 1 }, { 103, 1 }, { 118, 1 }, { 146, 1 },
+    { 25, 1 }, { 144, 1 }, { 72, 1 }, { 132, 1 },
+    { 87, 1 }, { 117, 1 }, { 56, 1 }, { 131, 1 },
+    { 102, 1 }, { 71, 1 }, { 116, 1 }, { 8, 1 },
+    { 128, 1 }, { 86, 1 }, { 101, 1 }, { 55, 1 },
+    { 115, 1 }, { 70, 1 }, { 7, 1 }, { 112, 1 },
+    { 6, 1 }, { 96, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_14[804][2] = {
+    { 256, -3 }, { 264, -3 }, { 272, -2 }, { 255, 8 },
+    { 276, -2 }, { 280, -1 }, { 282, -8 }, { 242, 8 },
+    { 540, -1 }, { 31, 8 }, { 241, 8 }, { 542, -6 },
+    { 606, -5 }, { 638, -5 }, { 670, -4 }, { 686, -4 },
+    { 702, -4 }, { 718, -3 }, { 726, -3 }, { 734, -3 },
+    { 742, -3 }, { 750, -3 }, { 758, -3 }, { 766, -3 },
+    { 774, -2 }, { 778, -2 }, { 782, -1 }, { 784, -2 },
+    { 788, -2 }, { 792, -1 }, { 81, 8 }, { 794, -1 },
+    { 796, -1 }, { 798, -1 }, { 800, -1 }, { 20, 8 },
+    { 65, 8 }, { 802, -1 }, { 35, 8 }, { 50, 8 },
+    { 19, 7 }, { 19, 7 }, { 49, 7 }, { 49, 7 },
+    { 3, 8 }, { 48, 8 }, { 34, 7 }, { 34, 7 },
+    { 18, 6 }, { 18, 6 }, { 18, 6 }, { 18, 6 },
+    { 33, 6 }, { 33, 6 }, { 33, 6 }, { 33, 6 },
+    { 2, 6 }, { 2, 6 }, { 2, 6 }, { 2, 6 },
+    { 32, 6 }, { 32, 6 }, { 32, 6 }, { 32, 6 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 16, 3 }, { 16, 3 }, { 16, 3 }, { 16, 3 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 239, 3 }, { 254, 3 }, { 223, 3 }, { 253, 3 },
+    { 207, 3 }, { 252, 3 }, { 191, 3 }, { 251, 3 },
+    { 175, 2 }, { 175, 2 }, { 250, 3 }, { 159, 3 },
+    { 249, 3 }, { 248, 3 }, { 143, 2 }, { 143, 2 },
+    { 127, 2 }, { 247, 2 }, { 111, 2 }, { 246, 2 },
+    { 95, 2 }, { 245, 2 }, { 79, 1 }, { 79, 1 },
+    { 244, 1 }, { 243, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 240, 1 }, { 240, 1 },
+    { 240, 1 }, { 240, 1 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 63, 2 }, { 63, 2 },
+    { 63, 2 }, { 63, 2 }, { 206, 8 }, { 538, -1 },
+    { 222, 7 }, { 222, 7 }, { 233, 7 }, { 233, 7 },
+    { 234, 8 }, { 217, 8 }, { 238, 6 }, { 238, 6 },
+    { 238, 6 }, { 238, 6 }, { 237, 7 }, { 237, 7 },
+    { 235, 7 }, { 235, 7 }, { 190, 6 }, { 190, 6 },
+    { 190, 6 }, { 190, 6 }, { 205, 6 }, { 205, 6 },
+    { 205, 6 }, { 205, 6 }, { 220, 7 }, { 220, 7 },
+    { 219, 7 }, { 219, 7 }, { 174, 6 }, { 174, 6 },
+    { 174, 6 }, { 174, 6 }, { 204, 6 }, { 204, 6 },
+    { 204, 6 }, { 204, 6 }, { 173, 7 }, { 173, 7 },
+    { 218, 7 }, { 218, 7 }, { 126, 7 }, { 126, 7 },
+    { 172, 7 }, { 172, 7 }, { 202, 6 }, { 202, 6 },
+    { 202, 6 }, { 202, 6 }, { 201, 7 }, { 201, 7 },
+    { 125, 7 }, { 125, 7 }, { 94, 6 }, { 94, 6 },
+    { 94, 6 }, { 94, 6 }, { 189, 5 }, { 189, 5 },
+    { 189, 5 }, { 189, 5 }, { 189, 5 }, { 189, 5 },
+    { 189, 5 }, { 189, 5 }, { 236, 1 }, { 221, 1 },
+    { 47, 1 }, { 15, 1 }, { 158, 5 }, { 158, 5 },
+    { 188, 6 }, { 203, 6 }, { 142, 6 }, { 232, 6 },
+    { 157, 6 }, { 231, 6 }, { 187, 6 }, { 141, 6 },
+    { 216, 6 }, { 110, 6 }, { 230, 5 }, { 230, 5 },
+    { 156, 5 }, { 156, 5 }, { 171, 6 }, { 186, 6 },
+    { 229, 6 }, { 215, 6 }, { 78, 5 }, { 78, 5 },
+    { 228, 6 }, { 140, 6 }, { 200, 5 }, { 200, 5 },
+    { 62, 5 }, { 62, 5 }, { 109, 5 }, { 109, 5 },
+    { 214, 6 }, { 155, 6 }, { 185, 6 }, { 170, 6 },
+    { 225, 5 }, { 225, 5 }, { 212, 5 }, { 212, 5 },
+    { 184, 6 }, { 169, 6 }, { 123, 5 }, { 123, 5 },
+    { 183, 6 }, { 208, 6 }, { 227, 4 }, { 227, 4 },
+    { 227, 4 }, { 227, 4 }, { 14, 5 }, { 14, 5 },
+    { 224, 5 }, { 224, 5 }, { 93, 5 }, { 93, 5 },
+    { 213, 5 }, { 213, 5 }, { 124, 5 }, { 124, 5 },
+    { 199, 5 }, { 199, 5 }, { 77, 5 }, { 77, 5 },
+    { 139, 5 }, { 139, 5 }, { 154, 5 }, { 108, 5 },
+    { 198, 5 }, { 61, 5 }, { 92, 5 }, { 197, 5 },
+    { 13, 4 }, { 13, 4 }, { 138, 5 }, { 168, 5 },
+    { 153, 5 }, { 76, 5 }, { 182, 5 }, { 122, 5 },
+    { 60, 4 }, { 60, 4 }, { 91, 5 }, { 137, 5 },
+    { 28, 4 }, { 28, 4 }, { 192, 4 }, { 192, 4 },
+    { 152, 5 }, { 121, 5 }, { 226, 3 }, { 226, 3 },
+    { 226, 3 }, { 226, 3 }, { 46, 4 }, { 46, 4 },
+    { 30, 4 }, { 30, 4 }, { 211, 4 }, { 211, 4 },
+    { 45, 4 }, { 45, 4 }, { 210, 4 }, { 210, 4 },
+    { 209, 4 }, { 209, 4 }, { 59, 4 }, { 59, 4 },
+    { 151, 5 }, { 136, 5 }, { 29, 3 }, { 29, 3 },
+    { 29, 3 }, { 29, 3 }, { 196, 4 }, { 196, 4 },
+    { 107, 4 }, { 107, 4 }, { 195, 4 }, { 195, 4 },
+    { 167, 4 }, { 167, 4 }, { 44, 3 }, { 44, 3 },
+    { 44, 3 }, { 44, 3 }, { 194, 4 }, { 194, 4 },
+    { 181, 4 }, { 181, 4 }, { 193, 4 }, { 12, 4 },
+    { 75, 4 }, { 180, 4 }, { 106, 4 }, { 166, 4 },
+    { 179, 3 }, { 179, 3 }, { 90, 4 }, { 165, 4 },
+    { 43, 3 }, { 43, 3 }, { 178, 3 }, { 178, 3 },
+    { 27, 3 }, { 27, 3 }, { 177, 3 }, { 177, 3 },
+    { 11, 4 }, { 176, 4 }, { 105, 4 }, { 150, 4 },
+    { 74, 4 }, { 164, 4 }, { 120, 4 }, { 135, 4 },
+    { 163, 3 }, { 163, 3 }, { 58, 4 }, { 89, 4 },
+    { 42, 3 }, { 42, 3 }, { 149, 4 }, { 104, 4 },
+    { 161, 3 }, { 161, 3 }, { 134, 4 }, { 119, 4 },
+    { 148, 3 }, { 148, 3 }, { 73, 4 }, { 87, 4 },
+    { 103, 3 }, { 103, 3 }, { 162, 2 }, { 162, 2 },
+    { 162, 2 }, { 162, 2 }, { 26, 2 }, { 26, 2 },
+    { 10, 3 }, { 160, 3 }, { 57, 3 }, { 147, 3 },
+    { 88, 3 }, { 133, 3 }, { 41, 2 }, { 41, 2 },
+    { 146, 2 }, { 146, 2 }, { 118, 3 }, { 9, 3 },
+    { 25, 2 }, { 25, 2 }, { 145, 2 }, { 145, 2 },
+    { 144, 3 }, { 72, 3 }, { 132, 3 }, { 117, 3 },
+    { 56, 3 }, { 131, 3 }, { 102, 3 }, { 40, 3 },
+    { 130, 2 }, { 130, 2 }, { 71, 3 }, { 116, 3 },
+    { 24, 2 }, { 24, 2 }, { 129, 2 }, { 129, 2 },
+    { 128, 2 }, { 128, 2 }, { 8, 3 }, { 86, 3 },
+    { 55, 2 }, { 55, 2 }, { 115, 2 }, { 115, 2 },
+    { 101, 3 }, { 70, 3 }, { 39, 2 }, { 39, 2 },
+    { 114, 2 }, { 114, 2 }, { 100, 3 }, { 85, 3 },
+    { 7, 2 }, { 7, 2 }, { 23, 1 }, { 23, 1 },
+    { 23, 1 }, { 23, 1 }, { 113, 1 }, { 113, 1 },
+    { 112, 2 }, { 54, 2 }, { 99, 2 }, { 69, 2 },
+    { 84, 2 }, { 38, 2 }, { 98, 1 }, { 22, 1 },
+    { 97, 1 }, { 97, 1 }, { 6, 2 }, { 96, 2 },
+    { 83, 1 }, { 83, 1 }, { 53, 2 }, { 68, 2 },
+    { 37, 1 }, { 82, 1 }, { 21, 1 }, { 5, 1 },
+    { 52, 1 }, { 67, 1 }, { 80, 1 }, { 36, 1 },
+    { 66, 1 }, { 51, 1 }, { 4, 1 }, { 64, 1 },
+};
+
+static const VLC_TYPE huff_vlc_table_15[470][2] = {
+    { 239, 8 }, { 254, 8 }, { 223, 8 }, { 253, 8 },
+    { 207, 8 }, { 252, 8 }, { 191, 8 }, { 251, 8 },
+    { 250, 7 }, { 250, 7 }, { 175, 8 }, { 159, 8 },
+    { 249, 7 }, { 249, 7 }, { 248, 7 }, { 248, 7 },
+    { 143, 8 }, { 127, 8 }, { 247, 7 }, { 247, 7 },
+    { 111, 7 }, { 111, 7 }, { 246, 7 }, { 246, 7 },
+    { 95, 7 }, { 95, 7 }, { 245, 7 }, { 245, 7 },
+    { 79, 7 }, { 79, 7 }, { 244, 7 }, { 244, 7 },
+    { 63, 7 }, { 63, 7 }, { 243, 7 }, { 243, 7 },
+    { 47, 7 }, { 47, 7 }, { 242, 7 }, { 242, 7 },
+    { 241, 7 }, { 241, 7 }, { 31, 8 }, { 240, 8 },
+    { 256, -3 }, { 264, -3 }, { 272, -3 }, { 280, -3 },
+    { 255, 4 }, { 255, 4 }, { 255, 4 }, { 255, 4 },
+    { 255, 4 }, { 255, 4 }, { 255, 4 }, { 255, 4 },
+    { 255, 4 }, { 255, 4 }, { 255, 4 }, { 255, 4 },
+    { 255, 4 }, { 255, 4 }, { 255, 4 }, { 255, 4 },
+    { 288, -4 }, { 304, -3 }, { 312, -3 }, { 320, -3 },
+    { 328, -2 }, { 332, -2 }, { 336, -2 }, { 340, -2 },
+    { 344, -2 }, { 348, -2 }, { 352, -2 }, { 356, -2 },
+    { 360, -2 }, { 364, -3 }, { 372, -2 }, { 376, -2 },
+    { 380, -2 }, { 384, -3 }, { 392, -2 }, { 396, -3 },
+    { 404, -1 }, { 406, -2 }, { 410, -2 }, { 414, -1 },
+    { 416, -2 }, { 420, -1 }, { 422, -1 }, { 424, -1 },
+    { 426, -1 }, { 428, -1 }, { 430, -1 }, { 432, -1 },
+    { 434, -1 }, { 436, -1 }, { 438, -1 }, { 440, -1 },
+    { 442, -1 }, { 444, -1 }, { 446, -1 }, { 448, -1 },
+    { 450, -1 }, { 452, -1 }, { 454, -2 }, { 458, -1 },
+    { 460, -2 }, { 115, 8 }, { 464, -1 }, { 114, 8 },
+    { 70, 8 }, { 100, 8 }, { 85, 8 }, { 113, 8 },
+    { 54, 8 }, { 99, 8 }, { 69, 8 }, { 84, 8 },
+    { 38, 8 }, { 98, 8 }, { 22, 8 }, { 97, 8 },
+    { 466, -1 }, { 53, 8 }, { 83, 8 }, { 68, 8 },
+    { 37, 8 }, { 82, 8 }, { 21, 8 }, { 468, -1 },
+    { 81, 7 }, { 81, 7 }, { 52, 8 }, { 67, 8 },
+    { 36, 7 }, { 36, 7 }, { 66, 7 }, { 66, 7 },
+    { 51, 7 }, { 51, 7 }, { 20, 7 }, { 20, 7 },
+    { 65, 7 }, { 65, 7 }, { 4, 8 }, { 64, 8 },
+    { 35, 7 }, { 35, 7 }, { 50, 7 }, { 50, 7 },
+    { 19, 6 }, { 19, 6 }, { 19, 6 }, { 19, 6 },
+    { 49, 6 }, { 49, 6 }, { 49, 6 }, { 49, 6 },
+    { 3, 7 }, { 3, 7 }, { 48, 7 }, { 48, 7 },
+    { 34, 6 }, { 34, 6 }, { 34, 6 }, { 34, 6 },
+    { 18, 5 }, { 18, 5 }, { 18, 5 }, { 18, 5 },
+    { 18, 5 }, { 18, 5 }, { 18, 5 }, { 18, 5 },
+    { 33, 5 }, { 33, 5 }, { 33, 5 }, { 33, 5 },
+    { 33, 5 }, { 33, 5 }, { 33, 5 }, { 33, 5 },
+    { 2, 6 }, { 2, 6 }, { 2, 6 }, { 2, 6 },
+    { 32, 6 }, { 32, 6 }, { 32, 6 }, { 32, 6 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 17, 4 }, { 17, 4 }, { 17, 4 }, { 17, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 16, 4 }, { 16, 4 }, { 16, 4 }, { 16, 4 },
+    { 16, 4 }, { 16, 4 }, { 16, 4 }, { 16, 4 },
+    { 16, 4 }, { 16, 4 }, { 16, 4 }, { 16, 4 },
+    { 16, 4 }, { 16, 4 }, { 16, 4 }, { 16, 4 },
+    { 0, 4 }, { 0, 4 }, { 0, 4 }, { 0, 4 },
+    { 0, 4 }, { 0, 4 }, { 0, 4 }, { 0, 4 },
+    { 0, 4 }, { 0, 4 }, { 0, 4 }, { 0, 4 },
+    { 0, 4 }, { 0, 4 }, { 0, 4 }, { 0, 4 },
+    { 15, 1 }, { 15, 1 }, { 15, 1 }, { 15, 1 },
+    { 238, 3 }, { 222, 3 }, { 237, 3 }, { 206, 3 },
+    { 236, 3 }, { 221, 3 }, { 190, 3 }, { 235, 3 },
+    { 205, 3 }, { 220, 3 }, { 174, 3 }, { 234, 3 },
+    { 189, 3 }, { 219, 3 }, { 204, 3 }, { 158, 3 },
+    { 233, 3 }, { 173, 3 }, { 218, 3 }, { 188, 3 },
+    { 203, 3 }, { 142, 3 }, { 232, 3 }, { 157, 3 },
+    { 217, 3 }, { 126, 3 }, { 231, 3 }, { 172, 3 },
+    { 202, 3 }, { 202, 3 }, { 187, 3 }, { 187, 3 },
+    { 141, 3 }, { 141, 3 }, { 216, 3 }, { 216, 3 },
+    { 14, 4 }, { 224, 4 }, { 13, 3 }, { 13, 3 },
+    { 230, 2 }, { 230, 2 }, { 230, 2 }, { 230, 2 },
+    { 110, 3 }, { 156, 3 }, { 201, 2 }, { 201, 2 },
+    { 94, 2 }, { 94, 2 }, { 186, 2 }, { 186, 2 },
+    { 229, 2 }, { 229, 2 }, { 171, 3 }, { 125, 3 },
+    { 215, 2 }, { 215, 2 }, { 228, 2 }, { 228, 2 },
+    { 140, 2 }, { 140, 2 }, { 200, 2 }, { 200, 2 },
+    { 78, 3 }, { 46, 3 }, { 62, 2 }, { 62, 2 },
+    { 109, 2 }, { 214, 2 }, { 227, 2 }, { 155, 2 },
+    { 185, 2 }, { 170, 2 }, { 226, 2 }, { 30, 2 },
+    { 225, 2 }, { 93, 2 }, { 213, 2 }, { 124, 2 },
+    { 199, 2 }, { 77, 2 }, { 139, 2 }, { 184, 2 },
+    { 212, 2 }, { 154, 2 }, { 169, 2 }, { 108, 2 },
+    { 198, 2 }, { 61, 2 }, { 211, 2 }, { 45, 2 },
+    { 210, 2 }, { 29, 2 }, { 123, 2 }, { 183, 2 },
+    { 209, 2 }, { 92, 2 }, { 197, 2 }, { 138, 2 },
+    { 168, 2 }, { 153, 2 }, { 76, 2 }, { 196, 2 },
+    { 107, 2 }, { 107, 2 }, { 182, 2 }, { 182, 2 },
+    { 208, 3 }, { 12, 3 }, { 60, 2 }, { 60, 2 },
+    { 195, 2 }, { 122, 2 }, { 167, 2 }, { 44, 2 },
+    { 194, 2 }, { 91, 2 }, { 181, 2 }, { 28, 2 },
+    { 137, 2 }, { 152, 2 }, { 193, 2 }, { 75, 2 },
+    { 192, 3 }, { 11, 3 }, { 59, 2 }, { 59, 2 },
+    { 176, 3 }, { 10, 3 }, { 26, 2 }, { 26, 2 },
+    { 180, 1 }, { 180, 1 }, { 106, 2 }, { 166, 2 },
+    { 121, 2 }, { 121, 2 }, { 151, 2 }, { 151, 2 },
+    { 160, 3 }, { 9, 3 }, { 144, 2 }, { 144, 2 },
+    { 179, 1 }, { 136, 1 }, { 43, 2 }, { 90, 2 },
+    { 178, 1 }, { 178, 1 }, { 165, 2 }, { 27, 2 },
+    { 177, 2 }, { 105, 2 }, { 150, 1 }, { 164, 1 },
+    { 74, 2 }, { 120, 2 }, { 135, 1 }, { 135, 1 },
+    { 58, 1 }, { 163, 1 }, { 89, 1 }, { 149, 1 },
+    { 42, 1 }, { 162, 1 }, { 161, 1 }, { 104, 1 },
+    { 134, 1 }, { 119, 1 }, { 73, 1 }, { 148, 1 },
+    { 57, 1 }, { 147, 1 }, { 88, 1 }, { 133, 1 },
+    { 41, 1 }, { 103, 1 }, { 118, 1 }, { 146, 1 },
+    { 25, 1 }, { 145, 1 }, { 72, 1 }, { 132, 1 },
+    { 87, 1 }, { 117, 1 }, { 56, 1 }, { 131, 1 },
+    { 102, 1 }, { 40, 1 }, { 130, 1 }, { 24, 1 },
+    { 71, 1 }, { 116, 1 }, { 129, 1 }, { 129, 1 },
+    { 8, 2 }, { 128, 2 }, { 86, 1 }, { 101, 1 },
+    { 23, 1 }, { 23, 1 }, { 7, 2 }, { 112, 2 },
+    { 55, 1 }, { 39, 1 }, { 6, 1 }, { 96, 1 },
+    { 5, 1 }, { 80, 1 },
+};
+
+static const VLC huff_vlc[16] = {
+    { 0, NULL, 0, 0 },
+    { 8, huff_vlc_table_1, 256, 256 },
+    { 8, huff_vlc_table_2, 256, 256 },
+    { 8, huff_vlc_table_3, 256, 256 },
+    { 8, huff_vlc_table_4, 256, 256 },
+    { 8, huff_vlc_table_5, 256, 256 },
+    { 8, huff_vlc_table_6, 268, 268 },
+    { 8, huff_vlc_table_7, 274, 274 },
+    { 8, huff_vlc_table_8, 260, 260 },
+    { 8, huff_vlc_table_9, 306, 306 },
+    { 8, huff_vlc_table_10, 286, 286 },
+    { 8, huff_vlc_table_11, 272, 272 },
+    { 8, huff_vlc_table_12, 732, 732 },
+    { 8, huff_vlc_table_13, 534, 534 },
+    { 8, huff_vlc_table_14, 804, 804 },
+    { 8, huff_vlc_table_15, 470, 470 },
+};
+
+static const VLC_TYPE huff_quad_vlc_table_0[128][2] = {
+    { 11, 6 }, { 11, 6 }, { 15, 6 }, { 15, 6 },
+    { 13, 6 }, { 13, 6 }, { 14, 6 }, { 14, 6 },
+    { 7, 6 }, { 7, 6 }, { 5, 6 }, { 5, 6 },
+    { 9, 5 }, { 9, 5 }, { 9, 5 }, { 9, 5 },
+    { 6, 5 }, { 6, 5 }, { 6, 5 }, { 6, 5 },
+    { 3, 5 }, { 3, 5 }, { 3, 5 }, { 3, 5 },
+    { 10, 5 }, { 10, 5 }, { 10, 5 }, { 10, 5 },
+    { 12, 5 }, { 12, 5 }, { 12, 5 }, { 12, 5 },
+    { 2, 4 }, { 2, 4 }, { 2, 4 }, { 2, 4 },
+    { 2, 4 }, { 2, 4 }, { 2, 4 }, { 2, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 1, 4 }, { 1, 4 }, { 1, 4 }, { 1, 4 },
+    { 4, 4 }, { 4, 4 }, { 4, 4 }, { 4, 4 },
+    { 4, 4 }, { 4, 4 }, { 4, 4 }, { 4, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 8, 4 }, { 8, 4 }, { 8, 4 }, { 8, 4 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+};
+
+static const VLC_TYPE huff_quad_vlc_table_1[16][2] = {
+    { 15, 4 }, { 14, 4 }, { 13, 4 }, { 12, 4 },
+    { 11, 4 }, { 10, 4 }, { 9, 4 }, { 8, 4 },
+    { 7, 4 }, { 6, 4 }, { 5, 4 }, { 4, 4 },
+    { 3, 4 }, { 2, 4 }, { 1, 4 }, { 0, 4 },
+};
+
+static const VLC huff_quad_vlc[2] = {
+    { 7, huff_quad_vlc_table_0, 128, 128 },
+    { 4, huff_quad_vlc_table_1, 16, 16 },
+};
+
+static const uint8_t huff_code_table_1[4] = {
+    0, 1,
+    16, 17,
+};
+
+static const uint8_t huff_code_table_2[9] = {
+    0, 1, 2,
+    16, 17, 18,
+    32, 33, 34,
+};
+
+static const uint8_t huff_code_table_3[9] = {
+    0, 1, 2,
+    16, 17, 18,
+    32, 33, 34,
+};
+
+static const uint8_t huff_code_table_4[16] = {
+    0, 1, 2, 3,
+    16, 17, 18, 19,
+    32, 33, 34, 35,
+    48, 49, 50, 51,
+};
+
+static const uint8_t huff_code_table_5[16] = {
+    0, 1, 2, 3,
+    16, 17, 18, 19,
+    32, 33, 34, 35,
+    48, 49, 50, 51,
+};
+
+static const uint8_t huff_code_table_6[36] = {
+    0, 1, 2, 3, 4, 5,
+    16, 17, 18, 19, 20, 21,
+    32, 33, 34, 35, 36, 37,
+    48, 49, 50, 51, 52, 53,
+    64, 65, 66, 67, 68, 69,
+    80, 81, 82, 83, 84, 85,
+};
+
+static const uint8_t huff_code_table_7[36] = {
+    0, 1, 2, 3, 4, 5,
+    16, 17, 18, 19, 20, 21,
+    32, 33, 34, 35, 36, 37,
+    48, 49, 50, 51, 52, 53,
+    64, 65, 66, 67, 68, 69,
+    80, 81, 82, 83, 84, 85,
+};
+
+static const uint8_t huff_code_table_8[36] = {
+    0, 1, 2, 3, 4, 5,
+    16, 17, 18, 19, 20, 21,
+    32, 33, 34, 35, 36, 37,
+    48, 49, 50, 51, 52, 53,
+    64, 65, 66, 67, 68, 69,
+    80, 81, 82, 83, 84, 85,
+};
+
+static const uint8_t huff_code_table_9[64] = {
+    0, 1, 2, 3, 4, 5, 6, 7,
+    16, 17, 18, 19, 20, 21, 22, 23,
+    32, 33, 34, 35, 36, 37, 38, 39,
+    48, 49, 50, 51, 52, 53, 54, 55,
+    64, 65, 66, 67, 68, 69, 70, 71,
+    80, 81, 82, 83, 84, 85, 86, 87,
+    96, 97, 98, 99, 100, 101, 102, 103,
+    112, 113, 114, 115, 116, 117, 118, 119,
+};
+
+static const uint8_t huff_code_table_10[64] = {
+    0, 1, 2, 3, 4, 5, 6, 7,
+    16, 17, 18, 19, 20, 21, 22, 23,
+    32, 33, 34, 35, 36, 37, 38, 39,
+    48, 49, 50, 51, 52, 53, 54, 55,
+    64, 65, 66, 67, 68, 69, 70, 71,
+    80, 81, 82, 83, 84, 85, 86, 87,
+    96, 97, 98, 99, 100, 101, 102, 103,
+    112, 113, 114, 115, 116, 117, 118, 119,
+};
+
+static const uint8_t huff_code_table_11[64] = {
+    0, 1, 2, 3, 4, 5, 6, 7,
+    16, 17, 18, 19, 20, 21, 22, 23,
+    32, 33, 34, 35, 36, 37, 38, 39,
+    48, 49, 50, 51, 52, 53, 54, 55,
+    64, 65, 66, 67, 68, 69, 70, 71,
+    80, 81, 82, 83, 84, 85, 86, 87,
+    96, 97, 98, 99, 100, 101, 102, 103,
+    112, 113, 114, 115, 116, 117, 118, 119,
+};
+
+static const uint8_t huff_code_table_12[256] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+};
+
+static const uint8_t huff_code_table_13[256] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+};
+
+static const uint8_t huff_code_table_14[256] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+};
+
+static const uint8_t huff_code_table_15[256] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+};
+
+static const uint8_t *const huff_code_table[16] = {
+    NULL,
+    huff_code_table_1,
+    huff_code_table_2,
+    huff_code_table_3,
+    huff_code_table_4,
+    huff_code_table_5,
+    huff_code_table_6,
+    huff_code_table_7,
+    huff_code_table_8,
+    huff_code_table_9,
+    huff_code_table_10,
+    huff_code_table_11,
+    huff_code_table_12,
+    huff_code_table_13,
+    huff_code_table_14,
+    huff_code_table_15,
+};
+
+/* computed from band_size_long */
+static const uint16_t band_index_long[9][23] = {
+{
+    0, 4, 8, 12, 16, 20, 24, 30, 36, 44, 52, 62,
+    74, 90, 110, 134, 162, 196, 238, 288, 342, 418, 576,
+},
+{
+    0, 4, 8, 12, 16, 20, 24, 30, 36, 42, 50, 60,
+    72, 88, 106, 128, 156, 190, 230, 276, 330, 384, 576,
+},
+{
+    0, 4, 8, 12, 16, 20, 24, 30, 36, 44, 54, 66,
+    82, 102, 126, 156, 194, 240, 296, 364, 448, 550, 576,
+},
+{
+    0, 6, 12, 18, 24, 30, 36, 44, 54, 66, 80, 96,
+    116, 140, 168, 200, 238, 284, 336, 396, 464, 522, 576,
+},
+{
+    0, 6, 12, 18, 24, 30, 36, 44, 54, 66, 80, 96,
+    114, 136, 162, 194, 232, 278, 330, 394, 464, 540, 576,
+},
+{
+    0, 6, 12, 18, 24, 30, 36, 44, 54, 66, 80, 96,
+    116, 140, 168, 200, 238, 284, 336, 396, 464, 522, 576,
+},
+{
+    0, 6, 12, 18, 24, 30, 36, 44, 54, 66, 80, 96,
+    116, 140, 168, 200, 238, 284, 336, 396, 464, 522, 576,
+},
+{
+    0, 6, 12, 18, 24, 30, 36, 44, 54, 66, 80, 96,
+    116, 140, 168, 200, 238, 284, 336, 396, 464, 522, 576,
+},
+{
+    0, 12, 24, 36, 48, 60, 72, 88, 108, 132, 160, 192,
+    232, 280, 336, 400, 476, 566, 568, 570, 572, 574, 576,
+},
+};
+
+static const int8_t table_4_3_exp[TABLE_4_3_SIZE] = {
+    0, -1, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+};
+
+static const uint32_t table_4_3_value[TABLE_4_3_SIZE] = {
+    0, 16777210, 10568981, 9073849, 13316082, 8965198, 11432334, 14040976,
+    16777210, 9815065, 11295441, 12826066, 14403837, 16026094, 8845260, 9697540,
+    10568981, 11458781, 12366208, 13290602, 14231364, 15187943, 16159831, 8573280,
+    9073849, 9581421, 10095807, 10616832, 11144330, 11678146, 12218135, 12764158,
+    13316082, 13873790, 14437160, 15006080, 15580446, 16160156, 16745110, 8667610,
+    8965198, 9265276, 9567805, 9872744, 10180056, 10489705, 10801656, 11115877,
+    11432334, 11750996, 12071834, 12394818, 12719920, 13047113, 13376370, 13707666,
+    14040976, 14376276, 14713542, 15052753, 15393886, 15736919, 16081831, 16428604,
+    16777210, 8563821, 8739939, 8916948, 9094840, 9273607, 9453237, 9633727,
+    9815065, 9997246, 10180260, 10364098, 10548757, 10734229, 10920503, 11107577,
+    11295441, 11484090, 11673515, 11863714, 12054678, 12246400, 12438877, 12632100,
+    12826066, 13020767, 13216199, 13412356, 13609233, 13806825, 14005127, 14204132,
+    14403837, 14604237, 14805326, 15007101, 15209557, 15412688, 15616491, 15820961,
+    16026094, 16231886, 16438331, 16645427, 8426585, 8530777, 8635288, 8740116,
+    8845260, 8950717, 9056486, 9162565, 9268950, 9375643, 9482640, 9589939,
+    9697540, 9805440, 9913637, 10022131, 10130918, 10239999, 10349372, 10459033,
+    10568981, 10679216, 10789739, 10900546, 11011634, 11123003, 11234651, 11346577,
+    11458781, 11571259, 11684012, 11797037, 11910333, 12023900, 12137736, 12251838,
+    12366208, 12480842, 12595741, 12710901, 12826324, 12942006, 13057946, 13174147,
+    13290602, 13407314, 13524282, 13641502, 13758973, 13876696, 13994670, 14112893,
+    14231364, 14350083, 14469047, 14588256, 14707708, 14827406, 14947344, 15067523,
+    15187943, 15308601, 15429498, 15550632, 15672004, 15793610, 15915449, 16037523,
+    16159831, 16282369, 16405138, 16528138, 16651368, 16774825, 8449256, 8511211,
+    8573280, 8635462, 8697755, 8760161, 8822677, 8885305, 8948043, 9010891,
+    9073849, 9136917, 9200093, 9263379, 9326772, 9390273, 9453882, 9517598,
+    9581421, 9645350, 9709385, 9773527, 9837773, 9902125, 9966582, 10031142,
+    10095807, 10160575, 10225448, 10290422, 10355500, 10420680, 10485962, 10551346,
+    10616832, 10682418, 10748105, 10813893, 10879782, 10945769, 11011857, 11078044,
+    11144330, 11210714, 11277197, 11343778, 11410458, 11477234, 11544108, 11611079,
+    11678146, 11745310, 11812570, 11879926, 11947378, 12014925, 12082566, 12150303,
+    12218135, 12286060, 12354080, 12422193, 12490401, 12558700, 12627093, 12695579,
+    12764158, 12832829, 12901591, 12970445, 13039391, 13108428, 13177556, 13246775,
+    13316082, 13385480, 13454970, 13524550, 13594220, 13663980, 13733828, 13803764,
+    13873790, 13943904, 14014106, 14084396, 14154774, 14225240, 14295792, 14366432,
+    14437160, 14507972, 14578874, 14649860, 14720934, 14792092, 14863336, 14934666,
+    15006080, 15077580, 15149166, 15220836, 15292590, 15364428, 15436350, 15508356,
+    15580446, 15652620, 15724876, 15797216, 15869640, 15942144, 16014732, 16087402,
+    16160156, 16232990, 16305906, 16378904, 16451982, 16525144, 16598386, 16671708,
+    16745110, 8409297, 8446079, 8482901, 8519764, 8556666, 8593608, 8630589,
+    8667610, 8704671, 8741771, 8778911, 8816090, 8853309, 8890566, 8927863,
+    8965198, 9002573, 9039986, 9077438, 9114929, 9152458, 9190026, 9227632,
+    9265276, 9302959, 9340681, 9378440, 9416237, 9454072, 9491945, 9529856,
+    9567805, 9605791, 9643815, 9681876, 9719975, 9758111, 9796285, 9834495,
+    9872744, 9911028, 9949351, 9987709, 10026105, 10064538, 10103007, 10141513,
+    10180056, 10218635, 10257250, 10295902, 10334590, 10373315, 10412075, 10450872,
+    10489705, 10528574, 10567478, 10606419, 10645395, 10684407, 10723454, 10762538,
+    10801656, 10840810, 10880000, 10919225, 10958485, 10997780, 11037111, 11076476,
+    11115877, 11155312, 11194783, 11234288, 11273828, 11313403, 11353012, 11392655,
+    11432334, 11472047, 11511794, 11551575, 11591391, 11631241, 11671126, 11711044,
+    11750996, 11790983, 11831003, 11871057, 11911145, 11951267, 11991422, 12031611,
+    12071834, 12112090, 12152380, 12192703, 12233059, 12273449, 12313872, 12354329,
+    12394818, 12435340, 12475896, 12516484, 12557106, 12597760, 12638447, 12679167,
+    12719920, 12760705, 12801523, 12842374, 12883257, 12924172, 12965120, 13006100,
+    13047113, 13088157, 13129234, 13170343, 13211485, 13252658, 13293863, 13335101,
+    13376370, 13417671, 13459003, 13500368, 13541764, 13583192, 13624652, 13666143,
+    13707666, 13749220, 13790805, 13832422, 13874070, 13915750, 13957461, 13999203,
+    14040976, 14082780, 14124615, 14166481, 14208378, 14250306, 14292265, 14334255,
+    14376276, 14418327, 14460409, 14502521, 14544665, 14586838, 14629043, 14671277,
+    14713542, 14755838, 14798164, 14840520, 14882906, 14925323, 14967769, 15010246,
+    15052753, 15095290, 15137857, 15180454, 15223080, 15265737, 15308423, 15351140,
+    15393886, 15436661, 15479466, 15522301, 15565166, 15608060, 15650983, 15693936,
+    15736919, 15779930, 15822971, 15866042, 15909141, 15952270, 15995428, 16038615,
+    16081831, 16125077, 16168351, 16211654, 16254986, 16298347, 16341737, 16385156,
+    16428604, 16472080, 16515585, 16559119, 16602681, 16646272, 16689891, 16733539,
+    16777210, 8410457, 8432323, 8454206, 8476099, 8498009, 8519932, 8541870,
+    8563821, 8585787, 8607767, 8629760, 8651769, 8673790, 8695826, 8717876,
+    8739939, 8762017, 8784108, 8806214, 8828333, 8850466, 8872613, 8894773,
+    8916948, 8939137, 8961339, 8983554, 9005784, 9028028, 9050284, 9072556,
+    9094840, 9117138, 9139449, 9161775, 9184114, 9206467, 9228833, 9251213,
+    9273607, 9296013, 9318433, 9340867, 9363314, 9385775, 9408249, 9430736,
+    9453237, 9475752, 9498279, 9520821, 9543376, 9565944, 9588525, 9611119,
+    9633727, 9656348, 9678982, 9701629, 9724290, 9746964, 9769651, 9792351,
+    9815065, 9837792, 9860532, 9883285, 9906050, 9928830, 9951622, 9974428,
+    9997246, 10020076, 10042921, 10065778, 10088648, 10111532, 10134427, 10157338,
+    10180260, 10203194, 10226142, 10249103, 10272076, 10295062, 10318062, 10341073,
+    10364098, 10387137, 10410188, 10433250, 10456327, 10479415, 10502517, 10525632,
+    10548757, 10571897, 10595050, 10618214, 10641392, 10664582, 10687785, 10711000,
+    10734229, 10757470, 10780723, 10803989, 10827267, 10850558, 10873860, 10897176,
+    10920503, 10943845, 10967197, 10990563, 11013940, 11037331, 11060734, 11084150,
+    11107577, 11131017, 11154470, 11177933, 11201410, 11224900, 11248402, 11271916,
+    11295441, 11318980, 11342530, 11366092, 11389668, 11413255, 11436854, 11460465,
+    11484090, 11507725, 11531374, 11555034, 11578706, 11602390, 11626087, 11649795,
+    11673515, 11697249, 11720993, 11744750, 11768520, 11792300, 11816093, 11839897,
+    11863714, 11887543, 11911383, 11935236, 11959100, 11982977, 12006865, 12030766,
+    12054678, 12078601, 12102537, 12126485, 12150445, 12174416, 12198399, 12222394,
+    12246400, 12270418, 12294449, 12318490, 12342545, 12366611, 12390686, 12414776,
+    12438877, 12462988, 12487112, 12511248, 12535396, 12559554, 12583724, 12607907,
+    12632100, 12656305, 12680522, 12704751, 12728990, 12753241, 12777505, 12801780,
+    12826066, 12850362, 12874672, 12898993, 12923324, 12947669, 12972023, 12996390,
+    13020767, 13045156, 13069557, 13093968, 13118392, 13142827, 13167273, 13191730,
+    13216199, 13240680, 13265171, 13289673, 13314187, 13338713, 13363250, 13387797,
+    13412356, 13436926, 13461508, 13486101, 13510705, 13535321, 13559947, 13584585,
+    13609233, 13633893, 13658564, 13683247, 13707940, 13732645, 13757361, 13782088,
+    13806825, 13831574, 13856334, 13881105, 13905888, 13930680, 13955484, 13980300,
+    14005127, 14029963, 14054812, 14079671, 14104542, 14129423, 14154315, 14179217,
+    14204132, 14229057, 14253994, 14278940, 14303898, 14328866, 14353845, 14378835,
+    14403837, 14428849, 14453873, 14478906, 14503951, 14529005, 14554072, 14579149,
+    14604237, 14629335, 14654444, 14679565, 14704696, 14729838, 14754990, 14780153,
+    14805326, 14830511, 14855707, 14880913, 14906129, 14931356, 14956594, 14981842,
+    15007101, 15032372, 15057652, 15082942, 15108244, 15133557, 15158879, 15184212,
+    15209557, 15234911, 15260276, 15285652, 15311038, 15336435, 15361842, 15387260,
+    15412688, 15438127, 15463576, 15489036, 15514506, 15539986, 15565478, 15590979,
+    15616491, 15642013, 15667546, 15693089, 15718643, 15744207, 15769781, 15795366,
+    15820961, 15846567, 15872182, 15897809, 15923444, 15949091, 15974748, 16000416,
+    16026094, 16051783, 16077480, 16103189, 16128907, 16154636, 16180376, 16206125,
+    16231886, 16257655, 16283435, 16309226, 16335027, 16360837, 16386658, 16412489,
+    16438331, 16464182, 16490044, 16515916, 16541797, 16567690, 16593591, 16619504,
+    16645427, 16671359, 16697302, 16723255, 16749217, 16775190, 8400587, 8413583,
+    8426585, 8439591, 8452603, 8465619, 8478640, 8491667, 8504699, 8517735,
+    8530777, 8543823, 8556875, 8569931, 8582993, 8596059, 8609130, 8622206,
+    8635288, 8648374, 8661466, 8674562, 8687663, 8700769, 8713880, 8726995,
+    8740116, 8753242, 8766373, 8779508, 8792649, 8805795, 8818945, 8832100,
+    8845260, 8858425, 8871595, 8884770, 8897950, 8911134, 8924324, 8937518,
+    8950717, 8963922, 8977130, 8990344, 9003563, 9016786, 9030015, 9043248,
+    9056486, 9069729, 9082977, 9096229, 9109487, 9122749, 9136015, 9149287,
+    9162565, 9175846, 9189132, 9202423, 9215719, 9229020, 9242325, 9255636,
+    9268950, 9282270, 9295595, 9308925, 9322259, 9335598, 9348942, 9362290,
+    9375643, 9389001, 9402364, 9415731, 9429103, 9442481, 9455862, 9469249,
+    9482640, 9496036, 9509437, 9522842, 9536252, 9549666, 9563087, 9576510,
+    9589939, 9603373, 9616811, 9630254, 9643702, 9657155, 9670612, 9684074,
+    9697540, 9711011, 9724487, 9737967, 9751452, 9764942, 9778437, 9791936,
+    9805440, 9818948, 9832461, 9845979, 9859501, 9873028, 9886560, 9900096,
+    9913637, 9927183, 9940733, 9954288, 9967847, 9981411, 9994980, 10008553,
+    10022131, 10035713, 10049300, 10062891, 10076488, 10090089, 10103694, 10117304,
+    10130918, 10144538, 10158162, 10171790, 10185423, 10199060, 10212702, 10226349,
+    10239999, 10253655, 10267315, 10280980, 10294649, 10308323, 10322001, 10335684,
+    10349372, 10363063, 10376760, 10390461, 10404166, 10417876, 10431591, 10445310,
+    10459033, 10472761, 10486494, 10500231, 10513972, 10527719, 10541469, 10555224,
+    10568981, 10582745, 10596513, 10610286, 10624062, 10637845, 10651632, 10665422,
+    10679216, 10693017, 10706821, 10720630, 10734442, 10748260, 10762082, 10775908,
+    10789739, 10803575, 10817414, 10831257, 10845107, 10858959, 10872817, 10886678,
+    10900546, 10914415, 10928290, 10942171, 10956054, 10969942, 10983835, 10997731,
+    11011634, 11025539, 11039450, 11053365, 11067283, 11081205, 11095134, 11109065,
+    11123003, 11136943, 11150889, 11164837, 11178792, 11192750, 11206713, 11220679,
+    11234651, 11248626, 11262607, 11276590, 11290580, 11304573, 11318569, 11332571,
+    11346577, 11360587, 11374603, 11388621, 11402644, 11416672, 11430704, 11444740,
+    11458781, 11472825, 11486875, 11500928, 11514984, 11529047, 11543113, 11557184,
+    11571259, 11585338, 11599421, 11613508, 11627601, 11641697, 11655798, 11669902,
+    11684012, 11698124, 11712243, 11726364, 11740491, 11754620, 11768756, 11782893,
+    11797037, 11811184, 11825336, 11839490, 11853652, 11867814, 11881984, 11896157,
+    11910333, 11924515, 11938700, 11952890, 11967083, 11981280, 11995483, 12009690,
+    12023900, 12038116, 12052334, 12066557, 12080785, 12095016, 12109252, 12123491,
+    12137736, 12151983, 12166236, 12180493, 12194754, 12209018, 12223287, 12237561,
+    12251838, 12266120, 12280405, 12294697, 12308990, 12323287, 12337590, 12351897,
+    12366208, 12380523, 12394841, 12409164, 12423492, 12437823, 12452159, 12466498,
+    12480842, 12495190, 12509542, 12523898, 12538258, 12552622, 12566992, 12581364,
+    12595741, 12610121, 12624505, 12638894, 12653287, 12667685, 12682086, 12696492,
+    12710901, 12725314, 12739733, 12754152, 12768579, 12783008, 12797444, 12811881,
+    12826324, 12840769, 12855219, 12869674, 12884132, 12898593, 12913061, 12927532,
+    12942006, 12956484, 12970966, 12985453, 12999944, 13014439, 13028936, 13043440,
+    13057946, 13072458, 13086973, 13101492, 13116015, 13130541, 13145072, 13159608,
+    13174147, 13188689, 13203236, 13217788, 13232343, 13246901, 13261465, 13276031,
+    13290602, 13305177, 13319756, 13334340, 13348926, 13363518, 13378112, 13392712,
+    13407314, 13421921, 13436532, 13451147, 13465765, 13480388, 13495015, 13509646,
+    13524282, 13538919, 13553563, 13568208, 13582860, 13597515, 13612173, 13626834,
+    13641502, 13656171, 13670846, 13685524, 13700205, 13714892, 13729582, 13744275,
+    13758973, 13773675, 13788381, 13803090, 13817803, 13832522, 13847242, 13861968,
+    13876696, 13891430, 13906166, 13920908, 13935652, 13950402, 13965154, 13979910,
+    13994670, 14009434, 14024203, 14038976, 14053751, 14068530, 14083314, 14098102,
+    14112893, 14127689, 14142489, 14157291, 14172098, 14186909, 14201724, 14216542,
+    14231364, 14246190, 14261021, 14275854, 14290693, 14305534, 14320379, 14335229,
+    14350083, 14364939, 14379800, 14394665, 14409534, 14424406, 14439282, 14454162,
+    14469047, 14483934, 14498825, 14513721, 14528621, 14543523, 14558431, 14573341,
+    14588256, 14603173, 14618096, 14633023, 14647952, 14662886, 14677822, 14692764,
+    14707708, 14722658, 14737610, 14752567, 14767526, 14782491, 14797458, 14812431,
+    14827406, 14842385, 14857367, 14872353, 14887345, 14902338, 14917336, 14932338,
+    14947344, 14962353, 14977366, 14992383, 15007403, 15022428, 15037456, 15052487,
+    15067523, 15082562, 15097606, 15112653, 15127703, 15142758, 15157816, 15172877,
+    15187943, 15203012, 15218085, 15233162, 15248242, 15263327, 15278414, 15293505,
+    15308601, 15323701, 15338803, 15353909, 15369019, 15384135, 15399252, 15414373,
+    15429498, 15444627, 15459758, 15474896, 15490035, 15505179, 15520326, 15535478,
+    15550632, 15565791, 15580953, 15596119, 15611287, 15626461, 15641638, 15656818,
+    15672004, 15687190, 15702382, 15717578, 15732776, 15747980, 15763185, 15778394,
+    15793610, 15808826, 15824046, 15839271, 15854499, 15869732, 15884968, 15900207,
+    15915449, 15930696, 15945946, 15961199, 15976458, 15991719, 16006983, 16022251,
+    16037523, 16052799, 16068078, 16083361, 16098648, 16113938, 16129232, 16144530,
+    16159831, 16175135, 16190442, 16205756, 16221071, 16236390, 16251713, 16267039,
+    16282369, 16297703, 16313041, 16328381, 16343725, 16359074, 16374425, 16389780,
+    16405138, 16420501, 16435867, 16451236, 16466610, 16481986, 16497366, 16512751,
+    16528138, 16543530, 16558924, 16574322, 16589725, 16605130, 16620539, 16635951,
+    16651368, 16666786, 16682211, 16697638, 16713069, 16728501, 16743939, 16759381,
+    16774825, 8395137, 8402863, 8410590, 8418320, 8426051, 8433784, 8441519,
+    8449256, 8456994, 8464733, 8472476, 8480219, 8487964, 8495712, 8503460,
+    8511211, 8518964, 8526718, 8534474, 8542232, 8549991, 8557753, 8565515,
+    8573280, 8581046, 8588815, 8596585, 8604356, 8612131, 8619906, 8627683,
+    8635462, 8643242, 8651024, 8658808, 8666595, 8674382, 8682172, 8689963,
+    8697755, 8705550, 8713346, 8721144, 8728944, 8736746, 8744549, 8752354,
+    8760161, 8767969, 8775779, 8783592, 8791405, 8799220, 8807037, 8814856,
+    8822677, 8830499, 8838324, 8846149, 8853977, 8861807, 8869637, 8877470,
+    8885305, 8893141, 8900979, 8908818, 8916660, 8924504, 8932348, 8940195,
+    8948043, 8955893, 8963745, 8971599, 8979454, 8987311, 8995169, 9003029,
+    9010891, 9018755, 9026620, 9034487, 9042356, 9050227, 9058099, 9065974,
+    9073849, 9081727, 9089606, 9097487, 9105370, 9113253, 9121140, 9129027,
+    9136917, 9144808, 9152700, 9160595, 9168491, 9176389, 9184289, 9192190,
+    9200093, 9207997, 9215904, 9223813, 9231722, 9239634, 9247547, 9255462,
+    9263379, 9271297, 9279217, 9287138, 9295062, 9302987, 9310913, 9318842,
+    9326772, 9334704, 9342637, 9350572, 9358509, 9366447, 9374388, 9382330,
+    9390273, 9398218, 9406165, 9414114, 9422064, 9430016, 9437970, 9445925,
+    9453882, 9461840, 9469801, 9477763, 9485727, 9493692, 9501659, 9509627,
+    9517598, 9525570, 9533544, 9541519, 9549496, 9557475, 9565455, 9573437,
+    9581421, 9589406, 9597393, 9605382, 9613372, 9621365, 9629358, 9637353,
+    9645350, 9653349, 9661349, 9669351, 9677355, 9685360, 9693367, 9701375,
+    9709385, 9717398, 9725411, 9733426, 9741443, 9749462, 9757482, 9765503,
+    9773527, 9781552, 9789578, 9797607, 9805637, 9813669, 9821702, 9829736,
+    9837773, 9845812, 9853851, 9861893, 9869936, 9877981, 9886027, 9894075,
+    9902125, 9910176, 9918229, 9926284, 9934340, 9942398, 9950457, 9958518,
+    9966582, 9974646, 9982712, 9990779, 9998849, 10006920, 10014992, 10023066,
+    10031142, 10039219, 10047298, 10055379, 10063461, 10071545, 10079631, 10087718,
+    10095807, 10103897, 10111990, 10120083, 10128178, 10136275, 10144374, 10152474,
+    10160575, 10168679, 10176784, 10184890, 10192999, 10201108, 10209220, 10217333,
+    10225448, 10233563, 10241681, 10249801, 10257922, 10266045, 10274169, 10282295,
+    10290422, 10298552, 10306682, 10314814, 10322948, 10331084, 10339221, 10347359,
+    10355500, 10363642, 10371785, 10379930, 10388077, 10396225, 10404376, 10412527,
+    10420680, 10428835, 10436991, 10445149, 10453308, 10461470, 10469632, 10477796,
+    10485962, 10494130, 10502298, 10510470, 10518641, 10526815, 10534991, 10543168,
+    10551346, 10559527, 10567708, 10575891, 10584077, 10592263, 10600451, 10608640,
+    10616832, 10625024, 10633219, 10641415, 10649612, 10657811, 10666012, 10674214,
+    10682418, 10690624, 10698831, 10707039, 10715249, 10723461, 10731674, 10739889,
+    10748105, 10756323, 10764543, 10772764, 10780987, 10789211, 10797437, 10805664,
+    10813893, 10822124, 10830356, 10838589, 10846825, 10855062, 10863300, 10871540,
+    10879782, 10888024, 10896269, 10904515, 10912763, 10921012, 10929263, 10937515,
+    10945769, 10954025, 10962282, 10970540, 10978800, 10987062, 10995325, 11003590,
+    11011857, 11020124, 11028394, 11036665, 11044938, 11053212, 11061487, 11069765,
+    11078044, 11086324, 11094606, 11102889, 11111175, 11119461, 11127749, 11136039,
+    11144330, 11152622, 11160917, 11169212, 11177510, 11185809, 11194109, 11202411,
+    11210714, 11219019, 11227326, 11235634, 11243943, 11252255, 11260567, 11268881,
+    11277197, 11285515, 11293834, 11302154, 11310475, 11318799, 11327124, 11335451,
+    11343778, 11352108, 11360439, 11368772, 11377106, 11385441, 11393779, 11402117,
+    11410458, 11418799, 11427142, 11435487, 11443834, 11452181, 11460531, 11468882,
+    11477234, 11485588, 11493943, 11502300, 11510658, 11519018, 11527380, 11535743,
+    11544108, 11552474, 11560842, 11569210, 11577581, 11585954, 11594327, 11602702,
+    11611079, 11619456, 11627836, 11636218, 11644600, 11652985, 11661370, 11669757,
+    11678146, 11686536, 11694928, 11703321, 11711716, 11720112, 11728510, 11736909,
+    11745310, 11753713, 11762116, 11770522, 11778928, 11787336, 11795746, 11804158,
+    11812570, 11820984, 11829401, 11837818, 11846237, 11854656, 11863078, 11871502,
+    11879926, 11888353, 11896780, 11905209, 11913640, 11922072, 11930506, 11938941,
+    11947378, 11955816, 11964256, 11972697, 11981139, 11989584, 11998029, 12006476,
+    12014925, 12023375, 12031826, 12040280, 12048734, 12057189, 12065647, 12074106,
+    12082566, 12091029, 12099492, 12107957, 12116423, 12124891, 12133360, 12141831,
+    12150303, 12158778, 12167253, 12175729, 12184208, 12192687, 12201168, 12209651,
+    12218135, 12226621, 12235108, 12243596, 12252086, 12260578, 12269070, 12277564,
+    12286060, 12294558, 12303056, 12311557, 12320058, 12328562, 12337067, 12345573,
+    12354080, 12362590, 12371100, 12379612, 12388125, 12396640, 12405157, 12413674,
+    12422193, 12430714, 12439236, 12447760, 12456285, 12464812, 12473340, 12481869,
+    12490401, 12498933, 12507467, 12516002, 12524539, 12533077, 12541617, 12550158,
+    12558700, 12567244, 12575790, 12584337, 12592886, 12601435, 12609987, 12618540,
+    12627093, 12635650, 12644206, 12652765, 12661325, 12669887, 12678449, 12687014,
+    12695579, 12704147, 12712715, 12721286, 12729857, 12738430, 12747005, 12755581,
+    12764158, 12772737, 12781317, 12789899, 12798482, 12807066, 12815652, 12824240,
+    12832829, 12841419, 12850011, 12858604, 12867198, 12875794, 12884392, 12892991,
+    12901591, 12910193, 12918796, 12927400, 12936006, 12944614, 12953223, 12961833,
+    12970445, 12979058, 12987673, 12996290, 13004907, 13013526, 13022146, 13030768,
+    13039391, 13048016, 13056642, 13065269, 13073898, 13082528, 13091161, 13099794,
+    13108428, 13117065, 13125702, 13134340, 13142981, 13151622, 13160266, 13168911,
+    13177556, 13186204, 13194853, 13203503, 13212155, 13220808, 13229462, 13238118,
+    13246775, 13255434, 13264094, 13272755, 13281419, 13290083, 13298749, 13307416,
+    13316082, 13324752, 13333424, 13342096, 13350770, 13359446, 13368124, 13376802,
+    13385480, 13394162, 13402846, 13411528, 13420216, 13428902, 13437590, 13446280,
+    13454970, 13463662, 13472358, 13481052, 13489750, 13498448, 13507148, 13515848,
+    13524550, 13533254, 13541960, 13550666, 13559374, 13568084, 13576794, 13585506,
+    13594220, 13602936, 13611652, 13620370, 13629088, 13637810, 13646530, 13655254,
+    13663980, 13672704, 13681432, 13690162, 13698892, 13707624, 13716356, 13725092,
+    13733828, 13742564, 13751302, 13760042, 13768784, 13777526, 13786272, 13795016,
+    13803764, 13812512, 13821262, 13830014, 13838766, 13847520, 13856274, 13865030,
+    13873790, 13882550, 13891310, 13900072, 13908836, 13917600, 13926368, 13935134,
+    13943904, 13952674, 13961444, 13970220, 13978994, 13987770, 13996546, 14005326,
+    14014106, 14022886, 14031670, 14040454, 14049240, 14058026, 14066814, 14075604,
+    14084396, 14093188, 14101982, 14110776, 14119574, 14128372, 14137170, 14145972,
+    14154774, 14163578, 14172382, 14181188, 14189996, 14198804, 14207614, 14216426,
+    14225240, 14234054, 14242870, 14251686, 14260504, 14269324, 14278146, 14286968,
+    14295792, 14304618, 14313444, 14322272, 14331102, 14339932, 14348764, 14357598,
+    14366432, 14375268, 14384106, 14392946, 14401786, 14410628, 14419470, 14428314,
+    14437160, 14446006, 14454854, 14463704, 14472556, 14481408, 14490262, 14499116,
+    14507972, 14516830, 14525690, 14534550, 14543412, 14552276, 14561140, 14570006,
+    14578874, 14587742, 14596612, 14605482, 14614356, 14623230, 14632104, 14640982,
+    14649860, 14658740, 14667620, 14676502, 14685386, 14694272, 14703156, 14712044,
+    14720934, 14729824, 14738714, 14747608, 14756502, 14765398, 14774294, 14783192,
+    14792092, 14800992, 14809894, 14818798, 14827704, 14836610, 14845516, 14854426,
+    14863336, 14872248, 14881160, 14890074, 14898990, 14907908, 14916824, 14925744,
+    14934666, 14943588, 14952510, 14961436, 14970362, 14979290, 14988220, 14997148,
+    15006080, 15015014, 15023948, 15032882, 15041820, 15050758, 15059698, 15068638,
+    15077580, 15086524, 15095468, 15104414, 15113362, 15122310, 15131262, 15140212,
+    15149166, 15158120, 15167076, 15176032, 15184990, 15193948, 15202910, 15211872,
+    15220836, 15229800, 15238766, 15247734, 15256702, 15265672, 15274642, 15283616,
+    15292590, 15301564, 15310540, 15319518, 15328498, 15337478, 15346460, 15355444,
+    15364428, 15373412, 15382400, 15391388, 15400378, 15409370, 15418362, 15427356,
+    15436350, 15445346, 15454344, 15463342, 15472342, 15481344, 15490348, 15499350,
+    15508356, 15517362, 15526370, 15535380, 15544390, 15553404, 15562416, 15571430,
+    15580446, 15589464, 15598482, 15607500, 15616522, 15625544, 15634568, 15643594,
+    15652620, 15661648, 15670676, 15679706, 15688738, 15697770, 15706804, 15715840,
+    15724876, 15733914, 15742954, 15751994, 15761036, 15770078, 15779124, 15788168,
+    15797216, 15806264, 15815314, 15824364, 15833418, 15842470, 15851526, 15860582,
+    15869640, 15878696, 15887758, 15896818, 15905880, 15914944, 15924010, 15933076,
+    15942144, 15951214, 15960284, 15969356, 15978428, 15987502, 15996578, 16005654,
+    16014732, 16023812, 16032892, 16041974, 16051058, 16060142, 16069226, 16078314,
+    16087402, 16096492, 16105582, 16114674, 16123770, 16132864, 16141960, 16151056,
+    16160156, 16169254, 16178356, 16187458, 16196562, 16205666, 16214774, 16223882,
+    16232990, 16242100, 16251210, 16260324, 16269438, 16278552, 16287670, 16296786,
+    16305906, 16315026, 16324148, 16333270, 16342394, 16351520, 16360646, 16369774,
+    16378904, 16388034, 16397166, 16406298, 16415432, 16424568, 16433706, 16442844,
+    16451982, 16461124, 16470266, 16479408, 16488554, 16497698, 16506846, 16515994,
+    16525144, 16534294, 16543446, 16552600, 16561754, 16570910, 16580068, 16589226,
+    16598386, 16607546, 16616708, 16625872, 16635036, 16644202, 16653370, 16662538,
+    16671708, 16680878, 16690050, 16699224, 16708400, 16717576, 16726752, 16735932,
+    16745110, 16754292, 16763474, 16772658, 8390921, 8395515, 8400108, 8404702,
+    8409297, 8413893, 8418489, 8423086, 8427683, 8432282, 8436880, 8441479,
+    8446079, 8450680, 8455281, 8459883, 8464485, 8469088, 8473692, 8478296,
+    8482901, 8487507, 8492113, 8496720, 8501327, 8505936, 8510544, 8515154,
+    8519764, 8524374, 8528985, 8533597, 8538210, 8542823, 8547436, 8552051,
+    8556666, 8561281, 8565898, 8570514, 8575132, 8579750, 8584368, 8588988,
+    8593608, 8598228, 8602849, 8607471, 8612094, 8616716, 8621340, 8625964,
+    8630589, 8635215, 8639841, 8644467, 8649095, 8653723, 8658351, 8662980,
+    8667610, 8672241, 8676872, 8681504, 8686136, 8690769, 8695402, 8700037,
+    8704671, 8709307, 8713943, 8718579, 8723216, 8727854, 8732493, 8737132,
+    8741771, 8746412, 8751053, 8755694, 8760336, 8764979, 8769623, 8774267,
+    8778911, 8783556, 8788203, 8792849, 8797496, 8802144, 8806792, 8811441,
+    8816090, 8820740, 8825391, 8830043, 8834695, 8839347, 8844001, 8848654,
+    8853309, 8857964, 8862619, 8867276, 8871932, 8876590, 8881248, 8885907,
+    8890566, 8895226, 8899887, 8904548, 8909210, 8913872, 8918535, 8923199,
+    8927863, 8932527, 8937193, 8941859, 8946526, 8951193, 8955861, 8960529,
+    8965198, 8969868, 8974538, 8979209, 8983881, 8988553, 8993225, 8997899,
+    9002573, 9007247, 9011922, 9016598, 9021274, 9025951, 9030629, 9035307,
+    9039986, 9044665, 9049345, 9054026, 9058707, 9063389, 9068071, 9072754,
+    9077438, 9082122, 9086807, 9091492, 9096178, 9100865, 9105552, 9110240,
+    9114929, 9119618, 9124307, 9128998, 9133688, 9138380, 9143072, 9147765,
+    9152458, 9157152, 9161846, 9166542, 9171237, 9175933, 9180630, 9185328,
+    9190026, 9194724, 9199423, 9204124, 9208824, 9213525, 9218227, 9222929,
+    9227632, 9232335, 9237040, 9241744, 9246449, 9251155, 9255862, 9260569,
+    9265276, 9269985, 9274694, 9279403, 9284113, 9288824, 9293535, 9298247,
+    9302959, 9307673, 9312386, 9317100, 9321815, 9326531, 9331247, 9335963,
+    9340681, 9345398, 9350117, 9354836, 9359555, 9364275, 9368996, 9373718,
+    9378440, 9383162, 9387885, 9392609, 9397333, 9402058, 9406784, 9411510,
+    9416237, 9420964, 9425692, 9430420, 9435150, 9439879, 9444610, 9449340,
+    9454072, 9458804, 9463537, 9468270, 9473004, 9477738, 9482473, 9487209,
+    9491945, 9496682, 9501419, 9506157, 9510896, 9515635, 9520375, 9525115,
+    9529856, 9534597, 9539340, 9544082, 9548826, 9553569, 9558314, 9563059,
+    9567805, 9572551, 9577298, 9582045, 9586793, 9591542, 9596291, 9601041,
+    9605791, 9610542, 9615294, 9620045, 9624798, 9629552, 9634305, 9639060,
+    9643815, 9648570, 9653327, 9658084, 9662841, 9667599, 9672357, 9677116,
+    9681876, 9686637, 9691398, 9696159, 9700921, 9705684, 9710447, 9715210,
+    9719975, 9724740, 9729506, 9734272, 9739038, 9743806, 9748574, 9753342,
+    9758111, 9762881, 9767651, 9772422, 9777193, 9781965, 9786738, 9791511,
+    9796285, 9801059, 9805834, 9810609, 9815386, 9820162, 9824940, 9829717,
+    9834495, 9839275, 9844054, 9848834, 9853615, 9858396, 9863178, 9867960,
+    9872744, 9877527, 9882311, 9887096, 9891881, 9896667, 9901454, 9906241,
+    9911028, 9915817, 9920606, 9925395, 9930185, 9934975, 9939766, 9944558,
+    9949351, 9954143, 9958937, 9963731, 9968525, 9973320, 9978116, 9982913,
+    9987709, 9992507, 9997305, 10002104, 10006903, 10011702, 10016503, 10021304,
+    10026105, 10030907, 10035710, 10040513, 10045317, 10050121, 10054926, 10059732,
+    10064538, 10069344, 10074152, 10078960, 10083768, 10088577, 10093386, 10098197,
+    10103007, 10107818, 10112630, 10117443, 10122255, 10127069, 10131883, 10136698,
+    10141513, 10146329, 10151145, 10155962, 10160780, 10165598, 10170417, 10175236,
+    10180056, 10184876, 10189697, 10194518, 10199340, 10204163, 10208987, 10213810,
+    10218635, 10223459, 10228285, 10233111, 10237938, 10242765, 10247593, 10252421,
+    10257250, 10262080, 10266910, 10271741, 10276572, 10281403, 10286236, 10291068,
+    10295902, 10300736, 10305571, 10310406, 10315242, 10320078, 10324915, 10329752,
+    10334590, 10339429, 10344268, 10349108, 10353948, 10358789, 10363630, 10368472,
+    10373315, 10378158, 10383001, 10387846, 10392690, 10397536, 10402382, 10407228,
+    10412075, 10416923, 10421771, 10426620, 10431469, 10436319, 10441169, 10446020,
+    10450872, 10455724, 10460577, 10465430, 10470284, 10475138, 10479993, 10484849,
+    10489705, 10494561, 10499418, 10504276, 10509135, 10513994, 10518853, 10523713,
+    10528574, 10533435, 10538296, 10543159, 10548021, 10552885, 10557749, 10562613,
+    10567478, 10572344, 10577210, 10582077, 10586944, 10591812, 10596680, 10601549,
+    10606419, 10611289, 10616159, 10621031, 10625902, 10630775, 10635647, 10640521,
+    10645395, 10650269, 10655145, 10660020, 10664896, 10669773, 10674651, 10679528,
+    10684407, 10689286, 10694165, 10699046, 10703926, 10708807, 10713689, 10718572,
+    10723454, 10728338, 10733222, 10738106, 10742992, 10747877, 10752764, 10757650,
+    10762538, 10767426, 10772314, 10777203, 10782093, 10786983, 10791873, 10796765,
+    10801656, 10806549, 10811441, 10816335, 10821229, 10826124, 10831019, 10835914,
+    10840810, 10845707, 10850605, 10855502, 10860401, 10865300, 10870199, 10875099,
+    10880000, 10884901, 10889803, 10894705, 10899608, 10904512, 10909415, 10914320,
+    10919225, 10924131, 10929037, 10933943, 10938851, 10943758, 10948667, 10953576,
+    10958485, 10963395, 10968306, 10973217, 10978128, 10983040, 10987953, 10992866,
+    10997780, 11002695, 11007610, 11012525, 11017441, 11022358, 11027275, 11032193,
+    11037111, 11042030, 11046949, 11051869, 11056789, 11061710, 11066632, 11071554,
+    11076476, 11081400, 11086323, 11091248, 11096172, 11101098, 11106023, 11110950,
+    11115877, 11120804, 11125732, 11130661, 11135590, 11140520, 11145450, 11150381,
+    11155312, 11160244, 11165177, 11170109, 11175043, 11179977, 11184912, 11189847,
+    11194783, 11199719, 11204656, 11209593, 11214531, 11219469, 11224408, 11229348,
+    11234288, 11239228, 11244170, 11249111, 11254053, 11258996, 11263940, 11268883,
+    11273828, 11278773, 11283718, 11288664, 11293611, 11298558, 11303506, 11308454,
+    11313403, 11318352, 11323302, 11328252, 11333203, 11338154, 11343106, 11348059,
+    11353012, 11357965, 11362919, 11367874, 11372829, 11377785, 11382741, 11387698,
+    11392655, 11397613, 11402572, 11407531, 11412490, 11417450, 11422411, 11427372,
+    11432334, 11437296, 11442259, 11447222, 11452186, 11457150, 11462115, 11467081,
+    11472047, 11477013, 11481980, 11486948, 11491916, 11496885, 11501854, 11506824,
+    11511794, 11516765, 11521736, 11526708, 11531680, 11536653, 11541627, 11546601,
+    11551575, 11556551, 11561526, 11566502, 11571479, 11576456, 11581434, 11586412,
+    11591391, 11596371, 11601350, 11606331, 11611312, 11616293, 11621276, 11626258,
+    11631241, 11636225, 11641209, 11646194, 11651179, 11656165, 11661151, 11666138,
+    11671126, 11676114, 11681102, 11686091, 11691081, 11696071, 11701061, 11706052,
+    11711044, 11716036, 11721029, 11726022, 11731016, 11736010, 11741005, 11746000,
+    11750996, 11755993, 11760990, 11765987, 11770985, 11775984, 11780983, 11785982,
+    11790983, 11795983, 11800984, 11805986, 11810989, 11815991, 11820995, 11825999,
+    11831003, 11836008, 11841013, 11846019, 11851026, 11856033, 11861040, 11866048,
+    11871057, 11876066, 11881076, 11886086, 11891097, 11896108, 11901120, 11906132,
+    11911145, 11916159, 11921172, 11926187, 11931202, 11936217, 11941233, 11946250,
+    11951267, 11956284, 11961303, 11966321, 11971340, 11976360, 11981380, 11986401,
+    11991422, 11996444, 12001466, 12006489, 12011513, 12016537, 12021561, 12026586,
+    12031611, 12036637, 12041664, 12046691, 12051718, 12056746, 12061775, 12066804,
+    12071834, 12076864, 12081895, 12086926, 12091958, 12096990, 12102023, 12107056,
+    12112090, 12117125, 12122160, 12127195, 12132231, 12137267, 12142304, 12147342,
+    12152380, 12157419, 12162458, 12167497, 12172537, 12177578, 12182619, 12187661,
+    12192703, 12197746, 12202789, 12207833, 12212877, 12217922, 12222967, 12228013,
+    12233059, 12238106, 12243154, 12248202, 12253250, 12258299, 12263349, 12268399,
+    12273449, 12278500, 12283552, 12288604, 12293657, 12298710, 12303763, 12308818,
+    12313872, 12318928, 12323983, 12329040, 12334096, 12339154, 12344211, 12349270,
+    12354329, 12359388, 12364448, 12369508, 12374569, 12379631, 12384692, 12389755,
+    12394818, 12399881, 12404946, 12410010, 12415075, 12420141, 12425207, 12430273,
+    12435340, 12440408, 12445476, 12450545, 12455614, 12460684, 12465754, 12470825,
+    12475896, 12480968, 12486040, 12491113, 12496186, 12501260, 12506334, 12511409,
+    12516484, 12521560, 12526637, 12531714, 12536791, 12541869, 12546947, 12552026,
+    12557106, 12562186, 12567266, 12572347, 12577429, 12582511, 12587593, 12592677,
+    12597760, 12602844, 12607929, 12613014, 12618100, 12623186, 12628272, 12633360,
+    12638447, 12643536, 12648624, 12653713, 12658803, 12663893, 12668984, 12674075,
+    12679167, 12684259, 12689352, 12694446, 12699539, 12704634, 12709729, 12714824,
+    12719920, 12725016, 12730113, 12735210, 12740309, 12745407, 12750506, 12755605,
+    12760705, 12765806, 12770907, 12776008, 12781110, 12786213, 12791316, 12796419,
+    12801523, 12806628, 12811733, 12816838, 12821944, 12827051, 12832158, 12837266,
+    12842374, 12847482, 12852591, 12857701, 12862811, 12867922, 12873033, 12878144,
+    12883257, 12888369, 12893482, 12898596, 12903710, 12908825, 12913940, 12919056,
+    12924172, 12929289, 12934406, 12939524, 12944642, 12949761, 12954880, 12960000,
+    12965120, 12970241, 12975362, 12980484, 12985606, 12990729, 12995852, 13000976,
+    13006100, 13011225, 13016350, 13021476, 13026602, 13031729, 13036856, 13041984,
+    13047113, 13052241, 13057371, 13062501, 13067631, 13072762, 13077893, 13083025,
+    13088157, 13093290, 13098423, 13103558, 13108692, 13113827, 13118962, 13124098,
+    13129234, 13134371, 13139509, 13144646, 13149785, 13154924, 13160063, 13165203,
+    13170343, 13175484, 13180626, 13185768, 13190910, 13196053, 13201196, 13206340,
+    13211485, 13216630, 13221775, 13226921, 13232067, 13237214, 13242362, 13247510,
+    13252658, 13257807, 13262956, 13268106, 13273257, 13278408, 13283559, 13288711,
+    13293863, 13299016, 13304170, 13309323, 13314478, 13319633, 13324788, 13329944,
+    13335101, 13340258, 13345415, 13350573, 13355731, 13360890, 13366049, 13371209,
+    13376370, 13381531, 13386692, 13391854, 13397016, 13402179, 13407343, 13412506,
+    13417671, 13422836, 13428001, 13433167, 13438333, 13443500, 13448667, 13453835,
+    13459003, 13464172, 13469342, 13474512, 13479682, 13484853, 13490024, 13495196,
+    13500368, 13505541, 13510714, 13515888, 13521062, 13526237, 13531412, 13536588,
+    13541764, 13546941, 13552118, 13557296, 13562474, 13567653, 13572832, 13578012,
+    13583192, 13588373, 13593554, 13598736, 13603918, 13609101, 13614284, 13619468,
+    13624652, 13629837, 13635022, 13640207, 13645394, 13650580, 13655767, 13660955,
+    13666143, 13671332, 13676521, 13681710, 13686900, 13692091, 13697282, 13702474,
+    13707666, 13712858, 13718051, 13723245, 13728439, 13733633, 13738828, 13744024,
+    13749220, 13754416, 13759613, 13764811, 13770009, 13775207, 13780406, 13785605,
+    13790805, 13796006, 13801207, 13806408, 13811610, 13816812, 13822015, 13827218,
+    13832422, 13837626, 13842831, 13848037, 13853242, 13858449, 13863655, 13868863,
+    13874070, 13879279, 13884487, 13889697, 13894906, 13900116, 13905327, 13910538,
+    13915750, 13920962, 13926175, 13931388, 13936601, 13941816, 13947030, 13952245,
+    13957461, 13962677, 13967893, 13973110, 13978328, 13983546, 13988764, 13993983,
+    13999203, 14004423, 14009643, 14014864, 14020085, 14025307, 14030530, 14035752,
+    14040976, 14046199, 14051424, 14056649, 14061874, 14067100, 14072326, 14077553,
+    14082780, 14088008, 14093236, 14098464, 14103694, 14108923, 14114153, 14119384,
+    14124615, 14129847, 14135079, 14140311, 14145544, 14150778, 14156012, 14161246,
+    14166481, 14171717, 14176953, 14182189, 14187426, 14192663, 14197901, 14203140,
+    14208378, 14213618, 14218858, 14224098, 14229339, 14234580, 14239822, 14245064,
+    14250306, 14255550, 14260793, 14266037, 14271282, 14276527, 14281773, 14287019,
+    14292265, 14297512, 14302760, 14308008, 14313256, 14318505, 14323755, 14329005,
+    14334255, 14339506, 14344757, 14350009, 14355262, 14360514, 14365768, 14371021,
+    14376276, 14381530, 14386786, 14392041, 14397297, 14402554, 14407811, 14413069,
+    14418327, 14423585, 14428844, 14434104, 14439364, 14444625, 14449886, 14455147,
+    14460409, 14465671, 14470934, 14476197, 14481461, 14486726, 14491990, 14497256,
+    14502521, 14507788, 14513054, 14518321, 14523589, 14528857, 14534126, 14539395,
+    14544665, 14549935, 14555205, 14560476, 14565748, 14571020, 14576292, 14581565,
+    14586838, 14592112, 14597387, 14602661, 14607937, 14613212, 14618489, 14623765,
+    14629043, 14634320, 14639598, 14644877, 14650156, 14655436, 14660716, 14665996,
+    14671277, 14676559, 14681841, 14687123, 14692406, 14697689, 14702973, 14708258,
+    14713542, 14718828, 14724113, 14729400, 14734686, 14739973, 14745261, 14750549,
+    14755838, 14761127, 14766416, 14771706, 14776997, 14782288, 14787579, 14792871,
+    14798164, 14803456, 14808750, 14814044, 14819338, 14824633, 14829928, 14835223,
+    14840520, 14845816, 14851113, 14856411, 14861709, 14867008, 14872307, 14877606,
+    14882906, 14888206, 14893507, 14898809, 14904111, 14909413, 14914716, 14920019,
+    14925323, 14930627, 14935931, 14941237, 14946542, 14951848, 14957155, 14962462,
+    14967769, 14973077, 14978386, 14983694, 14989004, 14994314, 14999624, 15004935,
+    15010246, 15015558, 15020870, 15026183, 15031496, 15036809, 15042123, 15047438,
+    15052753, 15058068, 15063384, 15068701, 15074018, 15079335, 15084653, 15089971,
+    15095290, 15100609, 15105929, 15111249, 15116570, 15121891, 15127212, 15132534,
+    15137857, 15143180, 15148503, 15153827, 15159151, 15164476, 15169802, 15175127,
+    15180454, 15185780, 15191107, 15196435, 15201763, 15207092, 15212421, 15217750,
+    15223080, 15228411, 15233742, 15239073, 15244405, 15249737, 15255070, 15260403,
+    15265737, 15271071, 15276406, 15281741, 15287076, 15292412, 15297749, 15303086,
+    15308423, 15313761, 15319100, 15324438, 15329778, 15335117, 15340458, 15345798,
+    15351140, 15356481, 15361823, 15367166, 15372509, 15377852, 15383196, 15388541,
+    15393886, 15399231, 15404577, 15409923, 15415270, 15420617, 15425964, 15431313,
+    15436661, 15442010, 15447360, 15452710, 15458060, 15463411, 15468762, 15474114,
+    15479466, 15484819, 15490172, 15495526, 15500880, 15506235, 15511590, 15516945,
+    15522301, 15527658, 15533015, 15538372, 15543730, 15549088, 15554447, 15559806,
+    15565166, 15570526, 15575887, 15581248, 15586609, 15591971, 15597334, 15602696,
+    15608060, 15613424, 15618788, 15624153, 15629518, 15634883, 15640250, 15645616,
+    15650983, 15656351, 15661719, 15667087, 15672456, 15677825, 15683195, 15688565,
+    15693936, 15699307, 15704679, 15710051, 15715424, 15720797, 15726170, 15731544,
+    15736919, 15742293, 15747669, 15753045, 15758421, 15763797, 15769175, 15774552,
+    15779930, 15785309, 15790688, 15796067, 15801447, 15806828, 15812208, 15817590,
+    15822971, 15828354, 15833736, 15839119, 15844503, 15849887, 15855271, 15860656,
+    15866042, 15871428, 15876814, 15882201, 15887588, 15892976, 15898364, 15903752,
+    15909141, 15914531, 15919921, 15925311, 15930702, 15936093, 15941485, 15946877,
+    15952270, 15957663, 15963057, 15968451, 15973845, 15979240, 15984636, 15990032,
+    15995428, 16000825, 16006222, 16011620, 16017018, 16022417, 16027816, 16033215,
+    16038615, 16044016, 16049416, 16054818, 16060220, 16065622, 16071025, 16076428,
+    16081831, 16087235, 16092640, 16098045, 16103450, 16108856, 16114263, 16119669,
+    16125077, 16130484, 16135892, 16141301, 16146710, 16152120, 16157530, 16162940,
+    16168351, 16173762, 16179174, 16184586, 16189999, 16195412, 16200826, 16206240,
+    16211654, 16217069, 16222484, 16227900, 16233317, 16238733, 16244151, 16249568,
+    16254986, 16260405, 16265824, 16271243, 16276663, 16282084, 16287504, 16292926,
+    16298347, 16303770, 16309192, 16314615, 16320039, 16325463, 16330887, 16336312,
+    16341737, 16347163, 16352589, 16358016, 16363443, 16368871, 16374299, 16379727,
+    16385156, 16390585, 16396015, 16401446, 16406876, 16412307, 16417739, 16423171,
+    16428604, 16434037, 16439470, 16444904, 16450338, 16455773, 16461208, 16466644,
+    16472080, 16477516, 16482953, 16488391, 16493829, 16499267, 16504706, 16510145,
+    16515585, 16521025, 16526466, 16531907, 16537348, 16542790, 16548232, 16553675,
+    16559119, 16564562, 16570006, 16575451, 16580896, 16586342, 16591788, 16597234,
+    16602681, 16608128, 16613576, 16619024, 16624473, 16629922, 16635371, 16640821,
+    16646272, 16651723, 16657174, 16662626, 16668078, 16673530, 16678984, 16684437,
+    16689891, 16695346, 16700800, 16706256, 16711712, 16717168, 16722624, 16728082,
+    16733539, 16738997, 16744456, 16749914, 16755374, 16760834, 16766294, 16771754,
+    16777210, 8391336, 8394067, 8396799, 8399530, 8402260, 8404993, 8407725,
+    8410457, 8413190, 8415923, 8418656, 8421390, 8424122, 8426856, 8429591,
+    8432323, 8435057, 8437793, 8440528, 8443263, 8445998, 8448732, 8451469,
+    8454206, 8456941, 8459677, 8462414, 8465151, 8467888, 8470625, 8473363,
+    8476099, 8478838, 8481575, 8484315, 8487053, 8489792, 8492530, 8495269,
+    8498009, 8500748, 8503489, 8506229, 8508969, 8511710, 8514450, 8517192,
+    8519932, 8522673, 8525415, 8528158, 8530899, 8533641, 8536384, 8539127,
+    8541870, 8544612, 8547357, 8550101, 8552844, 8555588, 8558332, 8561077,
+    8563821, 8566567, 8569312, 8572057, 8574803, 8577548, 8580295, 8583040,
+    8585787, 8588533, 8591281, 8594028, 8596774, 8599522, 8602270, 8605018,
+    8607767, 8610515, 8613263, 8616012, 8618761, 8621510, 8624261, 8627010,
+    8629760, 8632511, 8635261, 8638012, 8640762, 8643514, 8646265, 8649017,
+    8651769, 8654519, 8657272, 8660025, 8662777, 8665530, 8668283, 8671037,
+    8673790, 8676544, 8679297, 8682051, 8684806, 8687561, 8690315, 8693070,
+    8695826, 8698581, 8701337, 8704092, 8706849, 8709604, 8712362, 8715119,
+    8717876, 8720632, 8723390, 8726147, 8728905, 8731663, 8734421, 8737180,
+    8739939, 8742699, 8745458, 8748216, 8750976, 8753735, 8756496, 8759256,
+    8762017, 8764777, 8767538, 8770300, 8773061, 8775822, 8778584, 8781345,
+    8784108, 8786870, 8789633, 8792396, 8795158, 8797922, 8800686, 8803449,
+    8806214, 8808978, 8811742, 8814506, 8817271, 8820036, 8822802, 8825567,
+    8828333, 8831098, 8833864, 8836631, 8839397, 8842164, 8844931, 8847698,
+    8850466, 8853233, 8856001, 8858769, 8861537, 8864306, 8867074, 8869843,
+    8872613, 8875382, 8878151, 8880921, 8883691, 8886461, 8889231, 8892003,
+    8894773, 8897544, 8900316, 8903088, 8905858, 8908630, 8911403, 8914175,
+    8916948, 8919720, 8922494, 8925267, 8928040, 8930814, 8933588, 8936362,
+    8939137, 8941911, 8944685, 8947461, 8950235, 8953011, 8955786, 8958562,
+    8961339, 8964115, 8966891, 8969668, 8972445, 8975222, 8977999, 8980777,
+    8983554, 8986332, 8989110, 8991889, 8994668, 8997446, 9000225, 9003004,
+    9005784, 9008563, 9011344, 9014123, 9016904, 9019685, 9022465, 9025246,
+    9028028, 9030808, 9033590, 9036372, 9039154, 9041936, 9044719, 9047502,
+    9050284, 9053067, 9055851, 9058634, 9061418, 9064201, 9066987, 9069771,
+    9072556, 9075340, 9078126, 9080910, 9083696, 9086482, 9089268, 9092053,
+    9094840, 9097626, 9100413, 9103200, 9105987, 9108775, 9111562, 9114350,
+    9117138, 9119926, 9122715, 9125503, 9128292, 9131082, 9133870, 9136661,
+    9139449, 9142240, 9145029, 9147820, 9150611, 9153401, 9156192, 9158984,
+    9161775, 9164567, 9167359, 9170151, 9172943, 9175735, 9178528, 9181321,
+    9184114, 9186906, 9189701, 9192495, 9195289, 9198083, 9200876, 9203672,
+    9206467, 9209262, 9212057, 9214853, 9217647, 9220444, 9223240, 9226037,
+    9228833, 9231630, 9234427, 9237224, 9240021, 9242818, 9245616, 9248414,
+    9251213, 9254011, 9256811, 9259609, 9262407, 9265207, 9268006, 9270806,
+    9273607, 9276406, 9279207, 9282006, 9284807, 9287609, 9290410, 9293211,
+    9296013, 9298814, 9301617, 9304419, 9307221, 9310023, 9312827, 9315630,
+    9318433, 9321237, 9324040, 9326843, 9329648, 9332452, 9335257, 9338062,
+    9340867, 9343672, 9346478, 9349282, 9352088, 9354895, 9357701, 9360507,
+    9363314, 9366121, 9368928, 9371735, 9374543, 9377350, 9380158, 9382966,
+    9385775, 9388583, 9391393, 9394201, 9397010, 9399820, 9402629, 9405438,
+    9408249, 9411059, 9413870, 9416679, 9419490, 9422302, 9425113, 9427924,
+    9430736, 9433548, 9436361, 9439173, 9441986, 9444798, 9447610, 9450424,
+    9453237, 9456051, 9458865, 9461679, 9464493, 9467308, 9470121, 9472937,
+    9475752, 9478568, 9481383, 9484199, 9487014, 9489830, 9492646, 9495464,
+    9498279, 9501097, 9503914, 9506731, 9509548, 9512367, 9515184, 9518002,
+    9520821, 9523639, 9526458, 9529277, 9532097, 9534917, 9537735, 9540555,
+    9543376, 9546195, 9549016, 9551836, 9554658, 9557479, 9560300, 9563121,
+    9565944, 9568766, 9571587, 9574410, 9577232, 9580055, 9582878, 9585700,
+    9588525, 9591349, 9594172, 9596996, 9599820, 9602645, 9605470, 9608294,
+    9611119, 9613944, 9616770, 9619596, 9622421, 9625247, 9628074, 9630900,
+    9633727, 9636555, 9639381, 9642208, 9645035, 9647864, 9650691, 9653519,
+    9656348, 9659176, 9662005, 9664833, 9667663, 9670492, 9673323, 9676153,
+    9678982, 9681812, 9684642, 9687473, 9690304, 9693135, 9695966, 9698797,
+    9701629, 9704462, 9707294, 9710126, 9712959, 9715791, 9718625, 9721457,
+    9724290, 9727124, 9729957, 9732792, 9735626, 9738459, 9741294, 9744129,
+    9746964, 9749800, 9752635, 9755471, 9758307, 9761142, 9763978, 9766815,
+    9769651, 9772489, 9775325, 9778162, 9780999, 9783838, 9786675, 9789514,
+    9792351, 9795190, 9798030, 9800868, 9803707, 9806546, 9809385, 9812225,
+    9815065, 9817905, 9820746, 9823586, 9826427, 9829267, 9832108, 9834950,
+    9837792, 9840634, 9843475, 9846318, 9849160, 9852002, 9854846, 9857688,
+    9860532, 9863376, 9866219, 9869063, 9871907, 9874750, 9877595, 9880440,
+    9883285, 9886130, 9888975, 9891821, 9894666, 9897512, 9900358, 9903204,
+    9906050, 9908897, 9911744, 9914591, 9917439, 9920286, 9923134, 9925981,
+    9928830, 9931678, 9934526, 9937375, 9940224, 9943073, 9945922, 9948772,
+    9951622, 9954472, 9957322, 9960172, 9963023, 9965874, 9968724, 9971575,
+    9974428, 9977279, 9980130, 9982982, 9985835, 9988687, 9991540, 9994392,
+    9997246, 10000098, 10002951, 10005806, 10008660, 10011513, 10014367, 10017222,
+    10020076, 10022932, 10025786, 10028642, 10031497, 10034353, 10037208, 10040064,
+    10042921, 10045777, 10048634, 10051491, 10054348, 10057206, 10060063, 10062921,
+    10065778, 10068637, 10071494, 10074353, 10077212, 10080071, 10082929, 10085788,
+    10088648, 10091508, 10094368, 10097228, 10100088, 10102948, 10105810, 10108671,
+    10111532, 10114393, 10117255, 10120116, 10122977, 10125840, 10128702, 10131565,
+    10134427, 10137290, 10140154, 10143018, 10145880, 10148745, 10151608, 10154473,
+    10157338, 10160202, 10163067, 10165932, 10168797, 10171662, 10174527, 10177393,
+    10180260, 10183125, 10185991, 10188859, 10191725, 10194592, 10197459, 10200326,
+    10203194, 10206061, 10208929, 10211798, 10214667, 10217534, 10220404, 10223272,
+    10226142, 10229011, 10231881, 10234751, 10237620, 10240491, 10243361, 10246232,
+    10249103, 10251974, 10254844, 10257716, 10260588, 10263460, 10266331, 10269204,
+    10272076, 10274949, 10277822, 10280694, 10283568, 10286441, 10289315, 10292188,
+    10295062, 10297937, 10300811, 10303686, 10306560, 10309435, 10312311, 10315186,
+    10318062, 10320937, 10323814, 10326690, 10329567, 10332443, 10335319, 10338197,
+    10341073, 10343951, 10346829, 10349708, 10352585, 10355463, 10358342, 10361221,
+    10364098, 10366977, 10369858, 10372736, 10375617, 10378496, 10381376, 10384256,
+    10387137, 10390018, 10392898, 10395779, 10398661, 10401542, 10404423, 10407305,
+    10410188, 10413069, 10415952, 10418834, 10421717, 10424601, 10427484, 10430368,
+    10433250, 10436134, 10439018, 10441902, 10444788, 10447672, 10450557, 10453442,
+    10456327, 10459212, 10462098, 10464984, 10467869, 10470756, 10473642, 10476529,
+    10479415, 10482303, 10485189, 10488077, 10490965, 10493853, 10496740, 10499628,
+    10502517, 10505406, 10508294, 10511184, 10514072, 10516962, 10519851, 10522741,
+    10525632, 10528522, 10531412, 10534302, 10537193, 10540084, 10542976, 10545866,
+    10548757, 10551650, 10554542, 10557433, 10560326, 10563219, 10566112, 10569004,
+    10571897, 10574791, 10577685, 10580578, 10583472, 10586366, 10589260, 10592155,
+    10595050, 10597945, 10600840, 10603735, 10606631, 10609526, 10612423, 10615318,
+    10618214, 10621111, 10624009, 10626905, 10629802, 10632698, 10635596, 10638494,
+    10641392, 10644290, 10647189, 10650087, 10652986, 10655885, 10658784, 10661683,
+    10664582, 10667482, 10670381, 10673282, 10676182, 10679082, 10681983, 10684884,
+    10687785, 10690686, 10693588, 10696490, 10699391, 10702294, 10705196, 10708098,
+    10711000, 10713903, 10716807, 10719710, 10722613, 10725517, 10728421, 10731325,
+    10734229, 10737133, 10740037, 10742943, 10745847, 10748752, 10751658, 10754563,
+    10757470, 10760375, 10763282, 10766187, 10769094, 10772002, 10774908, 10777815,
+    10780723, 10783629, 10786537, 10789445, 10792354, 10795261, 10798170, 10801079,
+    10803989, 10806898, 10809807, 10812716, 10815625, 10818536, 10821446, 10824355,
+    10827267, 10830177, 10833088, 10835998, 10838910, 10841821, 10844733, 10847645,
+    10850558, 10853469, 10856381, 10859294, 10862207, 10865120, 10868033, 10870946,
+    10873860, 10876774, 10879688, 10882603, 10885517, 10888431, 10891345, 10894261,
+    10897176, 10900092, 10903007, 10905922, 10908838, 10911755, 10914670, 10917587,
+    10920503, 10923421, 10926338, 10929255, 10932173, 10935091, 10938009, 10940927,
+    10943845, 10946763, 10949682, 10952600, 10955519, 10958438, 10961359, 10964278,
+    10967197, 10970118, 10973038, 10975959, 10978879, 10981800, 10984720, 10987642,
+    10990563, 10993484, 10996406, 10999328, 11002251, 11005173, 11008096, 11011019,
+    11013940, 11016865, 11019788, 11022711, 11025635, 11028558, 11031482, 11034407,
+    11037331, 11040256, 11043181, 11046106, 11049032, 11051956, 11054883, 11057808,
+    11060734, 11063661, 11066586, 11069514, 11072441, 11075368, 11078295, 11081222,
+    11084150, 11087078, 11090006, 11092934, 11095862, 11098791, 11101719, 11104648,
+    11107577, 11110506, 11113435, 11116366, 11119295, 11122226, 11125156, 11128087,
+    11131017, 11133948, 11136879, 11139810, 11142742, 11145673, 11148605, 11151536,
+    11154470, 11157401, 11160334, 11163268, 11166199, 11169133, 11172067, 11175000,
+    11177933, 11180867, 11183802, 11186736, 11189670, 11192605, 11195540, 11198475,
+    11201410, 11204346, 11207282, 11210217, 11213154, 11216090, 11219027, 11221962,
+    11224900, 11227836, 11230774, 11233711, 11236649, 11239587, 11242525, 11245464,
+    11248402, 11251340, 11254278, 11257217, 11260157, 11263096, 11266036, 11268975,
+    11271916, 11274855, 11277796, 11280736, 11283677, 11286618, 11289558, 11292499,
+    11295441, 11298383, 11301325, 11304267, 11307209, 11310150, 11313094, 11316037,
+    11318980, 11321923, 11324866, 11327809, 11330753, 11333697, 11336642, 11339585,
+    11342530, 11345475, 11348419, 11351365, 11354309, 11357255, 11360201, 11363146,
+    11366092, 11369039, 11371985, 11374932, 11377879, 11380826, 11383773, 11386721,
+    11389668, 11392615, 11395563, 11398511, 11401459, 11404409, 11407357, 11410305,
+    11413255, 11416204, 11419154, 11422103, 11425053, 11428003, 11430953, 11433904,
+    11436854, 11439805, 11442756, 11445708, 11448659, 11451611, 11454561, 11457513,
+    11460465, 11463419, 11466371, 11469324, 11472276, 11475229, 11478182, 11481136,
+    11484090, 11487043, 11489998, 11492952, 11495906, 11498861, 11501816, 11504770,
+    11507725, 11510681, 11513636, 11516592, 11519548, 11522504, 11525461, 11528417,
+    11531374, 11534331, 11537288, 11540245, 11543202, 11546160, 11549118, 11552075,
+    11555034, 11557992, 11560950, 11563910, 11566868, 11569828, 11572787, 11575747,
+    11578706, 11581666, 11584625, 11587586, 11590546, 11593508, 11596469, 11599430,
+    11602390, 11605352, 11608313, 11611275, 11614237, 11617199, 11620162, 11623124,
+    11626087, 11629050, 11632012, 11634976, 11637940, 11640904, 11643867, 11646832,
+    11649795, 11652759, 11655724, 11658690, 11661655, 11664619, 11667585, 11670551,
+    11673515, 11676483, 11679448, 11682414, 11685381, 11688347, 11691314, 11694281,
+    11697249, 11700217, 11703184, 11706151, 11709120, 11712088, 11715056, 11718025,
+    11720993, 11723963, 11726932, 11729901, 11732870, 11735840, 11738810, 11741780,
+    11744750, 11747721, 11750692, 11753663, 11756634, 11759605, 11762575, 11765548,
+    11768520, 11771491, 11774463, 11777435, 11780408, 11783381, 11786354, 11789326,
+    11792300, 11795273, 11798246, 11801221, 11804194, 11807169, 11810144, 11813118,
+    11816093, 11819068, 11822042, 11825018, 11827993, 11830969, 11833945, 11836921,
+    11839897, 11842874, 11845850, 11848827, 11851804, 11854782, 11857759, 11860736,
+    11863714, 11866692, 11869670, 11872648, 11875627, 11878605, 11881584, 11884564,
+    11887543, 11890523, 11893501, 11896481, 11899462, 11902442, 11905422, 11908403,
+    11911383, 11914364, 11917345, 11920326, 11923309, 11926290, 11929272, 11932254,
+    11935236, 11938219, 11941201, 11944184, 11947167, 11950150, 11953133, 11956117,
+    11959100, 11962085, 11965069, 11968053, 11971037, 11974022, 11977006, 11979991,
+    11982977, 11985962, 11988948, 11991934, 11994920, 11997906, 12000892, 12003879,
+    12006865, 12009853, 12012839, 12015826, 12018814, 12021802, 12024789, 12027778,
+    12030766, 12033753, 12036742, 12039732, 12042720, 12045709, 12048698, 12051688,
+    12054678, 12057668, 12060658, 12063647, 12066639, 12069628, 12072619, 12075610,
+    12078601, 12081593, 12084585, 12087576, 12090568, 12093561, 12096553, 12099545,
+    12102537, 12105530, 12108523, 12111516, 12114510, 12117503, 12120496, 12123491,
+    12126485, 12129480, 12132474, 12135468, 12138463, 12141458, 12144454, 12147449,
+    12150445, 12153440, 12156436, 12159432, 12162429, 12165425, 12168422, 12171419,
+    12174416, 12177413, 12180411, 12183408, 12186405, 12189404, 12192401, 12195400,
+    12198399, 12201397, 12204397, 12207396, 12210395, 12213394, 12216394, 12219394,
+    12222394, 12225394, 12228395, 12231395, 12234396, 12237396, 12240397, 12243399,
+    12246400, 12249403, 12252404, 12255406, 12258409, 12261410, 12264413, 12267416,
+    12270418, 12273422, 12276425, 12279429, 12282433, 12285436, 12288440, 12291445,
+    12294449, 12297454, 12300458, 12303463, 12306468, 12309474, 12312479, 12315486,
+    12318490, 12321497, 12324503, 12327510, 12330516, 12333524, 12336530, 12339537,
+    12342545, 12345552, 12348560, 12351568, 12354576, 12357585, 12360592, 12363601,
+    12366611, 12369619, 12372628, 12375638, 12378648, 12381657, 12384667, 12387676,
+    12390686, 12393698, 12396709, 12399719, 12402730, 12405741, 12408752, 12411764,
+    12414776, 12417787, 12420800, 12423812, 12426825, 12429837, 12432850, 12435863,
+    12438877, 12441890, 12444903, 12447917, 12450931, 12453945, 12456960, 12459975,
+    12462988, 12466003, 12469018, 12472033, 12475049, 12478064, 12481081, 12484097,
+    12487112, 12490128, 12493146, 12496162, 12499179, 12502196, 12505213, 12508231,
+    12511248, 12514266, 12517283, 12520302, 12523320, 12526338, 12529357, 12532376,
+    12535396, 12538415, 12541433, 12544453, 12547474, 12550494, 12553514, 12556534,
+    12559554, 12562575, 12565595, 12568616, 12571638, 12574659, 12577681, 12580703,
+    12583724, 12586747, 12589769, 12592792, 12595814, 12598837, 12601861, 12604883,
+    12607907, 12610929, 12613953, 12616977, 12620002, 12623026, 12626051, 12629075,
+    12632100, 12635125, 12638150, 12641175, 12644201, 12647226, 12650253, 12653279,
+    12656305, 12659332, 12662358, 12665384, 12668412, 12671440, 12674467, 12677495,
+    12680522, 12683550, 12686578, 12689606, 12692635, 12695664, 12698693, 12701722,
+    12704751, 12707780, 12710810, 12713840, 12716869, 12719899, 12722930, 12725960,
+    12728990, 12732022, 12735052, 12738083, 12741115, 12744146, 12747179, 12750210,
+    12753241, 12756274, 12759307, 12762339, 12765372, 12768404, 12771438, 12774471,
+    12777505, 12780539, 12783573, 12786607, 12789640, 12792676, 12795709, 12798745,
+    12801780, 12804815, 12807850, 12810885, 12813922, 12816957, 12819993, 12823028,
+    12826066, 12829102, 12832139, 12835176, 12838213, 12841251, 12844287, 12847325,
+    12850362, 12853401, 12856439, 12859478, 12862517, 12865554, 12868593, 12871632,
+    12874672, 12877711, 12880750, 12883791, 12886831, 12889871, 12892911, 12895951,
+    12898993, 12902033, 12905074, 12908116, 12911157, 12914199, 12917240, 12920283,
+    12923324, 12926367, 12929410, 12932452, 12935495, 12938538, 12941582, 12944625,
+    12947669, 12950711, 12953755, 12956799, 12959844, 12962888, 12965932, 12968978,
+    12972023, 12975068, 12978113, 12981158, 12984205, 12987250, 12990297, 12993343,
+    12996390, 12999436, 13002483, 13005529, 13008577, 13011623, 13014671, 13017719,
+    13020767, 13023816, 13026863, 13029911, 13032960, 13036009, 13039058, 13042107,
+    13045156, 13048205, 13051255, 13054304, 13057355, 13060405, 13063455, 13066506,
+    13069557, 13072607, 13075659, 13078709, 13081761, 13084812, 13087865, 13090916,
+    13093968, 13097021, 13100074, 13103126, 13106179, 13109232, 13112285, 13115339,
+    13118392, 13121446, 13124500, 13127554, 13130608, 13133662, 13136717, 13139771,
+    13142827, 13145882, 13148937, 13151992, 13155048, 13158104, 13161160, 13164216,
+    13167273, 13170329, 13173386, 13176442, 13179500, 13182557, 13185615, 13188673,
+    13191730, 13194788, 13197846, 13200905, 13203963, 13207022, 13210081, 13213140,
+    13216199, 13219258, 13222317, 13225378, 13228437, 13231497, 13234558, 13237618,
+    13240680, 13243740, 13246801, 13249862, 13252923, 13255985, 13259047, 13262108,
+    13265171, 13268233, 13271296, 13274358, 13277420, 13280483, 13283547, 13286610,
+    13289673, 13292737, 13295801, 13298865, 13301929, 13304993, 13308058, 13311123,
+    13314187, 13317252, 13320318, 13323383, 13326449, 13329514, 13332581, 13335646,
+    13338713, 13341779, 13344846, 13347913, 13350979, 13354047, 13357114, 13360182,
+    13363250, 13366316, 13369386, 13372453, 13375521, 13378590, 13381660, 13384728,
+    13387797, 13390866, 13393936, 13397005, 13400075, 13403145, 13406216, 13409286,
+    13412356, 13415427, 13418497, 13421569, 13424641, 13427711, 13430783, 13433854,
+    13436926, 13439999, 13443071, 13446144, 13449217, 13452288, 13455361, 13458434,
+    13461508, 13464581, 13467656, 13470730, 13473803, 13476877, 13479952, 13483027,
+    13486101, 13489176, 13492250, 13495326, 13498401, 13501477, 13504554, 13507629,
+    13510705, 13513781, 13516858, 13519935, 13523011, 13526088, 13529165, 13532243,
+    13535321, 13538398, 13541476, 13544554, 13547633, 13550711, 13553789, 13556868,
+    13559947, 13563027, 13566106, 13569185, 13572264, 13575344, 13578424, 13581505,
+    13584585, 13587664, 13590746, 13593827, 13596907, 13599989, 13603071, 13606151,
+    13609233, 13612315, 13615398, 13618479, 13621561, 13624644, 13627727, 13630810,
+    13633893, 13636976, 13640061, 13643144, 13646228, 13649311, 13652395, 13655480,
+    13658564, 13661649, 13664734, 13667819, 13670905, 13673989, 13677075, 13680160,
+    13683247, 13686332, 13689419, 13692506, 13695592, 13698678, 13701765, 13704853,
+    13707940, 13711027, 13714115, 13717203, 13720291, 13723379, 13726467, 13729557,
+    13732645, 13735734, 13738823, 13741911, 13745001, 13748091, 13751181, 13754270,
+    13757361, 13760451, 13763542, 13766631, 13769723, 13772813, 13775904, 13778996,
+    13782088, 13785178, 13788270, 13791362, 13794455, 13797547, 13800640, 13803732,
+    13806825, 13809918, 13813011, 13816104, 13819199, 13822292, 13825386, 13828479,
+    13831574, 13834668, 13837762, 13840858, 13843952, 13847048, 13850142, 13853238,
+    13856334, 13859429, 13862526, 13865622, 13868719, 13871814, 13874911, 13878008,
+    13881105, 13884202, 13887300, 13890397, 13893495, 13896593, 13899691, 13902789,
+    13905888, 13908986, 13912085, 13915183, 13918283, 13921382, 13924482, 13927581,
+    13930680, 13933781, 13936880, 13939981, 13943082, 13946182, 13949283, 13952384,
+    13955484, 13958586, 13961688, 13964789, 13967891, 13970993, 13974096, 13977198,
+    13980300, 13983403, 13986506, 13989608, 13992711, 13995816, 13998919, 14002022,
+    14005127, 14008230, 14011334, 14014439, 14017543, 14020649, 14023753, 14026859,
+    14029963, 14033069, 14036175, 14039280, 14042386, 14045492, 14048599, 14051706,
+    14054812, 14057918, 14061025, 14064132, 14067241, 14070348, 14073455, 14076563,
+    14079671, 14082779, 14085887, 14088996, 14092105, 14095213, 14098323, 14101432,
+    14104542, 14107651, 14110761, 14113870, 14116981, 14120091, 14123201, 14126312,
+    14129423, 14132534, 14135644, 14138756, 14141867, 14144979, 14148091, 14151203,
+    14154315, 14157427, 14160539, 14163652, 14166766, 14169878, 14172991, 14176104,
+    14179217, 14182332, 14185445, 14188560, 14191674, 14194787, 14197902, 14201018,
+    14204132, 14207247, 14210363, 14213477, 14216593, 14219709, 14222824, 14225940,
+    14229057, 14232173, 14235290, 14238407, 14241524, 14244641, 14247758, 14250875,
+    14253994, 14257111, 14260229, 14263347, 14266466, 14269584, 14272702, 14275821,
+    14278940, 14282058, 14285178, 14288298, 14291417, 14294537, 14297658, 14300777,
+    14303898, 14307017, 14310138, 14313259, 14316380, 14319502, 14322623, 14325744,
+    14328866, 14331988, 14335110, 14338232, 14341354, 14344477, 14347600, 14350723,
+    14353845, 14356968, 14360092, 14363216, 14366340, 14369463, 14372588, 14375712,
+    14378835, 14381960, 14385085, 14388211, 14391335, 14394460, 14397586, 14400711,
+    14403837, 14406963, 14410089, 14413215, 14416342, 14419468, 14422595, 14425722,
+    14428849, 14431976, 14435104, 14438232, 14441359, 14444487, 14447616, 14450744,
+    14453873, 14457001, 14460129, 14463259, 14466387, 14469517, 14472647, 14475776,
+    14478906, 14482036, 14485167, 14488296, 14491427, 14494558, 14497689, 14500820,
+    14503951, 14507082, 14510214, 14513345, 14516477, 14519609, 14522741, 14525873,
+    14529005, 14532139, 14535271, 14538404, 14541538, 14544671, 14547805, 14550938,
+    14554072, 14557206, 14560341, 14563474, 14566609, 14569744, 14572878, 14576014,
+    14579149, 14582285, 14585420, 14588556, 14591692, 14594828, 14597963, 14601101,
+    14604237, 14607374, 14610511, 14613648, 14616784, 14619923, 14623060, 14626198,
+    14629335, 14632474, 14635611, 14638751, 14641889, 14645028, 14648166, 14651306,
+    14654444, 14657584, 14660724, 14663864, 14667003, 14670144, 14673284, 14676425,
+    14679565, 14682706, 14685847, 14688988, 14692129, 14695271, 14698412, 14701554,
+    14704696, 14707839, 14710981, 14714123, 14717265, 14720408, 14723551, 14726695,
+    14729838, 14732980, 14736125, 14739269, 14742412, 14745557, 14748700, 14751845,
+    14754990, 14758135, 14761279, 14764424, 14767570, 14770715, 14773861, 14777007,
+    14780153, 14783299, 14786445, 14789592, 14792738, 14795886, 14799032, 14802179,
+    14805326, 14808474, 14811622, 14814769, 14817918, 14821065, 14824214, 14827362,
+    14830511, 14833661, 14836809, 14839958, 14843108, 14846257, 14849406, 14852557,
+    14855707, 14858857, 14862006, 14865157, 14868307, 14871458, 14874609, 14877760,
+    14880913, 14884064, 14887215, 14890367, 14893520, 14896672, 14899824, 14902976,
+    14906129, 14909281, 14912435, 14915587, 14918741, 14921894, 14925048, 14928201,
+    14931356, 14934510, 14937665, 14940819, 14943973, 14947128, 14950283, 14953439,
+    14956594, 14959750, 14962905, 14966061, 14969217, 14972373, 14975529, 14978685,
+    14981842, 14985000, 14988156, 14991313, 14994471, 14997628, 15000785, 15003944,
+    15007101, 15010260, 15013419, 15016576, 15019735, 15022894, 15026053, 15029212,
+    15032372, 15035530, 15038690, 15041850, 15045010, 15048170, 15051331, 15054491,
+    15057652, 15060813, 15063973, 15067134, 15070297, 15073458, 15076619, 15079781,
+    15082942, 15086105, 15089267, 15092430, 15095592, 15098756, 15101918, 15105082,
+    15108244, 15111408, 15114571, 15117735, 15120899, 15124064, 15127227, 15130392,
+    15133557, 15136722, 15139887, 15143052, 15146217, 15149382, 15152548, 15155714,
+    15158879, 15162045, 15165211, 15168379, 15171545, 15174711, 15177879, 15181046,
+    15184212, 15187380, 15190547, 15193716, 15196883, 15200052, 15203219, 15206388,
+    15209557, 15212726, 15215894, 15219063, 15222233, 15225402, 15228572, 15231742,
+    15234911, 15238081, 15241251, 15244423, 15247593, 15250764, 15253934, 15257105,
+    15260276, 15263447, 15266620, 15269791, 15272964, 15276135, 15279307, 15282480,
+    15285652, 15288825, 15291997, 15295171, 15298343, 15301517, 15304691, 15307865,
+    15311038, 15314212, 15317387, 15320561, 15323736, 15326910, 15330085, 15333260,
+    15336435, 15339611, 15342786, 15345961, 15349137, 15352313, 15355490, 15358666,
+    15361842, 15365018, 15368196, 15371372, 15374550, 15377727, 15380905, 15384082,
+    15387260, 15390437, 15393616, 15396795, 15399972, 15403151, 15406330, 15409509,
+    15412688, 15415868, 15419046, 15422226, 15425407, 15428587, 15431767, 15434947,
+    15438127, 15441308, 15444488, 15447669, 15450851, 15454032, 15457213, 15460395,
+    15463576, 15466758, 15469940, 15473122, 15476305, 15479487, 15482670, 15485852,
+    15489036, 15492219, 15495403, 15498585, 15501769, 15504953, 15508138, 15511322,
+    15514506, 15517691, 15520876, 15524060, 15527245, 15530430, 15533616, 15536801,
+    15539986, 15543173, 15546359, 15549544, 15552730, 15555917, 15559104, 15562291,
+    15565478, 15568665, 15571852, 15575040, 15578227, 15581415, 15584603, 15587791,
+    15590979, 15594168, 15597357, 15600546, 15603733, 15606923, 15610112, 15613301,
+    15616491, 15619681, 15622870, 15626060, 15629252, 15632442, 15635632, 15638822,
+    15642013, 15645205, 15648396, 15651588, 15654779, 15657970, 15661162, 15664354,
+    15667546, 15670738, 15673931, 15677124, 15680316, 15683509, 15686703, 15689895,
+    15693089, 15696283, 15699477, 15702671, 15705865, 15709059, 15712254, 15715448,
+    15718643, 15721838, 15725033, 15728229, 15731424, 15734619, 15737815, 15741010,
+    15744207, 15747403, 15750600, 15753796, 15756993, 15760190, 15763387, 15766584,
+    15769781, 15772978, 15776176, 15779374, 15782573, 15785770, 15788969, 15792167,
+    15795366, 15798565, 15801764, 15804963, 15808162, 15811362, 15814561, 15817761,
+    15820961, 15824161, 15827362, 15830562, 15833762, 15836963, 15840164, 15843365,
+    15846567, 15849768, 15852970, 15856171, 15859372, 15862575, 15865778, 15868979,
+    15872182, 15875385, 15878587, 15881790, 15884994, 15888197, 15891401, 15894605,
+    15897809, 15901013, 15904217, 15907421, 15910625, 15913830, 15917035, 15920239,
+    15923444, 15926650, 15929856, 15933061, 15936267, 15939473, 15942678, 15945885,
+    15949091, 15952298, 15955504, 15958712, 15961919, 15965126, 15968333, 15971541,
+    15974748, 15977956, 15981164, 15984373, 15987581, 15990790, 15993999, 15997208,
+    16000416, 16003626, 16006835, 16010044, 16013254, 16016463, 16019673, 16022884,
+    16026094, 16029304, 16032515, 16035726, 16038936, 16042148, 16045358, 16048570,
+    16051783, 16054994, 16058206, 16061417, 16064630, 16067841, 16071054, 16074267,
+    16077480, 16080693, 16083907, 16087120, 16090334, 16093546, 16096760, 16099975,
+    16103189, 16106403, 16109618, 16112832, 16116047, 16119261, 16122477, 16125692,
+    16128907, 16132123, 16135339, 16138555, 16141771, 16144986, 16148203, 16151420,
+    16154636, 16157854, 16161071, 16164287, 16167505, 16170723, 16173941, 16177157,
+    16180376, 16183594, 16186812, 16190031, 16193249, 16196468, 16199687, 16202906,
+    16206125, 16209344, 16212565, 16215784, 16219004, 16222225, 16225444, 16228664,
+    16231886, 16235106, 16238326, 16241548, 16244768, 16247990, 16251212, 16254433,
+    16257655, 16260878, 16264099, 16267321, 16270544, 16273767, 16276990, 16280213,
+    16283435, 16286658, 16289882, 16293105, 16296329, 16299554, 16302778, 16306002,
+    16309226, 16312450, 16315676, 16318900, 16322125, 16325350, 16328576, 16331801,
+    16335027, 16338252, 16341479, 16344704, 16347931, 16351157, 16354384, 16357611,
+    16360837, 16364064, 16367292, 16370519, 16373747, 16376974, 16380202, 16383430,
+    16386658, 16389886, 16393115, 16396343, 16399572, 16402802, 16406031, 16409260,
+    16412489, 16415720, 16418949, 16422179, 16425408, 16428639, 16431869, 16435100,
+    16438331, 16441562, 16444792, 16448024, 16451256, 16454487, 16457719, 16460951,
+    16464182, 16467414, 16470647, 16473879, 16477112, 16480345, 16483578, 16486811,
+    16490044, 16493278, 16496511, 16499745, 16502978, 16506212, 16509448, 16512682,
+    16515916, 16519150, 16522386, 16525620, 16528855, 16532091, 16535326, 16538562,
+    16541797, 16545034, 16548270, 16551506, 16554743, 16557978, 16561215, 16564453,
+    16567690, 16570927, 16574165, 16577401, 16580639, 16583877, 16587115, 16590353,
+    16593591, 16596831, 16600069, 16603308, 16606547, 16609786, 16613026, 16616265,
+    16619504, 16622745, 16625984, 16629224, 16632464, 16635704, 16638945, 16642185,
+    16645427, 16648668, 16651909, 16655150, 16658392, 16661633, 16664875, 16668117,
+    16671359, 16674602, 16677844, 16681087, 16684330, 16687571, 16690816, 16694059,
+    16697302, 16700545, 16703789, 16707033, 16710276, 16713521, 16716765, 16720009,
+    16723255, 16726499, 16729745, 16732989, 16736235, 16739480, 16742726, 16745971,
+    16749217, 16752464, 16755709, 16758956, 16762203, 16765448, 16768695, 16771943,
+    16775190, 8389219, 8390843, 8392467, 8394090, 8395714, 8397338, 8398962,
+    8400587, 8402211, 8403836, 8405460, 8407084, 8408709, 8410334, 8411958,
+    8413583, 8415208, 8416833, 8418458, 8420083, 8421708, 8423334, 8424959,
+    8426585, 8428210, 8429836, 8431461, 8433087, 8434713, 8436339, 8437965,
+    8439591, 8441218, 8442843, 8444470, 8446097, 8447723, 8449349, 8450976,
+    8452603, 8454229, 8455857, 8457483, 8459110, 8460738, 8462365, 8463992,
+    8465619, 8467247, 8468874, 8470502, 8472129, 8473757, 8475385, 8477013,
+    8478640, 8480269, 8481897, 8483525, 8485154, 8486782, 8488410, 8490039,
+    8491667, 8493296, 8494925, 8496553, 8498182, 8499811, 8501441, 8503070,
+    8504699, 8506328, 8507957, 8509587, 8511216, 8512846, 8514476, 8516105,
+    8517735, 8519365, 8520995, 8522625, 8524255, 8525886, 8527516, 8529146,
+    8530777, 8532407, 8534038, 8535669, 8537299, 8538930, 8540561, 8542192,
+    8543823, 8545455, 8547086, 8548717, 8550348, 8551980, 8553611, 8555243,
+    8556875, 8558507, 8560138, 8561771, 8563402, 8565034, 8566667, 8568299,
+    8569931, 8571563, 8573196, 8574828, 8576461, 8578094, 8579727, 8581360,
+    8582993, 8584626, 8586259, 8587892, 8589525, 8591158, 8592792, 8594425,
+    8596059, 8597693, 8599326, 8600960, 8602594, 8604228, 8605862, 8607496,
+    8609130, 8610764, 8612399, 8614033, 8615668, 8617303, 8618937, 8620572,
+    8622206, 8623842, 8625477, 8627111, 8628747, 8630382, 8632017, 8633653,
+    8635288, 8636924, 8638559, 8640195, 8641830, 8643466, 8645102, 8646738,
+    8648374, 8650010, 8651646, 8653283, 8654919, 8656556, 8658192, 8659829,
+    8661466, 8663102, 8664739, 8666376, 8668013, 8669650, 8671287, 8672925,
+    8674562, 8676199, 8677836, 8679474, 8681112, 8682749, 8684387, 8686025,
+    8687663, 8689300, 8690939, 8692577, 8694215, 8695853, 8697492, 8699130,
+    8700769, 8702407, 8704046, 8705685, 8707324, 8708963, 8710601, 8712240,
+    8713880, 8715519, 8717158, 8718798, 8720437, 8722077, 8723716, 8725356,
+    8726995, 8728635, 8730276, 8731915, 8733555, 8735196, 8736836, 8738476,
+    8740116, 8741757, 8743398, 8745038, 8746678, 8748320, 8749961, 8751601,
+    8753242, 8754883, 8756524, 8758166, 8759807, 8761449, 8763090, 8764731,
+    8766373, 8768015, 8769656, 8771298, 8772940, 8774582, 8776224, 8777867,
+    8779508, 8781151, 8782793, 8784436, 8786078, 8787721, 8789363, 8791006,
+    8792649, 8794292, 8795935, 8797578, 8799221, 8800865, 8802507, 8804151,
+    8805795, 8807438, 8809082, 8810725, 8812369, 8814013, 8815657, 8817301,
+    8818945, 8820589, 8822233, 8823878, 8825522, 8827166, 8828811, 8830456,
+    8832100, 8833745, 8835390, 8837034, 8838680, 8840325, 8841969, 8843615,
+    8845260, 8846906, 8848551, 8850197, 8851842, 8853488, 8855134, 8856779,
+    8858425, 8860071, 8861717, 8863364, 8865010, 8866656, 8868302, 8869949,
+    8871595, 8873242, 8874889, 8876535, 8878182, 8879829, 8881476, 8883123,
+    8884770, 8886417, 8888064, 8889712, 8891359, 8893007, 8894654, 8896302,
+    8897950, 8899598, 8901246, 8902894, 8904542, 8906190, 8907837, 8909486,
+    8911134, 8912783, 8914431, 8916080, 8917728, 8919377, 8921026, 8922675,
+    8924324, 8925973, 8927622, 8929271, 8930921, 8932570, 8934219, 8935868,
+    8937518, 8939168, 8940817, 8942467, 8944117, 8945767, 8947417, 8949067,
+    8950717, 8952368, 8954018, 8955669, 8957319, 8958969, 8960620, 8962270,
+    8963922, 8965572, 8967223, 8968874, 8970525, 8972177, 8973828, 8975479,
+    8977130, 8978782, 8980434, 8982085, 8983736, 8985388, 8987040, 8988692,
+    8990344, 8991996, 8993648, 8995301, 8996953, 8998605, 9000258, 9001910,
+    9003563, 9005216, 9006868, 9008521, 9010174, 9011827, 9013480, 9015133,
+    9016786, 9018440, 9020093, 9021746, 9023400, 9025054, 9026707, 9028361,
+    9030015, 9031668, 9033322, 9034977, 9036630, 9038285, 9039939, 9041593,
+    9043248, 9044902, 9046557, 9048212, 9049866, 9051521, 9053176, 9054831,
+    9056486, 9058141, 9059796, 9061451, 9063107, 9064762, 9066417, 9068073,
+    9069729, 9071385, 9073040, 9074696, 9076352, 9078008, 9079664, 9081320,
+    9082977, 9084633, 9086289, 9087946, 9089602, 9091259, 9092915, 9094572,
+    9096229, 9097886, 9099543, 9101200, 9102858, 9104514, 9106172, 9107829,
+    9109487, 9111144, 9112801, 9114459, 9116117, 9117775, 9119432, 9121090,
+    9122749, 9124407, 9126065, 9127723, 9129381, 9131040, 9132699, 9134357,
+    9136015, 9137674, 9139333, 9140992, 9142651, 9144310, 9145969, 9147628,
+    9149287, 9150947, 9152606, 9154266, 9155925, 9157585, 9159245, 9160905,
+    9162565, 9164224, 9165884, 9167544, 9169204, 9170865, 9172525, 9174185,
+    9175846, 9177507, 9179167, 9180828, 9182488, 9184149, 9185810, 9187471,
+    9189132, 9190793, 9192454, 9194115, 9195777, 9197439, 9199100, 9200762,
+    9202423, 9204085, 9205746, 9207408, 9209071, 9210733, 9212394, 9214057,
+    9215719, 9217381, 9219044, 9220706, 9222369, 9224032, 9225694, 9227357,
+    9229020, 9230683, 9232346, 9234009, 9235672, 9237335, 9238998, 9240662,
+    9242325, 9243989, 9245653, 9247316, 9248980, 9250644, 9252307, 9253971,
+    9255636, 9257300, 9258964, 9260628, 9262292, 9263957, 9265622, 9267286,
+    9268950, 9270615, 9272280, 9273945, 9275610, 9277275, 9278940, 9280605,
+    9282270, 9283936, 9285601, 9287266, 9288932, 9290598, 9292263, 9293929,
+    9295595, 9297261, 9298927, 9300593, 9302259, 9303925, 9305591, 9307258,
+    9308925, 9310591, 9312258, 9313925, 9315591, 9317258, 9318925, 9320591,
+    9322259, 9323926, 9325593, 9327260, 9328928, 9330595, 9332263, 9333930,
+    9335598, 9337265, 9338933, 9340601, 9342269, 9343937, 9345605, 9347273,
+    9348942, 9350610, 9352278, 9353947, 9355615, 9357283, 9358952, 9360621,
+    9362290, 9363959, 9365628, 9367297, 9368966, 9370635, 9372304, 9373974,
+    9375643, 9377312, 9378982, 9380652, 9382321, 9383991, 9385661, 9387331,
+    9389001, 9390671, 9392341, 9394011, 9395682, 9397352, 9399023, 9400693,
+    9402364, 9404035, 9405705, 9407376, 9409047, 9410718, 9412389, 9414060,
+    9415731, 9417402, 9419074, 9420745, 9422417, 9424088, 9425760, 9427431,
+    9429103, 9430775, 9432447, 9434119, 9435792, 9437464, 9439135, 9440808,
+    9442481, 9444153, 9445826, 9447498, 9449171, 9450843, 9452516, 9454189,
+    9455862, 9457535, 9459209, 9460882, 9462555, 9464228, 9465902, 9467575,
+    9469249, 9470922, 9472596, 9474270, 9475943, 9477618, 9479292, 9480965,
+    9482640, 9484314, 9485988, 9487663, 9489337, 9491012, 9492687, 9494361,
+    9496036, 9497710, 9499386, 9501061, 9502736, 9504411, 9506086, 9507761,
+    9509437, 9511112, 9512787, 9514463, 9516139, 9517814, 9519490, 9521166,
+    9522842, 9524518, 9526194, 9527870, 9529546, 9531222, 9532899, 9534575,
+    9536252, 9537928, 9539605, 9541282, 9542959, 9544636, 9546313, 9547989,
+    9549666, 9551344, 9553021, 9554699, 9556376, 9558053, 9559731, 9561408,
+    9563087, 9564764, 9566442, 9568120, 9569797, 9571476, 9573154, 9574832,
+    9576510, 9578189, 9579867, 9581546, 9583224, 9584903, 9586582, 9588260,
+    9589939, 9591618, 9593298, 9594976, 9596656, 9598335, 9600014, 9601694,
+    9603373, 9605053, 9606732, 9608412, 9610092, 9611772, 9613451, 9615131,
+    9616811, 9618492, 9620172, 9621852, 9623532, 9625213, 9626893, 9628574,
+    9630254, 9631935, 9633616, 9635297, 9636978, 9638658, 9640340, 9642021,
+    9643702, 9645383, 9647065, 9648746, 9650428, 9652109, 9653791, 9655473,
+    9657155, 9658837, 9660518, 9662201, 9663883, 9665565, 9667247, 9668929,
+    9670612, 9672294, 9673977, 9675659, 9677342, 9679024, 9680708, 9682390,
+    9684074, 9685756, 9687439, 9689123, 9690806, 9692489, 9694173, 9695856,
+    9697540, 9699223, 9700907, 9702591, 9704275, 9705959, 9707643, 9709327,
+    9711011, 9712695, 9714380, 9716064, 9717748, 9719433, 9721118, 9722802,
+    9724487, 9726172, 9727856, 9729542, 9731227, 9732912, 9734597, 9736282,
+    9737967, 9739652, 9741338, 9743024, 9744709, 9746395, 9748081, 9749766,
+    9751452, 9753139, 9754824, 9756511, 9758197, 9759883, 9761569, 9763256,
+    9764942, 9766629, 9768316, 9770002, 9771689, 9773376, 9775063, 9776750,
+    9778437, 9780124, 9781811, 9783498, 9785186, 9786873, 9788561, 9790248,
+    9791936, 9793624, 9795311, 9796999, 9798687, 9800375, 9802063, 9803752,
+    9805440, 9807128, 9808816, 9810505, 9812194, 9813882, 9815571, 9817259,
+    9818948, 9820637, 9822326, 9824015, 9825704, 9827393, 9829082, 9830772,
+    9832461, 9834151, 9835841, 9837530, 9839220, 9840909, 9842599, 9844289,
+    9845979, 9847669, 9849359, 9851050, 9852740, 9854430, 9856120, 9857811,
+    9859501, 9861192, 9862883, 9864574, 9866264, 9867955, 9869646, 9871338,
+    9873028, 9874720, 9876411, 9878102, 9879793, 9881485, 9883176, 9884868,
+    9886560, 9888252, 9889943, 9891635, 9893328, 9895020, 9896712, 9898404,
+    9900096, 9901789, 9903481, 9905173, 9906866, 9908559, 9910251, 9911944,
+    9913637, 9915330, 9917023, 9918716, 9920410, 9922103, 9923796, 9925490,
+    9927183, 9928876, 9930570, 9932264, 9933957, 9935651, 9937345, 9939039,
+    9940733, 9942427, 9944121, 9945815, 9947510, 9949204, 9950898, 9952593,
+    9954288, 9955982, 9957677, 9959372, 9961067, 9962762, 9964457, 9966152,
+    9967847, 9969542, 9971238, 9972933, 9974628, 9976324, 9978019, 9979715,
+    9981411, 9983107, 9984803, 9986499, 9988195, 9989891, 9991587, 9993283,
+    9994980, 9996676, 9998373, 10000069, 10001766, 10003462, 10005159, 10006856,
+    10008553, 10010250, 10011947, 10013644, 10015341, 10017039, 10018736, 10020433,
+    10022131, 10023828, 10025526, 10027224, 10028922, 10030619, 10032317, 10034015,
+    10035713, 10037411, 10039109, 10040808, 10042506, 10044204, 10045903, 10047602,
+    10049300, 10050999, 10052697, 10054396, 10056095, 10057794, 10059493, 10061192,
+    10062891, 10064591, 10066290, 10067990, 10069689, 10071389, 10073089, 10074788,
+    10076488, 10078188, 10079888, 10081587, 10083288, 10084988, 10086688, 10088389,
+    10090089, 10091789, 10093490, 10095190, 10096891, 10098591, 10100292, 10101993,
+    10103694, 10105395, 10107096, 10108797, 10110498, 10112200, 10113901, 10115603,
+    10117304, 10119006, 10120707, 10122409, 10124111, 10125813, 10127515, 10129216,
+    10130918, 10132621, 10134323, 10136026, 10137728, 10139430, 10141133, 10142835,
+    10144538, 10146240, 10147943, 10149646, 10151349, 10153052, 10154755, 10156458,
+    10158162, 10159864, 10161568, 10163271, 10164975, 10166679, 10168382, 10170086,
+    10171790, 10173494, 10175198, 10176902, 10178606, 10180310, 10182014, 10183718,
+    10185423, 10187127, 10188831, 10190536, 10192241, 10193945, 10195650, 10197355,
+    10199060, 10200765, 10202470, 10204175, 10205881, 10207586, 10209291, 10210996,
+    10212702, 10214408, 10216113, 10217819, 10219524, 10221230, 10222936, 10224642,
+    10226349, 10228055, 10229760, 10231467, 10233174, 10234880, 10236586, 10238293,
+    10239999, 10241706, 10243413, 10245120, 10246827, 10248534, 10250240, 10251948,
+    10253655, 10255362, 10257070, 10258777, 10260484, 10262192, 10263900, 10265607,
+    10267315, 10269023, 10270731, 10272439, 10274147, 10275855, 10277563, 10279272,
+    10280980, 10282688, 10284397, 10286105, 10287814, 10289522, 10291231, 10292940,
+    10294649, 10296358, 10298067, 10299776, 10301485, 10303195, 10304904, 10306613,
+    10308323, 10310033, 10311742, 10313452, 10315162, 10316871, 10318581, 10320291,
+    10322001, 10323712, 10325421, 10327132, 10328842, 10330552, 10332263, 10333974,
+    10335684, 10337395, 10339105, 10340816, 10342527, 10344238, 10345949, 10347660,
+    10349372, 10351083, 10352794, 10354505, 10356217, 10357928, 10359640, 10361352,
+    10363063, 10364775, 10366487, 10368199, 10369911, 10371623, 10373335, 10375048,
+    10376760, 10378472, 10380184, 10381897, 10383609, 10385322, 10387035, 10388748,
+    10390461, 10392174, 10393887, 10395599, 10397313, 10399026, 10400739, 10402453,
+    10404166, 10405880, 10407593, 10409307, 10411021, 10412734, 10414449, 10416162,
+    10417876, 10419590, 10421304, 10423019, 10424733, 10426447, 10428161, 10429876,
+    10431591, 10433305, 10435020, 10436735, 10438449, 10440165, 10441880, 10443594,
+    10445310, 10447025, 10448740, 10450456, 10452171, 10453887, 10455602, 10457317,
+    10459033, 10460749, 10462465, 10464181, 10465897, 10467613, 10469329, 10471045,
+    10472761, 10474477, 10476194, 10477910, 10479627, 10481343, 10483060, 10484777,
+    10486494, 10488211, 10489928, 10491645, 10493362, 10495079, 10496796, 10498514,
+    10500231, 10501948, 10503665, 10505383, 10507101, 10508818, 10510536, 10512254,
+    10513972, 10515690, 10517409, 10519127, 10520844, 10522563, 10524282, 10526000,
+    10527719, 10529437, 10531156, 10532874, 10534593, 10536312, 10538031, 10539750,
+    10541469, 10543188, 10544907, 10546626, 10548346, 10550065, 10551784, 10553504,
+    10555224, 10556944, 10558663, 10560383, 10562103, 10563823, 10565543, 10567263,
+    10568981, 10570700, 10572421, 10574141, 10575862, 10577581, 10579304, 10581024,
+    10582745, 10584464, 10586185, 10587906, 10589628, 10591349, 10593069,
+};
+
+/* intensity stereo coef table */
+static const int32_t is_table[2][16] = {
+{
+    0, 1772721, 3070444, 4194304, 5318164, 6615887, 8388608, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+},
+{
+    8388608, 6615887, 5318164, 4194304, 3070444, 1772721, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+},
+};
+
+static const int32_t is_table_lsf[2][2][16] = {
+{
+{
+    8388608, 7053950, 8388608, 5931642, 8388608, 4987896, 8388608, 4194304,
+    8388608, 3526975, 8388608, 2965821, 8388608, 2493948, 8388608, 2097152,
+},
+{
+    8388608, 8388608, 7053950, 8388608, 5931642, 8388608, 4987896, 8388608,
+    4194304, 8388608, 3526975, 8388608, 2965821, 8388608, 2493948, 8388608,
+},
+},
+{
+{
+    8388608, 5931642, 8388608, 4194304, 8388608, 2965821, 8388608, 2097152,
+    8388608, 1482910, 8388608, 1048576, 8388608, 741455, 8388608, 524288,
+},
+{
+    8388608, 8388608, 5931642, 8388608, 4194304, 8388608, 2965821, 8388608,
+    2097152, 8388608, 1482910, 8388608, 1048576, 8388608, 741455, 8388608,
+},
+},
+};
+
+static const int32_t csa_table[8][2] = {
+{
+    7193172, -4315903,
+},
+{
+    7396588, -3957174,
+},
+{
+    7966062, -2628800,
+},
+{
+    8248640, -1525998,
+},
+{
+    8351008, -793345,
+},
+{
+    8381566, -343644,
+},
+{
+    8387762, -119106,
+},
+{
+    8388550, -31037,
+},
+};
+
+static const int32_t mdct_win[8][36] = {
+{
+    365906, 1094933, 1815627, 2522503, 3210181, 3873428, 4507196, 5106661,
+    5667261, 6184731, 6655130, 7074880, 7440786, 7750063, 8000358, 8189764,
+    8316842, 8380624, 8380624, 8316842, 8189764, 8000358, 7750063, 7440786,
+    7074880, 6655130, 6184731, 5667261, 5106661, 4507196, 3873428, 3210181,
+    2522503, 1815627, 1094933, 365906,
+},
+{
+    365906, 1094933, 1815627, 2522503, 3210181, 3873428, 4507196, 5106661,
+    5667261, 6184731, 6655130, 7074880, 7440786, 7750063, 8000358, 8189764,
+    8316842, 8380624, 8388608, 8388608, 8388608, 8388608, 8388608, 8388608,
+    8316842, 7750063, 6655130, 5106661, 3210181, 1094933, 0, 0,
+    0, 0, 0, 0,
+},
+{
+    1094933, 3210181, 5106661, 6655130, 7750063, 8316842, 8316842, 7750063,
+    6655130, 5106661, 3210181, 1094933, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0,
+},
+{
+    0, 0, 0, 0, 0, 0, 1094933, 3210181,
+    5106661, 6655130, 7750063, 8316842, 8388608, 8388608, 8388608, 8388608,
+    8388608, 8388608, 8380624, 8316842, 8189764, 8000358, 7750063, 7440786,
+    7074880, 6655130, 6184731, 5667261, 5106661, 4507196, 3873428, 3210181,
+    2522503, 1815627, 1094933, 365906,
+},
+{
+    365906, -1094933, 1815627, -2522503, 3210181, -3873428, 4507196, -5106661,
+    5667261, -6184731, 6655130, -7074880, 7440786, -7750063, 8000358, -8189764,
+    8316842, -8380624, 8380624, -8316842, 8189764, -8000358, 7750063, -7440786,
+    7074880, -6655130, 6184731, -5667261, 5106661, -4507196, 3873428, -3210181,
+    2522503, -1815627, 1094933, -365906,
+},
+{
+    365906, -1094933, 1815627, -2522503, 3210181, -3873428, 4507196, -5106661,
+    5667261, -6184731, 6655130, -7074880, 7440786, -7750063, 8000358, -8189764,
+    8316842, -8380624, 8388608, -8388608, 8388608, -8388608, 8388608, -8388608,
+    8316842, -7750063, 6655130, -5106661, 3210181, -1094933, 0, 0,
+    0, 0, 0, 0,
+},
+{
+    1094933, -3210181, 5106661, -6655130, 7750063, -8316842, 8316842, -7750063,
+    6655130, -5106661, 3210181, -1094933, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0,
+},
+{
+    0, 0, 0, 0, 0, 0, 1094933, -3210181,
+    5106661, -6655130, 7750063, -8316842, 8388608, -8388608, 8388608, -8388608,
+    8388608, -8388608, 8380624, -8316842, 8189764, -8000358, 7750063, -7440786,
+    7074880, -6655130, 6184731, -5667261, 5106661, -4507196, 3873428, -3210181,
+    2522503, -1815627, 1094933, -365906,
+},
+};
+
+/* lower 2 bits: modulo 3, higher bits: shift */
+static const uint16_t scale_factor_modshift[64] = {
+    0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 16, 17, 18, 20,
+    21, 22, 24, 25, 26, 28, 29, 30, 32, 33, 34, 36, 37, 38, 40, 41,
+    42, 44, 45, 46, 48, 49, 50, 52, 53, 54, 56, 57, 58, 60, 61, 62,
+    64, 65, 66, 68, 69, 70, 72, 73, 74, 76, 77, 78, 80, 81, 82, 84,
+};
+
+/* [i][j]:  2^(-j/3) * FRAC_ONE * 2^(i+2) / (2^(i+2) - 1) */
+static const int32_t scale_factor_mult[15][3] = {
+{
+    22369620, 17754778, 14091977,
+},
+{
+    19173960, 15218381, 12078838,
+},
+{
+    17895696, 14203823, 11273582,
+},
+{
+    17318416, 13745635, 10909918,
+},
+{
+    17043520, 13527450, 10736745,
+},
+{
+    16909320, 13420936, 10652204,
+},
+{
+    16843008, 13368304, 10610430,
+},
+{
+    16810048, 13342143, 10589666,
+},
+{
+    16793616, 13329101, 10579315,
+},
+{
+    16785412, 13322590, 10574147,
+},
+{
+    16781312, 13319335, 10571564,
+},
+{
+    16779264, 13317710, 10570274,
+},
+{
+    16778240, 13316897, 10569629,
+},
+{
+    16777728, 13316491, 10569306,
+},
+{
+    16777472, 13316288, 10569145,
+},
+};
+
+static const MPA_INT window[512] = {
+    0, -1, -1, -1, -1, -1, -1, -2,
+    -2, -2, -2, -3, -3, -4, -4, -5,
+    -5, -6, -7, -7, -8, -9, -10, -11,
+    -13, -14, -16, -17, -19, -21, -24, -26,
+    -29, -31, -35, -38, -41, -45, -49, -53,
+    -58, -63, -68, -73, -79, -85, -91, -97,
+    -104, -111, -117, -125, -132, -139, -147, -154,
+    -161, -169, -176, -183, -190, -196, -202, -208,
+    213, 218, 222, 225, 227, 228, 228, 227,
+    224, 221, 215, 208, 200, 189, 177, 163,
+    146, 127, 106, 83, 57, 29, -2, -36,
+    -72, -111, -153, -197, -244, -294, -347, -401,
+    -459, -519, -581, -645, -711, -779, -848, -919,
+    -991, -1064, -1137, -1210, -1283, -1356, -1428, -1498,
+    -1567, -1634, -1698, -1759, -1817, -1870, -1919, -1962,
+    -2001, -2032, -2057, -2075, -2085, -2087, -2080, -2063,
+    2037, 2000, 1952, 1893, 1822, 1739, 1644, 1535,
+    1414, 1280, 1131, 970, 794, 605, 402, 185,
+    -45, -288, -545, -814, -1095, -1388, -1692, -2006,
+    -2330, -2663, -3004, -3351, -3705, -4063, -4425, -4788,
+    -5153, -5517, -5879, -6237, -6589, -6935, -7271, -7597,
+    -7910, -8209, -8491, -8755, -8998, -9219, -9416, -9585,
+    -9727, -9838, -9916, -9959, -9966, -9935, -9863, -9750,
+    -9592, -9389, -9139, -8840, -8492, -8092, -7640, -7134,
+    6574, 5959, 5288, 4561, 3776, 2935, 2037, 1082,
+    70, -998, -2122, -3300, -4533, -5818, -7154, -8540,
+    -9975, -11455, -12980, -14548, -16155, -17799, -19478, -21189,
+    -22929, -24694, -26482, -28289, -30112, -31947, -33791, -35640,
+    -37489, -39336, -41176, -43006, -44821, -46617, -48390, -50137,
+    -51853, -53534, -55178, -56778, -58333, -59838, -61289, -62684,
+    -64019, -65290, -66494, -67629, -68692, -69679, -70590, -71420,
+    -72169, -72835, -73415, -73908, -74313, -74630, -74856, -74992,
+    75038, 74992, 74856, 74630, 74313, 73908, 73415, 72835,
+    72169, 71420, 70590, 69679, 68692, 67629, 66494, 65290,
+    64019, 62684, 61289, 59838, 58333, 56778, 55178, 53534,
+    51853, 50137, 48390, 46617, 44821, 43006, 41176, 39336,
+    37489, 35640, 33791, 31947, 30112, 28289, 26482, 24694,
+    22929, 21189, 19478, 17799, 16155, 14548, 12980, 11455,
+    9975, 8540, 7154, 5818, 4533, 3300, 2122, 998,
+    -70, -1082, -2037, -2935, -3776, -4561, -5288, -5959,
+    6574, 7134, 7640, 8092, 8492, 8840, 9139, 9389,
+    9592, 9750, 9863, 9935, 9966, 9959, 9916, 9838,
+    9727, 9585, 9416, 9219, 8998, 8755, 8491, 8209,
+    7910, 7597, 7271, 6935, 6589, 6237, 5879, 5517,
+    5153, 4788, 4425, 4063, 3705, 3351, 3004, 2663,
+    2330, 2006, 1692, 1388, 1095, 814, 545, 288,
+    45, -185, -402, -605, -794, -970, -1131, -1280,
+    -1414, -1535, -1644, -1739, -1822, -1893, -1952, -2000,
+    2037, 2063, 2080, 2087, 2085, 2075, 2057, 2032,
+    2001, 1962, 1919, 1870, 1817, 1759, 1698, 1634,
+    1567, 1498, 1428, 1356, 1283, 1210, 1137, 1064,
+    991, 919, 848, 779, 711, 645, 581, 519,
+    459, 401, 347, 294, 244, 197, 153, 111,
+    72, 36, 2, -29, -57, -83, -106, -127,
+    -146, -163, -177, -189, -200, -208, -215, -221,
+    -224, -227, -228, -228, -227, -225, -222, -218,
+    213, 208, 202, 196, 190, 183, 176, 169,
+    161, 154, 147, 139, 132, 125, 117, 111,
+    104, 97, 91, 85, 79, 73, 68, 63,
+    58, 53, 49, 45, 41, 38, 35, 31,
+    29, 26, 24, 21, 19, 17, 16, 14,
+    13, 11, 10, 9, 8, 7, 7, 6,
+    5, 5, 4, 4, 3, 3, 2, 2,
+    2, 2, 1, 1, 1, 1, 1, 1,
+};
+
@@ -0,0 +1,85 @@
+/* Run time selection of the SIMD kernels. */
+
+#ifndef NO_MPAUDEC
+
+#include "simd.h"
+
+#ifdef MPAUDEC_SIMD
+
+#ifdef _MSC_VER
+#    include <intrin.h>
+#else
+#    include <cpuid.h>
+#endif
+
+static void cpuid(int leaf, unsigned int regs[4])
+{
+#if defined(_MSC_VER) && _MSC_VER >= 1500
+    __cpuidex((int *)regs, leaf, 0);
+#elif defined(_MSC_VER)
+    __cpuid((int *)regs, leaf);
+#else
+    __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/* XCR0: which register sets the OS saves on context switches */
+static unsigned int xgetbv0(void)
+{
+#if defined(_MSC_VER)
+#    if _MSC_VER >= 1600
+    return (unsigned int)_xgetbv(0);
+#    else
+    return 0;
+#    endif
+#else
+    unsigned int eax, edx;
+    __asm__ (".byte 0x0f, 0x01, 0xd0" : "=a" (eax), "=d" (edx) : "c" (0));
+    return eax;
+#endif
+}
+
+static int detect(void)
+{
+    unsigned int regs[4];
+    unsigned int max_leaf;
+    int level = MPAUDEC_SIMD_NONE;
+
+    cpuid(0, regs);
+    max_leaf = regs[0];
+    if (max_leaf < 1)
+        return level;
+
+    cpuid(1, regs);
+    if (regs[3] & (1 << 26))
+        level = MPAUDEC_SIMD_SSE2;
+
+#ifdef MPAUDEC_AVX2
+    /* AVX2 needs OSXSAVE and AVX, the OS saving the YMM registers, and
+       the AVX2 bit of leaf 7 */
+    if (level == MPAUDEC_SIMD_SSE2 && max_leaf >= 7 &&
+        (regs[2] & (1 << 27)) && (regs[2] & (1 << 28)) &&
+        (xgetbv0() & 6) == 6)
+    {
+        cpuid(7, regs);
+        if (regs[1] & (1 << 5))
+            level = MPAUDEC_SIMD_AVX2;
+    }
+#endif
+
+    return level;
+}
+
+/* -1 until detected.  Detecting it twice at once is harmless. */
+static volatile int detected_level = -1;
+
+int mpa_simd_detect(void)
+{
+    if (detected_level < 0)
+        detected_level = detect();
+    return detected_level;
+}
+
+#endif /* MPAUDEC_SIMD */
+
+#endif /* NO_MPAUDEC */
@@ -0,0 +1,64 @@
+/* SIMD versions of the synthesis window and the layer 3 IMDCT.  Every
+   kernel produces exactly the same integers as the scalar code in
+   mpaudec.c: products are formed at full 64-bit precision and shifted
+   the same way, only several subbands or output samples are computed at
+   once. */
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include "fixed.h"
+#include "mpaudec.h"
+
+/* MPAUDEC_SIMD: the SSE2 kernels and CPU detection are built.
+   MPAUDEC_AVX2: the compiler can build the AVX2 kernels too. */
+#if !defined(NO_MPAUDEC_SIMD) && FRAC_BITS > 15 && \
+    (defined(__i386__) || defined(__x86_64__) || \
+     defined(_M_IX86) || defined(_M_X64)) && \
+    (!defined(_MSC_VER) || _MSC_VER >= 1400)
+#    define MPAUDEC_SIMD
+#    if !defined(_MSC_VER) || _MSC_VER >= 1800
+#        define MPAUDEC_AVX2
+#    endif
+#endif
+
+/* 0.5 / cos(pi*(2*i+1)/36) and 0.5 / cos(pi*(2*i+19)/72), from mpaudec.c */
+extern const int mpa_icos36[9];
+extern const int mpa_icos72[18];
+
+#ifdef MPAUDEC_SIMD
+
+/* best MPAUDEC_SIMD_* level supported by both the CPU and the OS, which
+   is only detected once */
+int mpa_simd_detect(void);
+
+/* Computes the 32 unrounded sums of the polyphase synthesis window for
+   the ring buffer position 'synth_buf'. */
+typedef void (*MPASynthWindowFunc)(const MPA_INT *window,
+                                   const MPA_INT *synth_buf,
+                                   int64_t sums[32]);
+
+/* Runs the 36 point IMDCT on four consecutive long block subbands,
+   applies win[0..3] and overlaps with mdct_buf, like the first loop of
+   compute_imdct.  'in' and 'mdct_buf' point at the first subband,
+   'out' at its first sample in sb_samples. */
+typedef void (*MPAIMDCT36Func)(int32_t *out,
+                               int32_t *mdct_buf,
+                               const int32_t *in,
+                               const int32_t *const win[4]);
+
+void mpa_synth_window_sse2(const MPA_INT *window, const MPA_INT *synth_buf,
+                           int64_t sums[32]);
+void mpa_imdct36_x4_sse2(int32_t *out, int32_t *mdct_buf,
+                         const int32_t *in, const int32_t *const win[4]);
+
+#ifdef MPAUDEC_AVX2
+void mpa_synth_window_avx2(const MPA_INT *window, const MPA_INT *synth_buf,
+                           int64_t sums[32]);
+void mpa_imdct36_x4_avx2(int32_t *out, int32_t *mdct_buf,
+                         const int32_t *in, const int32_t *const win[4]);
+#endif
+
+#endif /* MPAUDEC_SIMD */
+
+#endif /* SIMD_H */
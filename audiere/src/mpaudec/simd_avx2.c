@@ -0,0 +1,104 @@
+/* AVX2 kernels.  The lanes are the same four as in simd_sse2.c, but
+   AVX2 multiplies signed 32-bit values to 64 bits directly. */
+
+#ifndef NO_MPAUDEC
+
+#include "simd.h"
+#include "mpegaudio.h"
+
+#ifdef MPAUDEC_AVX2
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) && !defined(__AVX2__)
+#    if defined(__clang__)
+#        pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#        define POP_TARGET
+#    else
+#        pragma GCC target("avx2")
+#    endif
+#endif
+
+typedef __m128i V;
+typedef __m256i W;
+
+#define KERNEL(name) name##_avx2
+
+static __inline V v_load(const int32_t *p)
+{
+    return _mm_loadu_si128((const __m128i *)p);
+}
+
+static __inline void v_store(int32_t *p, V a)
+{
+    _mm_storeu_si128((__m128i *)p, a);
+}
+
+static __inline V v_set1(int a)
+{
+    return _mm_set1_epi32(a);
+}
+
+static __inline V v_add(V a, V b)
+{
+    return _mm_add_epi32(a, b);
+}
+
+static __inline V v_sub(V a, V b)
+{
+    return _mm_sub_epi32(a, b);
+}
+
+static __inline V v_reverse(V a)
+{
+    return _mm_shuffle_epi32(a, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+static __inline W w_zero(void)
+{
+    return _mm256_setzero_si256();
+}
+
+static __inline W w_set1(int a)
+{
+    return _mm256_set1_epi64x(a);
+}
+
+static __inline W w_mul(V a, V b)
+{
+    return _mm256_mul_epi32(_mm256_cvtepi32_epi64(a),
+                            _mm256_cvtepi32_epi64(b));
+}
+
+static __inline W w_add(W a, W b)
+{
+    return _mm256_add_epi64(a, b);
+}
+
+static __inline W w_sub(W a, W b)
+{
+    return _mm256_sub_epi64(a, b);
+}
+
+static __inline void w_store(int64_t *p, W a)
+{
+    _mm256_storeu_si256((__m256i *)p, a);
+}
+
+/* A logical shift leaves the same low 32 bits as an arithmetic one. */
+static __inline V w_frac(W a)
+{
+    __m256i s = _mm256_srli_epi64(a, FRAC_BITS);
+    s = _mm256_permutevar8x32_epi32(s, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+    return _mm256_castsi256_si128(s);
+}
+
+#include "simd_kernels.h"
+
+#ifdef POP_TARGET
+#    pragma clang attribute pop
+#endif
+
+#endif /* MPAUDEC_AVX2 */
+
+#endif /* NO_MPAUDEC */
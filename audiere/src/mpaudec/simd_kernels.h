@@ -0,0 +1,216 @@
+/* Kernel bodies shared by simd_sse2.c and simd_avx2.c.  The including
+   file provides the vector types and operations:
+
+     V        4 x int32
+     W        4 x int64
+     v_load, v_store, v_set1, v_add, v_sub, v_reverse
+     w_zero, w_set1, w_mul (signed 32 x 32 -> 64), w_add, w_sub, w_store
+     w_frac   low 32 bits of each lane shifted right by FRAC_BITS
+
+   and KERNEL(name), which appends the instruction set to the names of
+   the entry points.  Only the lane arithmetic differs between the two,
+   so both produce the same integers as the scalar code. */
+
+/* cos(pi*i/18), as in imdct36 */
+#define C1 FIXR(0.98480775301220805936)
+#define C2 FIXR(0.93969262078590838405)
+#define C3 FIXR(0.86602540378443864676)
+#define C4 FIXR(0.76604444311897803520)
+#define C5 FIXR(0.64278760968653932632)
+#define C6 FIXR(0.5)
+#define C7 FIXR(0.34202014332566873304)
+#define C8 FIXR(0.17364817766693034885)
+
+/* MULL and FRAC_RND on four lanes */
+static __inline V v_mull(V a, V b)
+{
+    return w_frac(w_mul(a, b));
+}
+
+static __inline V w_frac_rnd(W a)
+{
+    return w_frac(w_add(a, w_set1(FRAC_ONE / 2)));
+}
+
+/* The window sums of synth_filter, four output samples at a time.
+   Outputs n = 0..15 are
+
+     sum(w[n + 64k] * p[16 + n + 64k]) - sum(w[n + 32 + 64k] * p[48 - n + 64k])
+
+   and outputs 32 - j for j = 1..15 are
+
+     -sum(w[32 - j + 64k] * p[16 + j + 64k]) - sum(w[64 - j + 64k] * p[48 - j + 64k])
+
+   where the descending indices are loaded four at a time and reversed.
+   Integer sums don't depend on the order of the terms, so the result is
+   exact. */
+void KERNEL(mpa_synth_window)(const MPA_INT *window,
+                              const MPA_INT *synth_buf,
+                              int64_t sums[32])
+{
+    int64_t tmp[4];
+    int g, i, k;
+    W acc;
+
+    /* outputs 0 to 15 */
+    for(g=0;g<16;g+=4) {
+        acc = w_zero();
+        for(k=0;k<8;k++) {
+            acc = w_add(acc, w_mul(v_load(window + g + 64 * k),
+                                   v_load(synth_buf + 16 + g + 64 * k)));
+            acc = w_sub(acc, w_mul(v_load(window + 32 + g + 64 * k),
+                                   v_reverse(v_load(synth_buf + 45 - g + 64 * k))));
+        }
+        w_store(sums + g, acc);
+    }
+
+    /* outputs 31 down to 17; the lane for j = 16 is not needed */
+    for(g=1;g<16;g+=4) {
+        acc = w_zero();
+        for(k=0;k<8;k++) {
+            acc = w_sub(acc, w_mul(v_reverse(v_load(window + 29 - g + 64 * k)),
+                                   v_load(synth_buf + 16 + g + 64 * k)));
+            acc = w_sub(acc, w_mul(v_reverse(v_load(window + 61 - g + 64 * k)),
+                                   v_reverse(v_load(synth_buf + 45 - g + 64 * k))));
+        }
+        w_store(tmp, acc);
+        for(i=0;i<4 && g+i<16;i++)
+            sums[32 - g - i] = tmp[i];
+    }
+
+    /* output 16 */
+    sums[16] = 0;
+    for(k=0;k<8;k++)
+        sums[16] -= MUL64(window[48 + 64 * k], synth_buf[32 + 64 * k]);
+}
+
+/* imdct36 plus windowing and overlap for four subbands, one per lane.
+   The steps mirror imdct36 in mpaudec.c line by line. */
+void KERNEL(mpa_imdct36_x4)(int32_t *out,
+                            int32_t *mdct_buf,
+                            const int32_t *in,
+                            const int32_t *const win[4])
+{
+    int32_t t[36][4];
+    V x[18], tmp[18], o[36];
+    V *in1, *tmp1;
+    V t0, t1, t2, t3, s0, s1, s2, s3, r, zero;
+    W in3_3, in6_6;
+    int i, j, l;
+
+    /* one subband per lane */
+    for(i=0;i<18;i++) {
+        for(l=0;l<4;l++)
+            t[i][l] = in[18 * l + i];
+        x[i] = v_load(t[i]);
+    }
+
+    for(i=17;i>=1;i--)
+        x[i] = v_add(x[i], x[i-1]);
+    for(i=17;i>=3;i-=2)
+        x[i] = v_add(x[i], x[i-2]);
+
+    zero = v_set1(0);
+    for(j=0;j<2;j++) {
+        tmp1 = tmp + j;
+        in1 = x + j;
+
+        in3_3 = w_mul(in1[2*3], v_set1(C3));
+        in6_6 = w_mul(in1[2*6], v_set1(C6));
+
+        tmp1[0] = w_frac_rnd(w_add(w_add(w_add(
+                      w_mul(in1[2*1], v_set1(C1)), in3_3),
+                      w_mul(in1[2*5], v_set1(C5))),
+                      w_mul(in1[2*7], v_set1(C7))));
+        tmp1[2] = v_add(in1[2*0], w_frac_rnd(w_add(w_add(w_add(
+                      w_mul(in1[2*2], v_set1(C2)),
+                      w_mul(in1[2*4], v_set1(C4))), in6_6),
+                      w_mul(in1[2*8], v_set1(C8)))));
+        tmp1[4] = w_frac_rnd(w_mul(v_sub(v_sub(in1[2*1], in1[2*5]), in1[2*7]),
+                                   v_set1(C3)));
+        tmp1[6] = v_add(v_sub(w_frac_rnd(w_mul(
+                      v_sub(v_sub(in1[2*2], in1[2*4]), in1[2*8]),
+                      v_set1(C6))), in1[2*6]), in1[2*0]);
+        tmp1[8] = w_frac_rnd(w_add(w_sub(w_sub(
+                      w_mul(in1[2*1], v_set1(C5)), in3_3),
+                      w_mul(in1[2*5], v_set1(C7))),
+                      w_mul(in1[2*7], v_set1(C1))));
+        tmp1[10] = v_add(in1[2*0], w_frac_rnd(w_add(w_add(w_sub(
+                       w_mul(v_sub(zero, in1[2*2]), v_set1(C8)),
+                       w_mul(in1[2*4], v_set1(C2))), in6_6),
+                       w_mul(in1[2*8], v_set1(C4)))));
+        tmp1[12] = w_frac_rnd(w_sub(w_add(w_sub(
+                       w_mul(in1[2*1], v_set1(C7)), in3_3),
+                       w_mul(in1[2*5], v_set1(C1))),
+                       w_mul(in1[2*7], v_set1(C5))));
+        tmp1[14] = v_add(in1[2*0], w_frac_rnd(w_sub(w_add(w_add(
+                       w_mul(v_sub(zero, in1[2*2]), v_set1(C4)),
+                       w_mul(in1[2*4], v_set1(C8))), in6_6),
+                       w_mul(in1[2*8], v_set1(C2)))));
+        tmp1[16] = v_add(v_sub(v_add(v_sub(in1[2*0], in1[2*2]), in1[2*4]),
+                               in1[2*6]), in1[2*8]);
+    }
+
+    i = 0;
+    for(j=0;j<4;j++) {
+        t0 = tmp[i];
+        t1 = tmp[i + 2];
+        s0 = v_add(t1, t0);
+        s2 = v_sub(t1, t0);
+
+        t2 = tmp[i + 1];
+        t3 = tmp[i + 3];
+        s1 = v_mull(v_add(t3, t2), v_set1(mpa_icos36[j]));
+        s3 = v_mull(v_sub(t3, t2), v_set1(mpa_icos36[8 - j]));
+
+        t0 = v_mull(v_add(s0, s1), v_set1(mpa_icos72[9 + 8 - j]));
+        t1 = v_mull(v_sub(s0, s1), v_set1(mpa_icos72[8 - j]));
+        o[18 + 9 + j] = t0;
+        o[18 + 8 - j] = t0;
+        o[9 + j] = v_sub(zero, t1);
+        o[8 - j] = t1;
+
+        t0 = v_mull(v_add(s2, s3), v_set1(mpa_icos72[9 + j]));
+        t1 = v_mull(v_sub(s2, s3), v_set1(mpa_icos72[j]));
+        o[18 + 9 + (8 - j)] = t0;
+        o[18 + j] = t0;
+        o[9 + (8 - j)] = v_sub(zero, t1);
+        o[j] = t1;
+        i += 4;
+    }
+
+    s0 = tmp[16];
+    s1 = v_mull(tmp[17], v_set1(mpa_icos36[4]));
+    t0 = v_mull(v_add(s0, s1), v_set1(mpa_icos72[9 + 4]));
+    t1 = v_mull(v_sub(s0, s1), v_set1(mpa_icos72[4]));
+    o[18 + 9 + 4] = t0;
+    o[18 + 8 - 4] = t0;
+    o[9 + 4] = v_sub(zero, t1);
+    o[8 - 4] = t1;
+
+    /* window, overlap with the previous granule and keep the second half
+       for the next one */
+    for(i=0;i<36;i++) {
+        for(l=0;l<4;l++)
+            t[i][l] = win[l][i];
+    }
+    for(i=0;i<18;i++) {
+        int32_t b[4];
+        for(l=0;l<4;l++)
+            b[l] = mdct_buf[18 * l + i];
+        r = v_add(v_mull(o[i], v_load(t[i])), v_load(b));
+        v_store(out + SBLIMIT * i, r);
+        v_store(b, v_mull(o[i + 18], v_load(t[i + 18])));
+        for(l=0;l<4;l++)
+            mdct_buf[18 * l + i] = b[l];
+    }
+}
+
+#undef C1
+#undef C2
+#undef C3
+#undef C4
+#undef C5
+#undef C6
+#undef C7
+#undef C8
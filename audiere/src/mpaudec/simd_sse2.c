@@ -0,0 +1,134 @@
+/* SSE2 kernels.  SSE2 has no signed 32 x 32 -> 64 multiply, so w_mul
+   uses the unsigned one and corrects the high half. */
+
+#ifndef NO_MPAUDEC
+
+#include "simd.h"
+#include "mpegaudio.h"
+
+#ifdef MPAUDEC_SIMD
+
+#include <emmintrin.h>
+
+#if defined(__GNUC__) && !defined(__SSE2__)
+#    if defined(__clang__)
+#        pragma clang attribute push (__attribute__((target("sse2"))), apply_to = function)
+#        define POP_TARGET
+#    else
+#        pragma GCC target("sse2")
+#    endif
+#endif
+
+typedef __m128i V;
+
+/* lanes 0 and 2 in 'even', lanes 1 and 3 in 'odd' */
+typedef struct W {
+    __m128i even;
+    __m128i odd;
+} W;
+
+#define KERNEL(name) name##_sse2
+
+static __inline V v_load(const int32_t *p)
+{
+    return _mm_loadu_si128((const __m128i *)p);
+}
+
+static __inline void v_store(int32_t *p, V a)
+{
+    _mm_storeu_si128((__m128i *)p, a);
+}
+
+static __inline V v_set1(int a)
+{
+    return _mm_set1_epi32(a);
+}
+
+static __inline V v_add(V a, V b)
+{
+    return _mm_add_epi32(a, b);
+}
+
+static __inline V v_sub(V a, V b)
+{
+    return _mm_sub_epi32(a, b);
+}
+
+static __inline V v_reverse(V a)
+{
+    return _mm_shuffle_epi32(a, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+static __inline W w_zero(void)
+{
+    W r;
+    r.even = r.odd = _mm_setzero_si128();
+    return r;
+}
+
+/* 'a' must be between 0 and 2^31 - 1 */
+static __inline W w_set1(int a)
+{
+    W r;
+    r.even = r.odd = _mm_set_epi32(0, a, 0, a);
+    return r;
+}
+
+/* signed products of lanes 0 and 2:
+   a * b = au * bu - 2^32 * ((a < 0 ? b : 0) + (b < 0 ? a : 0)) mod 2^64 */
+static __inline __m128i mul_even(__m128i a, __m128i b)
+{
+    __m128i p = _mm_mul_epu32(a, b);
+    __m128i c = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b),
+                              _mm_and_si128(_mm_srai_epi32(b, 31), a));
+    return _mm_sub_epi64(p, _mm_slli_epi64(c, 32));
+}
+
+static __inline W w_mul(V a, V b)
+{
+    W r;
+    r.even = mul_even(a, b);
+    r.odd = mul_even(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return r;
+}
+
+static __inline W w_add(W a, W b)
+{
+    W r;
+    r.even = _mm_add_epi64(a.even, b.even);
+    r.odd = _mm_add_epi64(a.odd, b.odd);
+    return r;
+}
+
+static __inline W w_sub(W a, W b)
+{
+    W r;
+    r.even = _mm_sub_epi64(a.even, b.even);
+    r.odd = _mm_sub_epi64(a.odd, b.odd);
+    return r;
+}
+
+static __inline void w_store(int64_t *p, W a)
+{
+    _mm_storeu_si128((__m128i *)p, _mm_unpacklo_epi64(a.even, a.odd));
+    _mm_storeu_si128((__m128i *)(p + 2), _mm_unpackhi_epi64(a.even, a.odd));
+}
+
+/* A logical shift leaves the same low 32 bits as an arithmetic one. */
+static __inline V w_frac(W a)
+{
+    __m128i e = _mm_srli_epi64(a.even, FRAC_BITS);
+    __m128i o = _mm_srli_epi64(a.odd, FRAC_BITS);
+    return _mm_or_si128(_mm_and_si128(e, _mm_set_epi32(0, -1, 0, -1)),
+                        _mm_slli_epi64(o, 32));
+}
+
+#include "simd_kernels.h"
+
+#ifdef POP_TARGET
+#    pragma clang attribute pop
+#endif
+
+#endif /* MPAUDEC_SIMD */
+
+#endif /* NO_MPAUDEC */
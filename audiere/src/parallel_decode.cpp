@@ -0,0 +1,306 @@
+#ifdef _MSC_VER
+#pragma warning(disable : 4786)
+#endif
+
+
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "basic_source.h"
+#include "debug.h"
+#include "input.h"
+#include "internal.h"
+#include "parallel_decode.h"
+#include "threads.h"
+#include "utility.h"
+
+
+namespace audiere {
+
+  /// Segments shorter than this aren't worth a thread of their own.
+  static const int MIN_SEGMENT_SECONDS = 4;
+
+  /// The smallest buffer worth allocating when the length is unknown.
+  static const int MIN_BUFFER_FRAMES = 4096;
+
+  static volatile long g_thread_count = 0;  // 0 means one per processor
+
+
+  /**
+   * Reads a source until read() returns 0, appending to the first 'frames'
+   * frames of a buffer that has room for 'capacity'.  The buffer doubles
+   * whenever it fills up, so getLength() coming up short costs at most a
+   * few copies, and it is trimmed at the end if that left much of it
+   * unused.
+   *
+   * @return  number of frames in the buffer
+   */
+  static int ReadToEnd(
+    SampleSource* source, int frame_size,
+    u8*& buffer, int capacity, int frames)
+  {
+    bool grown = false;
+    for (;;) {
+      if (frames == capacity) {
+        capacity = std::max(capacity * 2, int(MIN_BUFFER_FRAMES));
+        u8* grown_buffer = new u8[capacity * frame_size];
+        memcpy(grown_buffer, buffer, frames * frame_size);
+        delete[] buffer;
+        buffer = grown_buffer;
+        grown = true;
+      }
+
+      const int read = source->read(
+        capacity - frames, buffer + frames * frame_size);
+      if (read <= 0) {
+        break;
+      }
+      frames += read;
+    }
+
+    if (grown && frames < capacity - capacity / 4) {
+      u8* trimmed = new u8[std::max(frames, 1) * frame_size];
+      memcpy(trimmed, buffer, frames * frame_size);
+      delete[] buffer;
+      buffer = trimmed;
+    }
+    return frames;
+  }
+
+
+  /**
+   * Lets several decoders read one file at the same time.  Each view has
+   * a position of its own, and seeks the shared file there before every
+   * read.  Views are created and destroyed on the loading thread, so the
+   * shared file's reference count is never touched by the workers.
+   */
+  class FileView : public RefImplementation<File> {
+  public:
+    FileView(File* file, Mutex* mutex) {
+      m_file = file;
+      m_mutex = mutex;
+      m_position = 0;
+    }
+
+    int ADR_CALL read(void* buffer, int size) {
+      SYNCHRONIZED(m_mutex);
+      if (!m_file->seek(m_position, File::BEGIN)) {
+        return 0;
+      }
+      const int read = m_file->read(buffer, size);
+      m_position += read;
+      return read;
+    }
+
+    bool ADR_CALL seek(int position, SeekMode mode) {
+      int base = 0;
+      if (mode == CURRENT) {
+        base = m_position;
+      } else if (mode == END) {
+        SYNCHRONIZED(m_mutex);
+        if (!m_file->seek(0, File::END)) {
+          return false;
+        }
+        base = m_file->tell();
+      }
+      if (base + position < 0) {
+        return false;
+      }
+      m_position = base + position;
+      return true;
+    }
+
+    int ADR_CALL tell() {
+      return m_position;
+    }
+
+  private:
+    FilePtr m_file;
+    Mutex* m_mutex;
+    int m_position;
+  };
+
+
+  struct LoadState {
+    Mutex mutex;
+    CondVar done;
+    int running;
+  };
+
+
+  struct Segment {
+    LoadState* state;
+    SampleSourcePtr source;
+    int start;           // first frame of the segment
+    int length;          // frames in the segment
+    u8* out;
+    int frames_read;     // -1 if the segment couldn't be decoded
+  };
+
+
+  static void DecodeSegment(void* opaque) {
+    Segment* s = (Segment*)opaque;
+
+    s->source->setPosition(s->start);
+    if (s->source->getPosition() != s->start) {
+      s->frames_read = -1;
+    } else {
+      s->frames_read = s->source->read(s->length, s->out);
+    }
+
+    SYNCHRONIZED(s->state->mutex);
+    --s->state->running;
+    s->state->done.notify();
+  }
+
+
+  static bool CanDecodeInSegments(FileFormat format) {
+    switch (format) {
+      case FF_WAV:
+      case FF_AIFF:
+      case FF_FLAC:
+      case FF_OGG:
+      case FF_MP3:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+
+  /**
+   * Decodes the segments of a source on worker threads.
+   *
+   * @return  false, without allocating a buffer, if the source can't be
+   *          split up
+   */
+  static bool DecodeInSegments(
+    SampleSource* source, int length, u8*& buffer, int& frames)
+  {
+    ADR_GUARD("DecodeInSegments");
+
+    File* file;
+    FileFormat file_format;
+    if (!BasicSource::FindOrigin(source, file, file_format) ||
+        !CanDecodeInSegments(file_format))
+    {
+      return false;
+    }
+
+    int channel_count, sample_rate;
+    SampleFormat sample_format;
+    source->getFormat(channel_count, sample_rate, sample_format);
+    const int frame_size = channel_count * GetSampleSize(sample_format);
+
+    int count = (g_thread_count > 0 ? g_thread_count : AI_GetProcessorCount());
+    count = std::min(count, length / (sample_rate * MIN_SEGMENT_SECONDS));
+    if (count < 2) {
+      return false;
+    }
+
+    // open a decoder for each segment on a view of the same file
+    Mutex file_mutex;
+    LoadState state;
+    std::vector<Segment> segments(count);
+    for (int i = 0; i < count; ++i) {
+      Segment& s = segments[i];
+      s.source = OpenSource(new FileView(file, &file_mutex), 0, file_format);
+      if (!s.source || !s.source->isSeekable()) {
+        return false;
+      }
+
+      int c, r;
+      SampleFormat f;
+      s.source->getFormat(c, r, f);
+      if (c != channel_count || r != sample_rate || f != sample_format) {
+        return false;
+      }
+
+      s.state       = &state;
+      s.start       = int(i * s64(length) / count);
+      s.length      = int((i + 1) * s64(length) / count) - s.start;
+      s.frames_read = 0;
+    }
+
+    // The length may only be an estimate, so the last segment gets the
+    // headroom at the end of the buffer, and keeps going from there if it
+    // fills that too.
+    const int capacity = length + length / 256;
+    segments[count - 1].length = capacity - segments[count - 1].start;
+
+    // the views move the source's file, so put it back afterwards
+    const int file_position = file->tell();
+
+    buffer = new u8[capacity * frame_size];
+    state.running = 0;
+    for (int i = 0; i < count; ++i) {
+      Segment& s = segments[i];
+      s.out = buffer + s.start * frame_size;
+
+      {
+        SYNCHRONIZED(state.mutex);
+        ++state.running;
+      }
+      if (!AI_CreateThread(DecodeSegment, &s)) {
+        DecodeSegment(&s);  // decode it here instead
+      }
+    }
+
+    {
+      SYNCHRONIZED(state.mutex);
+      while (state.running > 0) {
+        state.done.wait(state.mutex, 1);
+      }
+    }
+
+    // the segments are contiguous up to the first one that came up short
+    frames = 0;
+    for (int i = 0; i < count; ++i) {
+      Segment& s = segments[i];
+      if (s.frames_read < 0) {
+        file->seek(file_position, File::BEGIN);
+        delete[] buffer;
+        buffer = 0;
+        return false;
+      }
+      frames = s.start + s.frames_read;
+      if (s.frames_read < s.length) {
+        break;
+      }
+    }
+
+    if (frames == capacity) {
+      frames = ReadToEnd(
+        segments[count - 1].source.get(), frame_size,
+        buffer, capacity, frames);
+    }
+
+    file->seek(file_position, File::BEGIN);
+    return true;
+  }
+
+
+  int DecodeWholeSource(SampleSource* source, u8*& buffer) {
+    ADR_GUARD("DecodeWholeSource");
+
+    int length = source->getLength();
+    int frames;
+    if (DecodeInSegments(source, length, buffer, frames)) {
+      return frames;
+    }
+
+    // The length may only be an estimate, such as an MP3's, so read to
+    // the end rather than trusting it.
+    const int frame_size = GetFrameSize(source);
+    const int capacity = std::max(length + length / 256, int(MIN_BUFFER_FRAMES));
+    buffer = new u8[capacity * frame_size];
+    source->setPosition(0);  // in case the source has been read from already
+    return ReadToEnd(source, frame_size, buffer, capacity, 0);
+  }
+
+
+  ADR_EXPORT(void) AdrSetLoadThreadCount(int count) {
+    g_thread_count = (count > 0 ? count : 0);
+  }
+
+}
@@ -0,0 +1,29 @@
+#ifndef PARALLEL_DECODE_H
+#define PARALLEL_DECODE_H
+
+
+#include "audiere.h"
+#include "types.h"
+
+
+namespace audiere {
+
+  /**
+   * Decodes a whole seekable source from the beginning into a buffer
+   * allocated with new[].  Long sources that OpenSource opened from a WAV,
+   * AIFF, FLAC, Ogg Vorbis, or MP3 file are split into segments that are
+   * decoded on several threads at once, each by a decoder of its own.
+   * Anything else is read on the calling thread.
+   *
+   * @param source  seekable source to decode
+   * @param buffer  receives the samples, which the caller must delete[]
+   *
+   * @return  number of frames decoded.  It may differ from getLength(),
+   *          since that can be an estimate.
+   */
+  int DecodeWholeSource(SampleSource* source, u8*& buffer);
+
+}
+
+
+#endif
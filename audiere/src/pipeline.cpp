@@ -0,0 +1,238 @@
+#include "cpu.h"
+#include "pipeline.h"
+
+#ifdef ADR_SIMD_X86
+  #include <emmintrin.h>
+  #include <smmintrin.h>
+#endif
+#ifdef ADR_SIMD_AVX2
+  #include <immintrin.h>
+#endif
+
+
+namespace audiere {
+
+  static const int UNITY = 255 * 255;
+
+
+  static void MixStereo(
+    const int* l, const int* r, int l_volume, int r_volume,
+    int* out, int count)
+  {
+    AccumulateStage accumulate(out);
+    if (l_volume == UNITY && r_volume == UNITY) {
+      ClipStage<AccumulateStage> clip(accumulate);
+      clip.pushFrames<2>(l, r, count);
+    } else {
+      GainPanStage<AccumulateStage> gain(accumulate, l_volume, r_volume);
+      ClipStage<GainPanStage<AccumulateStage> > clip(gain);
+      clip.pushFrames<2>(l, r, count);
+    }
+  }
+
+
+#ifdef ADR_SIMD_X86
+
+  /*
+   * The SIMD kernels scale the magnitude of each clipped sample and put
+   * the sign back, which truncates toward zero like x * volume / 255 / 255.
+   * The product fits in 31 bits, and for all such products
+   * (p * DIVIDE_MAGIC) >> DIVIDE_SHIFT == p / 65025 exactly.
+   */
+  static const unsigned int DIVIDE_MAGIC = 2164359683u;
+  static const int DIVIDE_SHIFT = 47;
+
+
+  /// Divides unsigned 32-bit lanes under 2^31 by 65025.
+  ADR_TARGET_SSE2 static inline __m128i Divide65025_SSE2(__m128i p) {
+    const __m128i magic = _mm_set1_epi32(int(DIVIDE_MAGIC));
+    const __m128i even = _mm_srli_epi64(
+      _mm_mul_epu32(p, magic), DIVIDE_SHIFT);
+    const __m128i odd = _mm_srli_epi64(
+      _mm_mul_epu32(_mm_srli_epi64(p, 32), magic), DIVIDE_SHIFT);
+    return _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+  }
+
+
+  /// SSE2 has no 32-bit multiply, so the products are built from halves.
+  ADR_TARGET_SSE2 static inline __m128i Scale_SSE2(
+    __m128i x, __m128i volume)
+  {
+    const __m128i sign = _mm_srai_epi32(x, 31);
+    const __m128i magnitude = _mm_sub_epi32(_mm_xor_si128(x, sign), sign);
+    const __m128i even = _mm_mul_epu32(magnitude, volume);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(magnitude, 32), volume);
+    const __m128i q = Divide65025_SSE2(
+      _mm_or_si128(even, _mm_slli_epi64(odd, 32)));
+    return _mm_sub_epi32(_mm_xor_si128(q, sign), sign);
+  }
+
+
+  ADR_TARGET_SSE2 static void MixStereo_SSE2(
+    const int* l, const int* r, int l_volume, int r_volume,
+    int* out, int count)
+  {
+    const bool unity = (l_volume == UNITY && r_volume == UNITY);
+    const __m128i lv = _mm_set1_epi32(l_volume);
+    const __m128i rv = _mm_set1_epi32(r_volume);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+      // clip by packing to 16 bits with saturation
+      const __m128i packed = _mm_packs_epi32(
+        _mm_loadu_si128((const __m128i*)(l + i)),
+        _mm_loadu_si128((const __m128i*)(r + i)));
+      __m128i left  = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+      __m128i right = _mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16);
+      if (!unity) {
+        left  = Scale_SSE2(left,  lv);
+        right = Scale_SSE2(right, rv);
+      }
+
+      __m128i* o = (__m128i*)(out + i * 2);
+      _mm_storeu_si128(o, _mm_add_epi32(
+        _mm_loadu_si128(o), _mm_unpacklo_epi32(left, right)));
+      _mm_storeu_si128(o + 1, _mm_add_epi32(
+        _mm_loadu_si128(o + 1), _mm_unpackhi_epi32(left, right)));
+    }
+    MixStereo(l + i, r + i, l_volume, r_volume, out + i * 2, count - i);
+  }
+
+
+  ADR_TARGET_SSE41 static inline __m128i Scale_SSE41(
+    __m128i x, __m128i volume)
+  {
+    const __m128i p = _mm_mullo_epi32(_mm_abs_epi32(x), volume);
+    return _mm_sign_epi32(Divide65025_SSE2(p), x);
+  }
+
+
+  ADR_TARGET_SSE41 static void MixStereo_SSE41(
+    const int* l, const int* r, int l_volume, int r_volume,
+    int* out, int count)
+  {
+    const bool unity = (l_volume == UNITY && r_volume == UNITY);
+    const __m128i lv = _mm_set1_epi32(l_volume);
+    const __m128i rv = _mm_set1_epi32(r_volume);
+    const __m128i low  = _mm_set1_epi32(-32768);
+    const __m128i high = _mm_set1_epi32(32767);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+      __m128i left = _mm_min_epi32(_mm_max_epi32(
+        _mm_loadu_si128((const __m128i*)(l + i)), low), high);
+      __m128i right = _mm_min_epi32(_mm_max_epi32(
+        _mm_loadu_si128((const __m128i*)(r + i)), low), high);
+      if (!unity) {
+        left  = Scale_SSE41(left,  lv);
+        right = Scale_SSE41(right, rv);
+      }
+
+      __m128i* o = (__m128i*)(out + i * 2);
+      _mm_storeu_si128(o, _mm_add_epi32(
+        _mm_loadu_si128(o), _mm_unpacklo_epi32(left, right)));
+      _mm_storeu_si128(o + 1, _mm_add_epi32(
+        _mm_loadu_si128(o + 1), _mm_unpackhi_epi32(left, right)));
+    }
+    MixStereo(l + i, r + i, l_volume, r_volume, out + i * 2, count - i);
+  }
+
+#endif
+
+
+#ifdef ADR_SIMD_AVX2
+
+  ADR_TARGET_AVX2 static inline __m256i Scale_AVX2(
+    __m256i x, __m256i volume)
+  {
+    const __m256i magic = _mm256_set1_epi32(int(DIVIDE_MAGIC));
+    const __m256i p = _mm256_mullo_epi32(_mm256_abs_epi32(x), volume);
+    const __m256i even = _mm256_srli_epi64(
+      _mm256_mul_epu32(p, magic), DIVIDE_SHIFT);
+    const __m256i odd = _mm256_srli_epi64(
+      _mm256_mul_epu32(_mm256_srli_epi64(p, 32), magic), DIVIDE_SHIFT);
+    const __m256i q = _mm256_or_si256(even, _mm256_slli_epi64(odd, 32));
+    return _mm256_sign_epi32(q, x);
+  }
+
+
+  ADR_TARGET_AVX2 static void MixStereo_AVX2(
+    const int* l, const int* r, int l_volume, int r_volume,
+    int* out, int count)
+  {
+    const bool unity = (l_volume == UNITY && r_volume == UNITY);
+    const __m256i lv = _mm256_set1_epi32(l_volume);
+    const __m256i rv = _mm256_set1_epi32(r_volume);
+    const __m256i low  = _mm256_set1_epi32(-32768);
+    const __m256i high = _mm256_set1_epi32(32767);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+      __m256i left = _mm256_min_epi32(_mm256_max_epi32(
+        _mm256_loadu_si256((const __m256i*)(l + i)), low), high);
+      __m256i right = _mm256_min_epi32(_mm256_max_epi32(
+        _mm256_loadu_si256((const __m256i*)(r + i)), low), high);
+      if (!unity) {
+        left  = Scale_AVX2(left,  lv);
+        right = Scale_AVX2(right, rv);
+      }
+
+      // the unpacks work within 128-bit halves, so put the halves in order
+      const __m256i lo = _mm256_unpacklo_epi32(left, right);
+      const __m256i hi = _mm256_unpackhi_epi32(left, right);
+      __m256i* o = (__m256i*)(out + i * 2);
+      _mm256_storeu_si256(o, _mm256_add_epi32(
+        _mm256_loadu_si256(o), _mm256_permute2x128_si256(lo, hi, 0x20)));
+      _mm256_storeu_si256(o + 1, _mm256_add_epi32(
+        _mm256_loadu_si256(o + 1), _mm256_permute2x128_si256(lo, hi, 0x31)));
+    }
+    MixStereo(l + i, r + i, l_volume, r_volume, out + i * 2, count - i);
+  }
+
+#endif
+
+
+  typedef void (*MixFunction)(
+    const int* l, const int* r, int l_volume, int r_volume,
+    int* out, int count);
+
+  struct MixKernels {
+    MixFunction mix_stereo;
+  };
+
+#ifdef ADR_SIMD_AVX2
+  static const MixKernels AVX2_KERNELS  = { MixStereo_AVX2  };
+#endif
+#ifdef ADR_SIMD_X86
+  static const MixKernels SSE41_KERNELS = { MixStereo_SSE41 };
+  static const MixKernels SSE2_KERNELS  = { MixStereo_SSE2  };
+#endif
+  static const MixKernels SCALAR_KERNELS = { MixStereo };
+
+  static const KernelChoice<MixKernels> MIX_KERNELS[] = {
+#ifdef ADR_SIMD_AVX2
+    { SIMD_AVX2,  &AVX2_KERNELS   },
+#endif
+#ifdef ADR_SIMD_X86
+    { SIMD_SSE41, &SSE41_KERNELS  },
+    { SIMD_SSE2,  &SSE2_KERNELS   },
+#endif
+    { SIMD_NONE,  &SCALAR_KERNELS },
+  };
+
+  static SIMDLevel GetMixLevel() {
+    return ChooseKernels(MIX_KERNELS).level;
+  }
+
+  static KernelRegistration g_registration("mixer", GetMixLevel);
+
+
+  void MixFrames(
+    const int* l, const int* r, int l_volume, int r_volume,
+    int* out, int count)
+  {
+    ChooseKernels(MIX_KERNELS).kernels->mix_stereo(
+      l, r, l_volume, r_volume, out, count);
+  }
+
+}
@@ -0,0 +1,176 @@
+/**
+ * @file
+ *
+ * Stages of the mixing path that are composed at compile time.
+ */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+
+#include "convert.h"
+#include "types.h"
+#include "utility.h"
+
+
+namespace audiere {
+
+  /**
+   * Base of the stages a mixing pipeline is built from.  Each stage takes
+   * the next one as a template parameter and hands it one frame at a time
+   * through put(), so a chain like clip -> gain/pan -> accumulate compiles
+   * into a single loop with no virtual calls or buffers between stages.
+   * The virtual SampleSource interface stays at the ends of a chain.
+   *
+   * Frames are pairs of ints at 16-bit scale.
+   */
+  template<typename Derived>
+  class PipelineStage {
+  public:
+    /**
+     * Pushes count frames of separate channels through the chain.  Mono
+     * sources pass the same channel as l and r.  Stages that do better
+     * with whole blocks hide this.
+     */
+    template<int CHANNEL_COUNT>
+    void pushFrames(const int* l, const int* r, int count) {
+      Derived& self = static_cast<Derived&>(*this);
+      for (int i = 0; i < count; ++i) {
+        const int left = l[i];
+        self.put(left, (CHANNEL_COUNT == 2 ? r[i] : left));
+      }
+    }
+  };
+
+
+  /// Clips frames to 16 bits.
+  template<typename Next>
+  class ClipStage : public PipelineStage<ClipStage<Next> > {
+  public:
+    ClipStage(Next& next)
+    : m_next(next) {
+    }
+
+    void put(int l, int r) {
+      m_next.put(clamp(-32768, l, 32767), clamp(-32768, r, 32767));
+    }
+
+  private:
+    Next& m_next;
+  };
+
+
+  /// Scales each channel by a volume in [0, 255 * 255].
+  template<typename Next>
+  class GainPanStage : public PipelineStage<GainPanStage<Next> > {
+  public:
+    GainPanStage(Next& next, int l_volume, int r_volume)
+    : m_next(next) {
+      m_l_volume = l_volume;
+      m_r_volume = r_volume;
+    }
+
+    void put(int l, int r) {
+      m_next.put(l * m_l_volume / 255 / 255, r * m_r_volume / 255 / 255);
+    }
+
+  private:
+    Next& m_next;
+    int m_l_volume;
+    int m_r_volume;
+  };
+
+
+  /// Adds frames into an interleaved mix buffer and remembers the last one.
+  class AccumulateStage : public PipelineStage<AccumulateStage> {
+  public:
+    AccumulateStage(int* out) {
+      m_out    = out;
+      m_last_l = 0;
+      m_last_r = 0;
+    }
+
+    void put(int l, int r) {
+      m_out[0] += l;
+      m_out[1] += r;
+      m_out += 2;
+      m_last_l = l;
+      m_last_r = r;
+    }
+
+    int getLastLeft()  { return m_last_l; }
+    int getLastRight() { return m_last_r; }
+
+  private:
+    int* m_out;
+    int m_last_l;
+    int m_last_r;
+  };
+
+
+  /**
+   * Clips separate channels to 16 bits, scales each by a volume in
+   * [0, 255 * 255], and adds them to an interleaved stereo mix buffer.  The
+   * result is the same as a ClipStage -> GainPanStage -> AccumulateStage
+   * chain, but uses the best SIMD kernel the processor supports.
+   */
+  void MixFrames(
+    const int* l, const int* r, int l_volume, int r_volume,
+    int* out, int count);
+
+
+  /// Mixes blocks of frames with MixFrames.  Ends a chain.
+  class MixStage : public PipelineStage<MixStage> {
+  public:
+    MixStage(int* out, int l_volume, int r_volume) {
+      m_out      = out;
+      m_l_volume = l_volume;
+      m_r_volume = r_volume;
+      m_last_l   = 0;
+      m_last_r   = 0;
+    }
+
+    template<int CHANNEL_COUNT>
+    void pushFrames(const int* l, const int* r, int count) {
+      if (count > 0) {
+        MixFrames(l, r, m_l_volume, m_r_volume, m_out, count);
+        m_out += count * 2;
+        m_last_l = clamp(-32768, l[count - 1], 32767) * m_l_volume / 255 / 255;
+        m_last_r = clamp(-32768, r[count - 1], 32767) * m_r_volume / 255 / 255;
+      }
+    }
+
+    int getLastLeft()  { return m_last_l; }
+    int getLastRight() { return m_last_r; }
+
+  private:
+    int* m_out;
+    int m_l_volume;
+    int m_r_volume;
+    int m_last_l;
+    int m_last_r;
+  };
+
+
+  /// Writes clipped, interleaved 16-bit frames.  Ends a chain.
+  class InterleaveStage : public PipelineStage<InterleaveStage> {
+  public:
+    InterleaveStage(s16* out) {
+      m_out = out;
+    }
+
+    template<int CHANNEL_COUNT>
+    void pushFrames(const int* l, const int* r, int count) {
+      const int* const channels[] = { l, r };
+      InterleaveIntegers(channels, 2, 16, m_out, SF_S16, count);
+      m_out += count * 2;
+    }
+
+  private:
+    s16* m_out;
+  };
+
+}
+
+
+#endif
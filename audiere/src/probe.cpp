@@ -0,0 +1,749 @@
+/**
+ * @file
+ *
+ * Reads format information and tags from sound files without opening
+ * decoders.  Each format is parsed straight from its headers, so probing
+ * is cheap, needs none of the codec libraries' state, and is safe to do
+ * from several threads at once.
+ */
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4786)
+#endif
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include "adpcm.h"
+#include "basic_source.h"
+#include "debug.h"
+#include "default_file.h"
+#include "input_aiff.h"
+#include "input_wav.h"
+#include "input.h"
+#include "internal.h"
+#include "mp3_info.h"
+#include "seek_cache.h"
+#include "utility.h"
+
+
+namespace audiere {
+
+  class FileInfoImpl : public RefImplementation<FileInfo> {
+  public:
+    FileInfoImpl(FileFormat file_format) {
+      m_file_format   = file_format;
+      m_channel_count = 0;
+      m_sample_rate   = 0;
+      m_sample_format = SF_S16;
+      m_length        = 0;
+      m_length_exact  = false;
+    }
+
+    FileFormat ADR_CALL getFileFormat() {
+      return m_file_format;
+    }
+
+    void ADR_CALL getFormat(
+      int& channel_count,
+      int& sample_rate,
+      SampleFormat& sample_format)
+    {
+      channel_count = m_channel_count;
+      sample_rate   = m_sample_rate;
+      sample_format = m_sample_format;
+    }
+
+    int  ADR_CALL getLength()     { return m_length;       }
+    bool ADR_CALL isLengthExact() { return m_length_exact; }
+
+    int ADR_CALL getTagCount()              { return int(m_tags.size()); }
+    const char* ADR_CALL getTagKey(int i)   { return m_tags[i].key.c_str(); }
+    const char* ADR_CALL getTagValue(int i) { return m_tags[i].value.c_str(); }
+    const char* ADR_CALL getTagType(int i)  { return m_tags[i].type.c_str(); }
+
+    void setFormat(
+      int channel_count,
+      int sample_rate,
+      SampleFormat sample_format)
+    {
+      m_channel_count = channel_count;
+      m_sample_rate   = sample_rate;
+      m_sample_format = sample_format;
+    }
+
+    void setLength(int length, bool exact) {
+      m_length       = length;
+      m_length_exact = exact;
+    }
+
+    void addTag(const Tag& t) {
+      m_tags.push_back(t);
+    }
+
+    void addTag(const std::string& k, const std::string& v, const std::string& t) {
+      addTag(Tag(k, v, t));
+    }
+
+  private:
+    FileFormat m_file_format;
+    int m_channel_count;
+    int m_sample_rate;
+    SampleFormat m_sample_format;
+    int m_length;
+    bool m_length_exact;
+    std::vector<Tag> m_tags;
+  };
+
+
+  /// Largest header packet or metadata block we are willing to read.
+  static const int MAX_METADATA_SIZE = 1 << 22;
+
+
+  static bool ReadAt(File* file, int position, void* buffer, int size) {
+    return (file->seek(position, File::BEGIN) &&
+            file->read(buffer, size) == size);
+  }
+
+
+  /**
+   * Returns the position of the RIFF or IFF chunk after the one at
+   * 'position'.  Chunk data is padded to an even length.  The result is
+   * clamped to the end of the file, so no length can wrap it around.
+   */
+  static int GetNextChunk(int position, u32 chunk_length, int file_length) {
+    const s64 next = s64(position) + 8 + chunk_length + (chunk_length & 1);
+    return int(std::min(next, s64(file_length)));
+  }
+
+
+  /// Returns the offset of the first byte after any ID3v2 tags.
+  static int SkipID3v2Tags(File* file) {
+    int position = 0;
+    u8 header[10];
+    while (ReadAt(file, position, header, 10) &&
+           memcmp(header, "ID3", 3) == 0)
+    {
+      position += 10 + (
+        ((header[6] & 0x7f) << 21) |
+        ((header[7] & 0x7f) << 14) |
+        ((header[8] & 0x7f) << 7) |
+        (header[9] & 0x7f));
+    }
+    return position;
+  }
+
+
+#ifndef NO_FLAC
+
+  static SampleFormat GetPCMFormat(int bits_per_sample, bool& valid) {
+    valid = (bits_per_sample == 8 || bits_per_sample == 16);
+    return (bits_per_sample == 8 ? SF_U8 : SF_S16);
+  }
+
+#endif
+
+
+#if !defined(NO_FLAC) || !defined(NO_OGG) || !defined(NO_SPEEX)
+
+  /**
+   * Parses a Vorbis comment block: a vendor string followed by a list of
+   * key=value strings, all prefixed with little-endian lengths.  Ogg
+   * Vorbis, Speex, and FLAC all use this.
+   */
+  static void ParseVorbisComments(
+    const u8* data,
+    int size,
+    const char* type,
+    bool add_vendor,
+    FileInfoImpl& info)
+  {
+    if (size < 4) {
+      return;
+    }
+    u32 vendor_length = read32_le(data);
+    if (vendor_length > u32(size - 4)) {
+      return;
+    }
+    if (add_vendor) {
+      info.addTag("vendor", std::string((const char*)data + 4, vendor_length), type);
+    }
+
+    int position = 4 + vendor_length;
+    if (position + 4 > size) {
+      return;
+    }
+    u32 count = read32_le(data + position);
+    position += 4;
+
+    for (u32 i = 0; i < count && position + 4 <= size; ++i) {
+      u32 length = read32_le(data + position);
+      position += 4;
+      if (length > u32(size - position)) {
+        return;
+      }
+
+      std::string kv((const char*)data + position, length);
+      std::string::size_type eq = kv.find('=');
+      if (eq == std::string::npos) {
+        info.addTag(kv, "", type);
+      } else {
+        info.addTag(kv.substr(0, eq), kv.substr(eq + 1), type);
+      }
+      position += length;
+    }
+  }
+
+#endif
+
+
+  static bool ProbeWAV(File* file, FileInfoImpl& info) {
+    u8 header[12];
+    if (!ReadAt(file, 0, header, 12) ||
+        memcmp(header, "RIFF", 4) != 0 ||
+        memcmp(header + 8, "WAVE", 4) != 0)
+    {
+      return false;
+    }
+
+    int format_tag = 0;
+    int block_align = 0;
+    int channel_count = 0;
+    int frame_size = 0;
+    int data_length = -1;
+    int fact_length = -1;
+    const int file_length = GetFileLength(file);
+    int position = 12;
+    while (frame_size == 0 || data_length < 0) {
+      u8 chunk_header[8];
+      if (!ReadAt(file, position, chunk_header, 8)) {
+        return false;
+      }
+      u32 chunk_length = read32_le(chunk_header + 4);
+      const u32 available = u32(file_length - position - 8);
+
+      if (memcmp(chunk_header, "fmt ", 4) == 0 && chunk_length >= 16) {
+        // enough for WAVE_FORMAT_EXTENSIBLE
+        u8 chunk[40];
+        const int size = std::min(chunk_length, u32(40));
+        if (file->read(chunk, size) != size) {
+          return false;
+        }
+        format_tag      = read16_le(chunk + 0);
+        channel_count   = read16_le(chunk + 2);
+        u32 sample_rate = read32_le(chunk + 4);
+        block_align     = read16_le(chunk + 12);
+        if (channel_count < 1 || channel_count > 2) {
+          return false;
+        }
+
+        if (format_tag == WAV_FORMAT_IMA_ADPCM ||
+            format_tag == WAV_FORMAT_MS_ADPCM)
+        {
+          // ADPCM decodes to 16-bit samples
+          if (GetADPCMBlockFrames(format_tag, block_align, channel_count) < 2) {
+            return false;
+          }
+          info.setFormat(channel_count, sample_rate, SF_S16);
+          frame_size = channel_count * GetSampleSize(SF_S16);
+        } else {
+          RawSampleFormat raw_format;
+          if (!GetWAVRawFormat(chunk, size, raw_format)) {
+            return false;
+          }
+          info.setFormat(channel_count, sample_rate,
+                         GetDecodedSampleFormat(raw_format));
+          frame_size = channel_count * GetRawSampleSize(raw_format);
+        }
+      } else if (memcmp(chunk_header, "fact", 4) == 0 && chunk_length >= 4) {
+        u8 fact[4];
+        if (file->read(fact, 4) != 4) {
+          return false;
+        }
+        fact_length = read32_le(fact);
+      } else if (memcmp(chunk_header, "data", 4) == 0) {
+        // streamed and truncated files claim more data than they hold
+        data_length = int(std::min(chunk_length, available));
+      } else if (chunk_length > available) {
+        return false;
+      }
+
+      position = GetNextChunk(position, chunk_length, file_length);
+    }
+
+    if (format_tag == WAV_FORMAT_IMA_ADPCM ||
+        format_tag == WAV_FORMAT_MS_ADPCM)
+    {
+      int length = GetADPCMFrameCount(
+        format_tag, data_length, block_align, channel_count);
+      if (fact_length >= 0 && fact_length < length) {
+        length = fact_length;
+      }
+      info.setLength(length, true);
+      return true;
+    }
+
+    info.setLength(data_length / frame_size, true);
+    return true;
+  }
+
+
+  static bool ProbeAIFF(File* file, FileInfoImpl& info) {
+    u8 header[12];
+    if (!ReadAt(file, 0, header, 12) ||
+        memcmp(header, "FORM", 4) != 0 ||
+        (memcmp(header + 8, "AIFF", 4) != 0 &&
+         memcmp(header + 8, "AIFC", 4) != 0))
+    {
+      return false;
+    }
+    const bool aifc = (memcmp(header + 8, "AIFC", 4) == 0);
+
+    const int file_length = GetFileLength(file);
+    int position = 12;
+    for (;;) {
+      u8 chunk_header[8];
+      if (!ReadAt(file, position, chunk_header, 8)) {
+        return false;
+      }
+      u32 chunk_length = read32_be(chunk_header + 4);
+
+      if (memcmp(chunk_header, "COMM", 4) == 0 && chunk_length >= 18) {
+        u8 chunk[22];
+        const int size = std::min(chunk_length, u32(22));
+        if (file->read(chunk, size) != size) {
+          return false;
+        }
+        u16 channel_count = read16_be(chunk + 0);
+        u32 frame_count   = read32_be(chunk + 2);
+        u32 sample_rate   = readLD_be(chunk + 8);
+
+        RawSampleFormat raw_format;
+        bool big_endian;
+        if (channel_count < 1 || channel_count > 2 ||
+            !GetAIFFRawFormat(chunk, size, aifc, raw_format, big_endian))
+        {
+          return false;
+        }
+        info.setFormat(channel_count, sample_rate,
+                       GetDecodedSampleFormat(raw_format));
+        info.setLength(frame_count, true);
+        return true;
+      }
+
+      position = GetNextChunk(position, chunk_length, file_length);
+    }
+  }
+
+
+#ifndef NO_FLAC
+
+  static bool ProbeFLAC(File* file, FileInfoImpl& info) {
+    int position = SkipID3v2Tags(file);
+
+    u8 signature[4];
+    if (!ReadAt(file, position, signature, 4) ||
+        memcmp(signature, "fLaC", 4) != 0)
+    {
+      return false;
+    }
+    position += 4;
+
+    bool found_stream_info = false;
+    bool last = false;
+    while (!last) {
+      u8 block_header[4];
+      if (!ReadAt(file, position, block_header, 4)) {
+        break;
+      }
+      last = (block_header[0] & 0x80) != 0;
+      int type   = block_header[0] & 0x7f;
+      int length = (block_header[1] << 16) | (block_header[2] << 8) | block_header[3];
+
+      if (type == 0 && length >= 34) {  // STREAMINFO
+        u8 b[34];
+        if (file->read(b, 34) != 34) {
+          return false;
+        }
+        int sample_rate     = (b[10] << 12) | (b[11] << 4) | (b[12] >> 4);
+        int channel_count   = ((b[12] >> 1) & 7) + 1;
+        int bits_per_sample = (((b[12] & 1) << 4) | (b[13] >> 4)) + 1;
+        u64 total_samples   = (u64(b[13] & 0x0F) << 32) | read32_be(b + 14);
+
+        bool valid;
+        SampleFormat format = GetPCMFormat(bits_per_sample, valid);
+        if (!valid) {
+          return false;
+        }
+        info.setFormat(channel_count, sample_rate, format);
+        info.setLength(int(total_samples), total_samples != 0);
+        found_stream_info = true;
+
+      } else if (type == 4 && length <= MAX_METADATA_SIZE) {  // VORBIS_COMMENT
+        std::vector<u8> block(length + 1);
+        if (file->read(&block[0], length) == length) {
+          ParseVorbisComments(&block[0], length, "vorbis", true, info);
+        }
+      }
+
+      position += 4 + length;
+    }
+
+    return found_stream_info;
+  }
+
+#endif
+
+
+#if !defined(NO_OGG) || !defined(NO_SPEEX)
+
+  /**
+   * Reads the first 'count' packets of the first logical bitstream in an
+   * Ogg file.
+   */
+  static bool ReadOggPackets(
+    File* file,
+    int count,
+    std::vector<std::string>& packets,
+    u32& serial)
+  {
+    std::string packet;
+    int position = 0;
+    int total_size = 0;
+    bool first_page = true;
+
+    while (int(packets.size()) < count) {
+      u8 header[27 + 255];
+      if (!ReadAt(file, position, header, 27) ||
+          memcmp(header, "OggS", 4) != 0 ||
+          file->read(header + 27, header[26]) != header[26])
+      {
+        return false;
+      }
+
+      int segment_count = header[26];
+      int body_size = 0;
+      for (int i = 0; i < segment_count; ++i) {
+        body_size += header[27 + i];
+      }
+
+      u32 page_serial = read32_le(header + 14);
+      if (first_page) {
+        serial = page_serial;
+        first_page = false;
+      }
+
+      if (page_serial == serial) {
+        total_size += body_size;
+        if (total_size > MAX_METADATA_SIZE) {
+          return false;
+        }
+
+        std::vector<u8> body(body_size + 1);
+        if (file->read(&body[0], body_size) != body_size) {
+          return false;
+        }
+
+        int offset = 0;
+        for (int i = 0; i < segment_count && int(packets.size()) < count; ++i) {
+          int lacing = header[27 + i];
+          packet.append((const char*)&body[offset], lacing);
+          offset += lacing;
+          if (lacing < 255) {
+            packets.push_back(packet);
+            packet.erase();
+          }
+        }
+      }
+
+      position += 27 + segment_count + body_size;
+    }
+    return true;
+  }
+
+
+  /**
+   * Finds the granule position of the last page of a logical bitstream,
+   * which is the length of the stream in samples.
+   */
+  static bool GetLastOggGranule(File* file, u32 serial, s64& granule) {
+    if (!file->seek(0, File::END)) {
+      return false;
+    }
+    const int file_length = file->tell();
+
+    const int CHUNK_SIZE = 65536;
+    std::vector<u8> buffer(CHUNK_SIZE);
+
+    // walk backwards through the file in overlapping chunks
+    int end = file_length;
+    while (end > 0) {
+      int begin = std::max(0, end - CHUNK_SIZE);
+      int size = end - begin;
+      if (!ReadAt(file, begin, &buffer[0], size)) {
+        return false;
+      }
+
+      for (int i = size - 27; i >= 0; --i) {
+        const u8* page = &buffer[i];
+        if (memcmp(page, "OggS", 4) == 0 && read32_le(page + 14) == serial) {
+          s64 g = s64(read32_le(page + 6)) | (s64(read32_le(page + 10)) << 32);
+          if (g != -1) {
+            granule = g;
+            return true;
+          }
+        }
+      }
+
+      if (begin == 0) {
+        break;
+      }
+      end = begin + 27;  // a page header may straddle the chunks
+    }
+    return false;
+  }
+
+#endif
+
+
+#ifndef NO_OGG
+
+  static bool ProbeOGG(File* file, FileInfoImpl& info) {
+    std::vector<std::string> packets;
+    u32 serial;
+    if (!ReadOggPackets(file, 2, packets, serial)) {
+      return false;
+    }
+
+    const std::string& id = packets[0];
+    if (id.size() < 16 || id.compare(0, 7, "\x01vorbis") != 0) {
+      return false;
+    }
+    const u8* p = (const u8*)id.data();
+    info.setFormat(p[11], read32_le(p + 12), SF_S16);
+
+    const std::string& comments = packets[1];
+    if (comments.size() > 7 && comments.compare(0, 7, "\x03vorbis") == 0) {
+      ParseVorbisComments(
+        (const u8*)comments.data() + 7, int(comments.size()) - 7,
+        "vorbis", true, info);
+    }
+
+    s64 granule;
+    if (GetLastOggGranule(file, serial, granule)) {
+      info.setLength(int(granule), true);
+    }
+    return true;
+  }
+
+#endif
+
+
+#ifndef NO_SPEEX
+
+  static bool ProbeSpeex(File* file, FileInfoImpl& info) {
+    std::vector<std::string> packets;
+    u32 serial;
+    if (!ReadOggPackets(file, 2, packets, serial)) {
+      return false;
+    }
+
+    const std::string& header = packets[0];
+    if (header.size() < 52 || header.compare(0, 8, "Speex   ") != 0) {
+      return false;
+    }
+    const u8* p = (const u8*)header.data();
+    info.setFormat(read32_le(p + 48), read32_le(p + 36), SF_S16);
+
+    ParseVorbisComments(
+      (const u8*)packets[1].data(), int(packets[1].size()),
+      "Speex", false, info);
+
+    SeekIndex index;
+    s64 granule;
+    if (LoadSeekIndex(file, "spx", index)) {
+      info.setLength(int(index.length), true);
+    } else if (GetLastOggGranule(file, serial, granule)) {
+      info.setLength(int(granule), true);
+    }
+    return true;
+  }
+
+#endif
+
+
+#ifndef NO_MP3
+
+  static bool ProbeMP3(File* file, FileInfoImpl& info) {
+    // ID3v1 tags end the file, so we need to know where it ends
+    int file_length = 0;
+    if (file->seek(0, File::END)) {
+      file_length = file->tell();
+      std::vector<Tag> tags;
+      if (ReadID3v1Tags(file, tags)) {
+        file_length -= 128;
+        for (size_t i = 0; i < tags.size(); ++i) {
+          info.addTag(tags[i]);
+        }
+      }
+    }
+
+    // Find the first frame.  Streams can start with junk, so insist that
+    // the next frame header follows it.
+    const int SEARCH_SIZE = 65536;
+    int start = SkipID3v2Tags(file);
+    std::vector<u8> buffer(SEARCH_SIZE);
+    if (!file->seek(start, File::BEGIN)) {
+      return false;
+    }
+    int size = file->read(&buffer[0], SEARCH_SIZE);
+
+    MPEGFrameHeader header;
+    int frame = -1;
+    for (int i = 0; i + 4 <= size && frame < 0; ++i) {
+      if (!ParseMPEGFrameHeader(&buffer[i], header) ||
+          header.frame_bytes == 0)
+      {
+        continue;
+      }
+      int next = i + header.frame_bytes;
+      MPEGFrameHeader next_header;
+      if (next + 4 > size ||
+          (ParseMPEGFrameHeader(&buffer[next], next_header) &&
+           next_header.layer == header.layer &&
+           next_header.sample_rate == header.sample_rate))
+      {
+        frame = i;
+      }
+    }
+    if (frame < 0) {
+      return false;
+    }
+
+    info.setFormat(header.channel_count, header.sample_rate,
+                   GetPreferredSampleFormat());
+
+    // same estimates as MP3InputStream, unless the seek cache knows better
+    SeekIndex index;
+    int frame_count = GetVBRFrameCount(&buffer[frame], size - frame);
+    if (LoadSeekIndex(file, "mp3", index, IsMPEGFrameAt)) {
+      info.setLength(int(index.length), true);
+    } else if (frame_count >= 0) {
+      info.setLength(frame_count * header.samples_per_frame, false);
+    } else if (file_length > 0) {
+      double audio_bytes = file_length - (start + frame);
+      info.setLength(
+        int(audio_bytes * 8 * header.sample_rate / header.bit_rate),
+        false);
+    }
+    return true;
+  }
+
+#endif
+
+
+#ifndef NO_DUMB
+
+  static bool ProbeMOD(File* file, FileInfoImpl& info) {
+    // Module lengths are only known by playing them.
+    info.setFormat(2, 44100, SF_S16);
+    return (SniffFormat(file) == FF_MOD);
+  }
+
+#endif
+
+
+  static FileInfo* ProbeFormat(File* file, FileFormat format) {
+    ADR_GUARD("ProbeFormat");
+
+    FileInfoImpl* info = new FileInfoImpl(format);
+    bool result = false;
+    switch (format) {
+      case FF_WAV:   result = ProbeWAV(file, *info);   break;
+      case FF_AIFF:  result = ProbeAIFF(file, *info);  break;
+#ifndef NO_FLAC
+      case FF_FLAC:  result = ProbeFLAC(file, *info);  break;
+#endif
+#ifndef NO_OGG
+      case FF_OGG:   result = ProbeOGG(file, *info);   break;
+#endif
+#ifndef NO_SPEEX
+      case FF_SPEEX: result = ProbeSpeex(file, *info); break;
+#endif
+#ifndef NO_MP3
+      case FF_MP3:   result = ProbeMP3(file, *info);   break;
+#endif
+#ifndef NO_DUMB
+      case FF_MOD:   result = ProbeMOD(file, *info);   break;
+#endif
+      default:       break;
+    }
+
+    if (result) {
+      return info;
+    } else {
+      delete info;
+      return 0;
+    }
+  }
+
+
+  static FileInfo* Probe(
+    const FilePtr& file,
+    const char* filename,
+    FileFormat file_format)
+  {
+    if (file_format != FF_AUTODETECT) {
+      return ProbeFormat(file.get(), file_format);
+    }
+
+    FileFormat guessed = (filename ? GuessFormat(filename) : FF_AUTODETECT);
+    if (guessed != FF_AUTODETECT) {
+      FileInfo* info = ProbeFormat(file.get(), guessed);
+      if (info) {
+        return info;
+      }
+    }
+
+    FileFormat sniffed = SniffFormat(file);
+    if (sniffed != FF_AUTODETECT && sniffed != guessed) {
+      FileInfo* info = ProbeFormat(file.get(), sniffed);
+      if (info) {
+        return info;
+      }
+    }
+
+    // MP3 streams may start with junk
+    if (sniffed != FF_MP3 && guessed != FF_MP3) {
+      return ProbeFormat(file.get(), FF_MP3);
+    }
+    return 0;
+  }
+
+
+  ADR_EXPORT(FileInfo*) AdrProbeFile(
+    const char* filename,
+    FileFormat file_format)
+  {
+    if (!filename) {
+      return 0;
+    }
+    FilePtr file = OpenFile(filename, false);
+    if (!file) {
+      return 0;
+    }
+    return Probe(file, filename, file_format);
+  }
+
+
+  ADR_EXPORT(FileInfo*) AdrProbeFileFromFile(
+    File* file,
+    FileFormat file_format)
+  {
+    if (!file) {
+      return 0;
+    }
+    return Probe(file, 0, file_format);
+  }
+
+}
@@ -2,9 +2,11 @@
 #define RESAMPLER_H
 
 
+#include <string.h>
 #include "audiere.h"
 #include "debug.h"
 #include "dumb_resample.h"
+#include "pipeline.h"
 #include "types.h"
 #include "utility.h"
 
@@ -24,6 +26,17 @@ namespace audiere {
     int ADR_CALL read(int frame_count, void* buffer);
     void ADR_CALL reset();
 
+    /**
+     * Resamples up to frame_count frames into a PipelineStage as separate
+     * channels of unclipped ints at 16-bit scale.  read() is pull() into
+     * an InterleaveStage.
+     *
+     * @return  number of frames pushed, less than frame_count at the end
+     *          of the source
+     */
+    template<typename Stage>
+    int pull(int frame_count, Stage& stage);
+
     bool ADR_CALL isSeekable();
     int  ADR_CALL getLength();
     void ADR_CALL setPosition(int position);
@@ -62,6 +75,48 @@ namespace audiere {
     float m_shift;
   };
 
+
+  template<typename Stage>
+  int Resampler::pull(const int frame_count, Stage& stage) {
+    int left = frame_count;
+    sample_t tmp_l[BUFFER_SIZE];
+    sample_t tmp_r[BUFFER_SIZE];
+    float delta = m_shift * m_native_sample_rate / m_rate;
+    if (m_shift == 0) {  // If shift is zero, which shouldn't be the case, use a shift of 1.
+      delta = float(m_native_sample_rate / m_rate);
+    }
+    while (left > 0) {
+      int transfer = std::min(left, int(BUFFER_SIZE));
+      memset(tmp_l, 0, transfer * sizeof(sample_t));
+      int rv = dumb_resample(&m_resampler_l, tmp_l, transfer, 1.0, delta);
+      if (rv == 0) {
+        fillBuffers();
+        if (m_buffer_length == 0) {
+          return frame_count - left;
+        } else {
+          m_resampler_l.pos = m_resampler_l.subpos = m_resampler_l.start = 0;
+          m_resampler_l.end = m_buffer_length;
+          m_resampler_l.dir = 1;
+          m_resampler_r.pos = m_resampler_r.subpos = m_resampler_r.start = 0;
+          m_resampler_r.end = m_buffer_length;
+          m_resampler_r.dir = 1;
+          continue;
+        }
+      }
+      if (m_native_channel_count == 2) {
+        memset(tmp_r, 0, transfer * sizeof(sample_t));
+        int rv2 = dumb_resample(&m_resampler_r, tmp_r, transfer, 1.0,
+                                delta);
+        ADR_ASSERT(rv == rv2, "resamplers returned different sample counts");
+        stage.template pushFrames<2>(tmp_l, tmp_r, rv);
+      } else {
+        stage.template pushFrames<1>(tmp_l, tmp_l, rv);
+      }
+      left -= rv;
+    }
+    return frame_count;
+  }
+
 }
 
 #endif
@@ -1,6 +1,14 @@
+#ifdef _MSC_VER
+#pragma warning(disable : 4786)
+#endif
+
+
+#include <limits.h>
 #include "audiere.h"
 #include "basic_source.h"
 #include "internal.h"
+#include "parallel_decode.h"
+#include "threads.h"
 #include "types.h"
 #include "utility.h"
 
@@ -73,17 +81,24 @@ namespace audiere {
     {
       const int frame_size = channel_count * GetSampleSize(sample_format);
       const int buffer_size = frame_count * frame_size;
-      m_samples = new u8[buffer_size];
+      u8* copy = new u8[buffer_size];
       if (samples) {
-        memcpy(m_samples, samples, buffer_size);
+        memcpy(copy, samples, buffer_size);
       } else {
-        memset(m_samples, 0, buffer_size);
+        memset(copy, 0, buffer_size);
       }
+      init(copy, frame_count, channel_count, sample_rate, sample_format);
+    }
 
-      m_frame_count   = frame_count;
-      m_channel_count = channel_count;
-      m_sample_rate   = sample_rate;
-      m_sample_format = sample_format;
+    /// Takes ownership of samples, which must come from new u8[].
+    static SampleBufferImpl* Adopt(
+      u8* samples, int frame_count,
+      int channel_count, int sample_rate, SampleFormat sample_format)
+    {
+      SampleBufferImpl* buffer = new SampleBufferImpl();
+      buffer->init(
+        samples, frame_count, channel_count, sample_rate, sample_format);
+      return buffer;
     }
 
     ~SampleBufferImpl() {
@@ -112,7 +127,25 @@ namespace audiere {
       return new BufferStream(this);
     }
 
+    int ADR_CALL getMemoryUsage() {
+      return m_frame_count * m_channel_count * GetSampleSize(m_sample_format);
+    }
+
   private:
+    SampleBufferImpl() {
+    }
+
+    void init(
+      u8* samples, int frame_count,
+      int channel_count, int sample_rate, SampleFormat sample_format)
+    {
+      m_samples       = samples;
+      m_frame_count   = frame_count;
+      m_channel_count = channel_count;
+      m_sample_rate   = sample_rate;
+      m_sample_format = sample_format;
+    }
+
     u8* m_samples;
     int m_frame_count;
     int m_channel_count;
@@ -121,6 +154,256 @@ namespace audiere {
   };
 
 
+  class LazySampleBuffer;
+
+
+  /// Reads the samples a LazySampleBuffer has decoded, decoding more first.
+  class LazyBufferStream : public BasicSource {
+  public:
+    LazyBufferStream(LazySampleBuffer* buffer);
+
+    void ADR_CALL getFormat(
+      int& channel_count,
+      int& sample_rate,
+      SampleFormat& sample_format);
+
+    int doRead(int frame_count, void* buffer);
+
+    void ADR_CALL reset() {
+      m_position = 0;
+    }
+
+    bool ADR_CALL isSeekable()              { return true;       }
+    int ADR_CALL getLength();
+    void ADR_CALL setPosition(int position) { m_position = position; }
+    int ADR_CALL getPosition()              { return m_position; }
+
+  private:
+    RefPtr<LazySampleBuffer> m_buffer;
+    int m_frame_size;
+
+    int m_position;  // in frames
+  };
+
+
+  /**
+   * SampleBuffer that decodes its source a piece at a time, a little ahead
+   * of the furthest stream reading from it, instead of all up front.  Every
+   * stream shares the samples decoded so far, which never move, so they
+   * are read without holding the lock.  The source is released once it
+   * has been decoded completely.
+   *
+   * The samples are kept in chunks.  The first holds the source's length,
+   * which may only be an estimate, and each one after it is as big as all
+   * the ones before, so a source that runs long costs a few allocations
+   * and no copying.
+   */
+  class LazySampleBuffer : public RefImplementation<SampleBuffer> {
+  public:
+    LazySampleBuffer(SampleSource* source) {
+      m_source = source;
+      m_source->getFormat(m_channel_count, m_sample_rate, m_sample_format);
+      m_source->setPosition(0);
+
+      m_frame_size  = m_channel_count * GetSampleSize(m_sample_format);
+      m_frame_count = m_source->getLength();
+      m_decoded     = 0;
+
+      for (int i = 0; i < MAX_CHUNKS; ++i) {
+        m_chunks[i] = 0;
+      }
+      m_first_chunk_frames = std::max(
+        m_frame_count + m_frame_count / 256, int(MIN_CHUNK_FRAMES));
+      m_chunks[0] = new u8[m_first_chunk_frames * m_frame_size];
+      m_capacity  = m_first_chunk_frames;
+      m_flat      = 0;
+    }
+
+    ~LazySampleBuffer() {
+      for (int i = 0; i < MAX_CHUNKS; ++i) {
+        delete[] m_chunks[i];
+      }
+      delete[] m_flat;
+    }
+
+    void ADR_CALL getFormat(
+      int& channel_count,
+      int& sample_rate,
+      SampleFormat& sample_format)
+    {
+      channel_count = m_channel_count;
+      sample_rate   = m_sample_rate;
+      sample_format = m_sample_format;
+    }
+
+    int ADR_CALL getLength() {
+      // changes if the source doesn't end at its estimated length
+      SYNCHRONIZED(m_mutex);
+      return m_frame_count;
+    }
+
+    const void* ADR_CALL getSamples() {
+      const int decoded = decode(INT_MAX);
+
+      // the samples only have to be gathered if the estimate was short
+      SYNCHRONIZED(m_mutex);
+      if (decoded <= m_first_chunk_frames) {
+        return m_chunks[0];
+      }
+      if (!m_flat) {
+        m_flat = new u8[decoded * m_frame_size];
+        copyFrames(0, decoded, m_flat);
+      }
+      return m_flat;
+    }
+
+    SampleSource* ADR_CALL openStream() {
+      return new LazyBufferStream(this);
+    }
+
+    int ADR_CALL getMemoryUsage() {
+      SYNCHRONIZED(m_mutex);
+      return m_capacity * m_frame_size;
+    }
+
+    /**
+     * Makes sure the first end frames are decoded.  Any decoding goes a
+     * fixed distance further, so a playing stream only decodes now and
+     * then.
+     *
+     * @return  number of frames decoded so far
+     */
+    int decode(int end) {
+      SYNCHRONIZED(m_mutex);
+      if (end > m_decoded && m_source) {
+        const int ahead = m_sample_rate * DECODE_AHEAD_MS / 1000;
+        const int target = int(std::min(s64(end) + ahead, s64(INT_MAX)));
+        while (m_decoded < target) {
+          int start, size;
+          const int chunk = findChunk(m_decoded, start, size);
+          if (!m_chunks[chunk]) {
+            m_chunks[chunk] = new u8[size * m_frame_size];
+            m_capacity += size;
+          }
+
+          const int wanted = std::min(target, start + size) - m_decoded;
+          const int read = m_source->read(
+            wanted,
+            m_chunks[chunk] + (m_decoded - start) * m_frame_size);
+          m_decoded += read;
+          if (read < wanted) {
+            // the source ended, maybe before its estimated length
+            m_frame_count = m_decoded;
+            m_source = 0;
+            break;
+          }
+        }
+        m_frame_count = std::max(m_frame_count, m_decoded);
+      }
+      return m_decoded;
+    }
+
+    /**
+     * Copies count frames starting at begin, which must all be below the
+     * count decode() last returned.  Needs no lock, since those frames and
+     * the chunks holding them never change again.
+     */
+    void copyFrames(int begin, int count, u8* out) {
+      while (count > 0) {
+        int start, size;
+        const int chunk = findChunk(begin, start, size);
+        const int frames = std::min(count, start + size - begin);
+        memcpy(
+          out,
+          m_chunks[chunk] + (begin - start) * m_frame_size,
+          frames * m_frame_size);
+        out   += frames * m_frame_size;
+        begin += frames;
+        count -= frames;
+      }
+    }
+
+  private:
+    /// Finds the chunk holding a frame, and the frames that chunk covers.
+    int findChunk(int frame, int& start, int& size) {
+      s64 chunk_start = 0;
+      s64 chunk_end = m_first_chunk_frames;
+      int chunk = 0;
+      while (frame >= chunk_end) {
+        chunk_start = chunk_end;
+        chunk_end *= 2;
+        ++chunk;
+      }
+      start = int(chunk_start);
+      size  = int(std::min(chunk_end, s64(INT_MAX)) - chunk_start);
+      return chunk;
+    }
+
+    enum {
+      DECODE_AHEAD_MS = 500,
+      MIN_CHUNK_FRAMES = 4096,
+      MAX_CHUNKS = 32  // enough to double from MIN_CHUNK_FRAMES to INT_MAX
+    };
+
+    Mutex m_mutex;
+    SampleSourcePtr m_source;
+    int m_frame_size;
+    int m_frame_count;
+    int m_decoded;
+    int m_channel_count;
+    int m_sample_rate;
+    SampleFormat m_sample_format;
+
+    u8* m_chunks[MAX_CHUNKS];  // allocated as decoding reaches them
+    int m_first_chunk_frames;
+    int m_capacity;            // frames allocated in all the chunks
+    u8* m_flat;                // every sample in one block, for getSamples
+  };
+
+
+  LazyBufferStream::LazyBufferStream(LazySampleBuffer* buffer) {
+    m_buffer = buffer;
+    m_frame_size = GetFrameSize(this);
+    m_position = 0;
+  }
+
+
+  void
+  LazyBufferStream::getFormat(
+    int& channel_count,
+    int& sample_rate,
+    SampleFormat& sample_format)
+  {
+    m_buffer->getFormat(channel_count, sample_rate, sample_format);
+  }
+
+
+  int
+  LazyBufferStream::doRead(int frame_count, void* buffer) {
+    const int decoded = m_buffer->decode(m_position + frame_count);
+    const int to_read = clamp(0, decoded - m_position, frame_count);
+    m_buffer->copyFrames(m_position, to_read, (u8*)buffer);
+    m_position += to_read;
+    return to_read;
+  }
+
+
+  int
+  LazyBufferStream::getLength() {
+    return m_buffer->getLength();
+  }
+
+
+  SampleBuffer* AdoptSampleBuffer(
+    u8* samples, int frame_count,
+    int channel_count, int sample_rate, SampleFormat sample_format)
+  {
+    return SampleBufferImpl::Adopt(
+      samples, frame_count,
+      channel_count, sample_rate, sample_format);
+  }
+
+
   ADR_EXPORT(SampleBuffer*) AdrCreateSampleBuffer(
     void* samples,
     int frame_count,
@@ -142,23 +425,24 @@ namespace audiere {
       return 0;
     }
 
-    int length = source->getLength();
     int channel_count, sample_rate;
     SampleFormat sample_format;
     source->getFormat(channel_count, sample_rate, sample_format);
 
-    int stream_length_bytes = length *
-      channel_count * GetSampleSize(sample_format);
-    u8* buffer = new u8[stream_length_bytes];
-
-    source->setPosition(0);
-    source->read(length, buffer);
+    // the length may only be an estimate, so trust what we actually read
+    u8* buffer;
+    int length = DecodeWholeSource(source, buffer);
 
-    SampleBuffer* sb = CreateSampleBuffer(
+    return AdoptSampleBuffer(
       buffer, length, channel_count, sample_rate, sample_format);
+  }
+
 
-    delete[] buffer;
-    return sb;
+  ADR_EXPORT(SampleBuffer*) AdrCreateLazySampleBuffer(SampleSource* source) {
+    if (!source || !source->isSeekable()) {
+      return 0;
+    }
+    return new LazySampleBuffer(source);
   }
 
 }
@@ -0,0 +1,371 @@
+/**
+ * @file
+ *
+ * On-disk cache of decoder seek indices.
+ *
+ * Each entry is a file named after the key of the stream it describes.
+ * The layout is fixed and little-endian, so an entry can be mapped into
+ * memory and read in place:
+ *
+ *   offset  size  contents
+ *        0     4  "ADRS"
+ *        4     4  format version
+ *        8     4  decoder kind, zero padded
+ *       12     4  number of seek points
+ *       16     8  length of the stream file in bytes
+ *       24     8  hash of the stream file's head and tail
+ *       32     8  length of the stream in sample frames
+ *       40     8  decoder-specific value
+ *       48  16*n  seek points: sample position, byte offset
+ */
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4786)
+#endif
+
+#ifdef WIN32
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "debug.h"
+#include "internal.h"
+#include "seek_cache.h"
+#include "threads.h"
+#include "utility.h"
+
+
+namespace audiere {
+
+  static const u8  CACHE_MAGIC[4] = { 'A', 'D', 'R', 'S' };
+  static const u32 CACHE_VERSION  = 1;
+  static const int HEADER_SIZE    = 48;
+  static const int POINT_SIZE     = 16;
+
+  /// how much of each end of the stream goes into the key
+  static const int HASH_SPAN = 65536;
+
+  static Mutex g_cache_mutex;
+  static std::string g_cache_directory;
+  static int g_temp_count;  // makes temporary file names unique
+
+
+  static u64 Read64(const u8* b) {
+    u64 result = 0;
+    for (int i = 7; i >= 0; --i) {
+      result = (result << 8) | b[i];
+    }
+    return result;
+  }
+
+  static u32 Read32(const u8* b) {
+    return b[0] | (b[1] << 8) | (b[2] << 16) | (u32(b[3]) << 24);
+  }
+
+  static void Write64(u8* b, u64 value) {
+    for (int i = 0; i < 8; ++i) {
+      b[i] = u8(value >> (i * 8));
+    }
+  }
+
+  static void Write32(u8* b, u32 value) {
+    for (int i = 0; i < 4; ++i) {
+      b[i] = u8(value >> (i * 8));
+    }
+  }
+
+
+  /// 64-bit FNV-1a
+  static u64 Hash(u64 hash, const u8* data, int size) {
+    for (int i = 0; i < size; ++i) {
+      hash ^= data[i];
+      hash *= 0x100000001B3ULL;
+    }
+    return hash;
+  }
+
+  static u64 HashRange(u64 hash, File* file, int begin, int size) {
+    if (!file->seek(begin, File::BEGIN)) {
+      return hash;
+    }
+    u8 buffer[4096];
+    while (size > 0) {
+      int read = file->read(buffer, std::min(size, int(sizeof(buffer))));
+      if (read <= 0) {
+        break;
+      }
+      hash = Hash(hash, buffer, read);
+      size -= read;
+    }
+    return hash;
+  }
+
+
+  /**
+   * Computes the key for 'file' and returns the path of its cache entry,
+   * or an empty string if the cache is disabled or the file can't be
+   * keyed.
+   */
+  static std::string GetEntryPath(
+    File* file,
+    const char* kind,
+    u64& file_length,
+    u64& hash)
+  {
+    std::string directory;
+    {
+      SYNCHRONIZED(g_cache_mutex);
+      directory = g_cache_directory;
+    }
+    if (directory.empty()) {
+      return "";
+    }
+
+    int position = file->tell();
+    if (!file->seek(0, File::END)) {
+      return "";
+    }
+    int length = file->tell();
+
+    hash = 0xCBF29CE484222325ULL;
+    u8 length_bytes[8];
+    Write64(length_bytes, length);
+    hash = Hash(hash, length_bytes, 8);
+    hash = Hash(hash, (const u8*)kind, strlen(kind));
+    hash = HashRange(hash, file, 0, std::min(length, HASH_SPAN));
+    if (length > HASH_SPAN) {
+      int tail = std::max(HASH_SPAN, length - HASH_SPAN);
+      hash = HashRange(hash, file, tail, length - tail);
+    }
+    file_length = length;
+
+    file->seek(position, File::BEGIN);
+
+    char name[32];
+    sprintf(name, "%08lx%08lx.",
+            (unsigned long)(hash >> 32),
+            (unsigned long)(hash & 0xFFFFFFFF));
+    return directory + "/" + name + kind;
+  }
+
+
+  /// Read-only view of a whole file in memory.
+  class MappedFile {
+  public:
+    MappedFile(const char* path) {
+      m_data = 0;
+      m_size = 0;
+
+#ifdef WIN32
+      m_file = CreateFile(
+        path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, NULL);
+      m_mapping = NULL;
+      if (m_file == INVALID_HANDLE_VALUE) {
+        return;
+      }
+      m_size = GetFileSize(m_file, NULL);
+      m_mapping = CreateFileMapping(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+      if (m_mapping) {
+        m_data = (const u8*)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+      }
+#else
+      int fd = open(path, O_RDONLY);
+      if (fd < 0) {
+        return;
+      }
+      struct stat st;
+      if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* data = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (data != MAP_FAILED) {
+          m_data = (const u8*)data;
+          m_size = st.st_size;
+        }
+      }
+      close(fd);
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef WIN32
+      if (m_data) {
+        UnmapViewOfFile(m_data);
+      }
+      if (m_mapping) {
+        CloseHandle(m_mapping);
+      }
+      if (m_file != INVALID_HANDLE_VALUE) {
+        CloseHandle(m_file);
+      }
+#else
+      if (m_data) {
+        munmap((void*)m_data, m_size);
+      }
+#endif
+    }
+
+    const u8* getData() { return m_data; }
+    int       getSize() { return (m_data ? m_size : 0); }
+
+  private:
+    const u8* m_data;
+    int m_size;
+#ifdef WIN32
+    HANDLE m_file;
+    HANDLE m_mapping;
+#endif
+  };
+
+
+  /// Runs 'check' on the first, middle, and last points of 'index'.
+  static bool CheckSeekPoints(
+    File* file,
+    const SeekIndex& index,
+    SeekPointCheck check)
+  {
+    if (!check || index.points.empty()) {
+      return true;
+    }
+
+    const size_t last = index.points.size() - 1;
+    const size_t samples[3] = { 0, last / 2, last };
+    const int position = file->tell();
+    bool valid = true;
+    for (int i = 0; i < 3 && valid; ++i) {
+      valid = check(file, index.points[samples[i]].offset);
+    }
+    file->seek(position, File::BEGIN);
+    return valid;
+  }
+
+
+  bool LoadSeekIndex(
+    File* file,
+    const char* kind,
+    SeekIndex& index,
+    SeekPointCheck check)
+  {
+    ADR_GUARD("LoadSeekIndex");
+
+    u64 file_length, hash;
+    std::string path = GetEntryPath(file, kind, file_length, hash);
+    if (path.empty()) {
+      return false;
+    }
+
+    MappedFile entry(path.c_str());
+    const u8* data = entry.getData();
+    const int size = entry.getSize();
+    if (size < HEADER_SIZE) {
+      return false;
+    }
+
+    u8 entry_kind[4] = { 0, 0, 0, 0 };
+    memcpy(entry_kind, kind, std::min(int(strlen(kind)), 4));
+
+    const int count = Read32(data + 12);
+    if (memcmp(data, CACHE_MAGIC, 4) != 0 ||
+        Read32(data + 4) != CACHE_VERSION ||
+        memcmp(data + 8, entry_kind, 4) != 0 ||
+        count < 0 || count > (size - HEADER_SIZE) / POINT_SIZE ||
+        Read64(data + 16) != file_length ||
+        Read64(data + 24) != hash)
+    {
+      ADR_LOG("Stale or invalid seek cache entry");
+      return false;
+    }
+
+    index.length = s64(Read64(data + 32));
+    index.extra  = s64(Read64(data + 40));
+    index.points.resize(count);
+    const u8* p = data + HEADER_SIZE;
+    for (int i = 0; i < count; ++i) {
+      index.points[i].position = s64(Read64(p));
+      index.points[i].offset   = s64(Read64(p + 8));
+      p += POINT_SIZE;
+    }
+
+    if (!CheckSeekPoints(file, index, check)) {
+      ADR_LOG("Seek cache entry doesn't match the file's contents");
+      index = SeekIndex();
+      return false;
+    }
+    return true;
+  }
+
+
+  void SaveSeekIndex(File* file, const char* kind, const SeekIndex& index) {
+    ADR_GUARD("SaveSeekIndex");
+
+    u64 file_length, hash;
+    std::string path = GetEntryPath(file, kind, file_length, hash);
+    if (path.empty()) {
+      return;
+    }
+
+    const int count = int(index.points.size());
+    std::vector<u8> data(HEADER_SIZE + count * POINT_SIZE);
+    u8* p = &data[0];
+    memcpy(p, CACHE_MAGIC, 4);
+    Write32(p + 4, CACHE_VERSION);
+    memcpy(p + 8, kind, std::min(int(strlen(kind)), 4));
+    Write32(p + 12, count);
+    Write64(p + 16, file_length);
+    Write64(p + 24, hash);
+    Write64(p + 32, index.length);
+    Write64(p + 40, index.extra);
+    p += HEADER_SIZE;
+    for (int i = 0; i < count; ++i) {
+      Write64(p,     index.points[i].position);
+      Write64(p + 8, index.points[i].offset);
+      p += POINT_SIZE;
+    }
+
+    // Write to a temporary file first so nobody maps a partial entry.  Its
+    // name is unique to this process and call, so other writers of the
+    // same entry can't truncate it.
+#ifdef WIN32
+    unsigned long process = GetCurrentProcessId();
+#else
+    unsigned long process = (unsigned long)getpid();
+#endif
+    int temp_id;
+    {
+      SYNCHRONIZED(g_cache_mutex);
+      temp_id = g_temp_count++;
+    }
+    char suffix[40];
+    sprintf(suffix, ".%lu.%d.tmp", process, temp_id);
+    std::string temp_path = path + suffix;
+    FILE* out = fopen(temp_path.c_str(), "wb");
+    if (!out) {
+      return;
+    }
+    bool written = (fwrite(&data[0], data.size(), 1, out) == 1);
+    written = (fclose(out) == 0) && written;
+
+    if (written) {
+#ifdef WIN32
+      remove(path.c_str());  // rename won't replace an existing file
+#endif
+      written = (rename(temp_path.c_str(), path.c_str()) == 0);
+    }
+    if (!written) {
+      remove(temp_path.c_str());
+    }
+  }
+
+
+  ADR_EXPORT(void) AdrSetSeekCacheDirectory(const char* directory) {
+    SYNCHRONIZED(g_cache_mutex);
+    g_cache_directory = (directory ? directory : "");
+  }
+
+}
@@ -0,0 +1,67 @@
+#ifndef SEEK_CACHE_H
+#define SEEK_CACHE_H
+
+
+#include <vector>
+#include "audiere.h"
+#include "types.h"
+
+
+namespace audiere {
+
+  /// One entry in a cached seek index.
+  struct SeekPoint {
+    s64 position;  ///< sample position
+    s64 offset;    ///< byte offset in the file
+  };
+
+  /**
+   * Seek index of a compressed stream, as stored in the seek cache.  What
+   * the points and the extra value mean is up to the decoder.
+   */
+  struct SeekIndex {
+    SeekIndex() {
+      length = 0;
+      extra = 0;
+    }
+
+    s64 length;  ///< length of the stream in sample frames
+    s64 extra;   ///< decoder-specific value
+    std::vector<SeekPoint> points;
+  };
+
+  /**
+   * Checks that a cached seek point still lands where the decoder expects,
+   * such as on a frame header.  The file position may be left anywhere.
+   */
+  typedef bool (*SeekPointCheck)(File* file, s64 offset);
+
+  /**
+   * Looks for a cached seek index for 'file'.  Cache entries are keyed by
+   * the file's length and a hash of its first and last bytes, so they stay
+   * valid wherever the file is opened from.  An edit to the middle of the
+   * file that keeps its length slips past the key, so if 'check' is given,
+   * the first, middle, and last seek points must pass it too.  The file
+   * position is preserved.
+   *
+   * @param kind  short decoder name, such as "mp3", so different decoders
+   *              never read each other's entries
+   *
+   * @return  true if an index was found and loaded into 'index'
+   */
+  bool LoadSeekIndex(
+    File* file,
+    const char* kind,
+    SeekIndex& index,
+    SeekPointCheck check = 0);
+
+  /**
+   * Stores a seek index for 'file' in the cache.  Does nothing if no cache
+   * directory has been set.  The file position is preserved.
+   */
+  void SaveSeekIndex(File* file, const char* kind, const SeekIndex& index);
+
+}
+
+
+#endif
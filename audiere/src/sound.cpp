@@ -1,6 +1,8 @@
 #include "audiere.h"
 #include "debug.h"
+#include "device.h"
 #include "internal.h"
+#include "parallel_decode.h"
 #include "utility.h"
 
 
@@ -26,23 +28,25 @@ namespace audiere {
       return device->openStream(source.get());
     }
 
-    int stream_length = source->getLength();
     int channel_count, sample_rate;
     SampleFormat sample_format;
     source->getFormat(channel_count, sample_rate, sample_format);
 
-    int stream_length_bytes =
-      stream_length * channel_count * GetSampleSize(sample_format);
-    u8* buffer = new u8[stream_length_bytes];
-    source->setPosition(0);  // in case the source has been read from already
-    source->read(stream_length, buffer);
+    u8* buffer;
+    int stream_length = DecodeWholeSource(source.get(), buffer);
 
-    OutputStream* stream = device->openBuffer(
+    // Devices that mix in software share a SampleBuffer's samples instead
+    // of copying them, so keep the decoded samples in one.
+    SampleBufferPtr sb = AdoptSampleBuffer(
+      buffer, stream_length,
+      channel_count, sample_rate, sample_format);
+    AbstractDevice* abstract_device = GetAbstractDevice(device);
+    if (abstract_device) {
+      return abstract_device->openSampleBuffer(sb.get());
+    }
+    return device->openBuffer(
       buffer, stream_length,
       channel_count, sample_rate, sample_format);
-
-    delete[] buffer;
-    return stream;
   }
 
 }
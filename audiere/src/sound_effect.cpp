@@ -153,7 +153,7 @@ namespace audiere {
       }
         
       case MULTIPLE: {
-        SampleBuffer* sb = CreateSampleBuffer(source);
+        SampleBuffer* sb = CreateLazySampleBuffer(source);
         return (sb ? new MultipleSoundEffect(device, sb) : 0);
       }
 
@@ -162,4 +162,16 @@ namespace audiere {
     }
   }
 
+
+
+  ADR_EXPORT(SoundEffect*) AdrOpenSoundEffectFromBuffer(
+    AudioDevice* device,
+    SampleBuffer* buffer)
+  {
+    if (!device || !buffer) {
+      return 0;
+    }
+    return new MultipleSoundEffect(device, buffer);
+  }
+
 }
@@ -57,7 +57,7 @@ static bool is_speex(Reader *r)
 }
 
 
-speexfile::speexfile ( Reader *r )
+speexfile::speexfile ( Reader *r, const speexseektable *table )
 {
     initialized = false;
 
@@ -78,7 +78,7 @@ speexfile::speexfile ( Reader *r )
     pReader = r;
     seekable = (r->can_seek() != 0);
 
-    if ( initfile() != 0 ) return;
+    if ( initfile(table) != 0 ) return;
 
     initialized = true;
 }
@@ -538,6 +538,25 @@ int32_t speexfile::stream_get_tagcount ( int32_t _stream )
     return stream[_stream]->tagcount;
 }
 
+int32_t speexfile::stream_get_seekcount ( int32_t _stream )
+{
+    if ( _stream < 0 ) _stream = get_stream ();
+    if ( _stream >= streamcount ) return 0;
+
+    return stream[_stream]->sicount;
+}
+
+int speexfile::stream_get_seekpos ( int32_t i, offset_t *offset, int64_t *sample, int32_t _stream )
+{
+    if ( _stream < 0 ) _stream = get_stream ();
+    if ( _stream >= streamcount ) return -1;
+    if ( i < 0 || i >= stream[_stream]->sicount ) return -1;
+
+    *offset = stream[_stream]->seekinfo[i]->offset;
+    *sample = stream[_stream]->seekinfo[i]->sample;
+    return 0;
+}
+
 // -------------------------------------
 
 #define readint(buf, base) ( ((buf[base+3] << 24) & 0xff000000) | \
@@ -732,7 +751,7 @@ void speexfile::free_tags ()
     }
 }
 
-int speexfile::initfile ()
+int speexfile::initfile ( const speexseektable *table )
 {
     char *data;
     uint32_t nb_read;
@@ -740,6 +759,7 @@ int speexfile::initfile ()
     bool init = false;
     bool eos = true;
     bool eof = false;
+    bool done = false;  // with a seek table, stop after the tags
 
     ogg_sync_state   oy;
     ogg_stream_state os;
@@ -752,7 +772,7 @@ int speexfile::initfile ()
 
     if ( !seekable ) return 0;
 
-    while ( !eof ) {
+    while ( !eof && !done ) {
         // Get the ogg buffer for writing
         data = ogg_sync_buffer ( &oy, 200 );
 
@@ -763,7 +783,7 @@ int speexfile::initfile ()
 
         ogg_sync_wrote ( &oy, nb_read );
 
-        while ( ogg_sync_pageout (&oy, &og) == 1 ) {
+        while ( !done && ogg_sync_pageout (&oy, &og) == 1 ) {
             if ( !init ) {
                 ogg_stream_init ( &os, ogg_page_serialno (&og) );
                 init = true;
@@ -773,7 +793,7 @@ int speexfile::initfile ()
             ogg_stream_pagein ( &os, &og );
 
             // Extract all available packets
-            while ( ogg_stream_packetout (&os, &op) == 1 ) {
+            while ( !done && ogg_stream_packetout (&os, &op) == 1 ) {
                 if ( op.b_o_s ) {
                     if ( !eos ) { // previous stream in chain was broken
                     }
@@ -823,8 +843,9 @@ int speexfile::initfile ()
                     if ( readtags ((char *)op.packet, op.bytes) != 0 ) {
                         stream_free_tags ( streamcount-1 );
                     }
+                    if ( table ) done = true;
                 }
-                else if ( (op.packetno > 1) && (op.granulepos > 0) && (streamcount > 0) ) {
+                else if ( !table && (op.packetno > 1) && (op.granulepos > 0) && (streamcount > 0) ) {
                     const int32_t spos = streamcount - 1;
 
                     void *seekinfo_b = (void *)stream[spos]->seekinfo;
@@ -862,6 +883,29 @@ int speexfile::initfile ()
         return -1;
     }
 
+    if ( table ) {
+        if ( streamcount != 1 || table->count <= 0 ) return -1;
+
+        speexseekinfo_t **seekinfo = (speexseekinfo_t **)realloc ( stream[0]->seekinfo, table->count * sizeof (speexseekinfo_t*) );
+        if ( !seekinfo ) {
+            strcpy ( speex_last_error, "Memory allocation failed" );
+            return -1;
+        }
+        stream[0]->seekinfo = seekinfo;
+
+        for ( int32_t i = 0; i < table->count; i++ ) {
+            seekinfo[i] = (speexseekinfo_t *)malloc ( sizeof (speexseekinfo_t) );
+            if ( !seekinfo[i] ) {
+                strcpy ( speex_last_error, "Memory allocation failed" );
+                return -1;
+            }
+            seekinfo[i]->offset = table->offsets[i];
+            seekinfo[i]->sample = table->samples[i];
+            stream[0]->sicount++;
+        }
+        stream[0]->streamsize = table->streamsize;
+    }
+
     pReader->seek ( 0 );
     offset = 0;
 
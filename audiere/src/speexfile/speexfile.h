@@ -55,6 +55,13 @@ namespace speexfile {
         char                *value;         // tag value (can be NULL)
     } speextags;
 
+    typedef struct {
+        int32_t             count;          // number of seek positions
+        const offset_t      *offsets;       // byte offset of each position
+        const int64_t       *samples;       // sample number of each position
+        offset_t            streamsize;     // size in bytes
+    } speexseektable;
+
     class speexfile {
     private:
         typedef struct {
@@ -116,7 +123,7 @@ namespace speexfile {
         int32_t             current_serial;
 
     public:
-        speexfile ( Reader *r );
+        speexfile ( Reader *r, const speexseektable *table = 0 );    // table from an earlier scan skips the scan (single stream only)
         ~speexfile ();
 
         int  seek_sample ( int64_t samplepos );                     // seek to given sample position
@@ -139,11 +146,13 @@ namespace speexfile {
         double    stream_get_bitrate    ( int32_t _stream = -1 );   // return average bitrate in bits / second
         offset_t  stream_get_size       ( int32_t _stream = -1 );   // return size in bytes
         int32_t   stream_get_tagcount   ( int32_t _stream = -1 );   // return number of tag fields
+        int32_t   stream_get_seekcount  ( int32_t _stream = -1 );   // return number of seek positions
+        int       stream_get_seekpos    ( int32_t i, offset_t *offset, int64_t *sample, int32_t _stream = -1 ); // return seek position i
         const speextags**  stream_get_tags        ( int32_t _stream = -1 ); // return pointer to tag struct
         const SpeexHeader* stream_get_speexheader ( int32_t _stream = -1 ); // return pointer to header struct
 
     private:
-        int  initfile ();                                           // read file header and scan lengths and seek positions
+        int  initfile ( const speexseektable *table );              // read file header and scan lengths and seek positions
         int  init_decoder  ();                                      // initialize Speex decoder
         int  close_decoder ();                                      // free Speex decoder
         int  readtags ( char *tagdata, long size );                 // read tags
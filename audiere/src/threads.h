@@ -21,6 +21,9 @@ namespace audiere {
   // waiting
   void AI_Sleep(unsigned milliseconds);
 
+  // number of processors the threads can run on, at least 1
+  int AI_GetProcessorCount();
+
 
   class Mutex {
   public:
@@ -52,6 +55,26 @@ namespace audiere {
   };
 
 
+  /**
+   * Counts posts, so unlike a CondVar it can't miss one that comes before
+   * the wait.  post() never blocks, so threads that mustn't wait on a lock
+   * can use it to wake others.
+   */
+  class Semaphore {
+  public:
+    Semaphore();
+    ~Semaphore();
+
+    /// Takes one post, waiting up to seconds for it.  Returns whether it did.
+    bool wait(float seconds);
+    void post();
+
+  private:
+    struct Impl;
+    Impl* m_impl;
+  };
+
+
   class ScopedLock {
   public:
     ScopedLock(Mutex& mutex): m_mutex(mutex) {
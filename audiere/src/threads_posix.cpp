@@ -1,7 +1,13 @@
+#include <errno.h>
 #include <math.h>
 #include <unistd.h>
 #include <pthread.h>
 #include <sys/time.h>
+#ifdef __APPLE__
+  #include <dispatch/dispatch.h>
+#else
+  #include <semaphore.h>
+#endif
 #include "threads.h"
 #include "utility.h"
 
@@ -86,6 +92,16 @@ namespace audiere {
   }
 
 
+  int AI_GetProcessorCount() {
+#ifdef _SC_NPROCESSORS_ONLN
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0 ? int(count) : 1);
+#else
+    return 1;
+#endif
+  }
+
+
   struct Mutex::Impl {
     pthread_mutex_t mutex;
   };
@@ -152,4 +168,83 @@ namespace audiere {
     pthread_cond_signal(&m_impl->cond);
   }
 
+
+
+#ifdef __APPLE__
+
+  // Mac OS X doesn't implement unnamed POSIX semaphores.
+
+  struct Semaphore::Impl {
+    dispatch_semaphore_t semaphore;
+  };
+
+  Semaphore::Semaphore() {
+    m_impl = new Impl;
+    m_impl->semaphore = dispatch_semaphore_create(0);
+    if (!m_impl->semaphore) {
+      delete m_impl;
+      m_impl = 0;
+      ADR_LOG("dispatch_semaphore_create() failed in Semaphore::Semaphore()");
+      abort();
+    }
+  }
+
+  Semaphore::~Semaphore() {
+    dispatch_release(m_impl->semaphore);
+    delete m_impl;
+  }
+
+  bool Semaphore::wait(float seconds) {
+    dispatch_time_t timeout = dispatch_time(
+      DISPATCH_TIME_NOW, int64_t(seconds * 1000000000.0));
+    return (dispatch_semaphore_wait(m_impl->semaphore, timeout) == 0);
+  }
+
+  void Semaphore::post() {
+    dispatch_semaphore_signal(m_impl->semaphore);
+  }
+
+#else
+
+  struct Semaphore::Impl {
+    sem_t semaphore;
+  };
+
+  Semaphore::Semaphore() {
+    m_impl = new Impl;
+    if (sem_init(&m_impl->semaphore, 0, 0) != 0) {
+      delete m_impl;
+      m_impl = 0;
+      ADR_LOG("sem_init() failed in Semaphore::Semaphore()");
+      abort();
+    }
+  }
+
+  Semaphore::~Semaphore() {
+    sem_destroy(&m_impl->semaphore);
+    delete m_impl;
+  }
+
+  bool Semaphore::wait(float seconds) {
+    timeval tv;
+    gettimeofday(&tv, 0);
+    double ds = tv.tv_sec + tv.tv_usec / 1000000.0 + seconds;
+
+    timespec ts;
+    ts.tv_sec  = time_t(ds);
+    ts.tv_nsec = long((ds - floor(ds)) * 1000000000);
+    int result;
+    do {
+      result = sem_timedwait(&m_impl->semaphore, &ts);
+    } while (result != 0 && errno == EINTR);
+    return (result == 0);
+  }
+
+  void Semaphore::post() {
+    sem_post(&m_impl->semaphore);
+  }
+
+#endif
+
+
 }
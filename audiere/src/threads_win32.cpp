@@ -85,6 +85,13 @@ namespace audiere {
   }
 
 
+  int AI_GetProcessorCount() {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (info.dwNumberOfProcessors > 0 ? int(info.dwNumberOfProcessors) : 1);
+  }
+
+
   struct Mutex::Impl {
     CRITICAL_SECTION cs;
   };
@@ -141,4 +148,34 @@ namespace audiere {
     SetEvent(m_impl->event);
   }
 
+
+
+  struct Semaphore::Impl {
+    HANDLE semaphore;
+  };
+
+  Semaphore::Semaphore() {
+    m_impl = new Impl;
+    m_impl->semaphore = CreateSemaphore(0, 0, LONG_MAX, 0);
+    if (!m_impl->semaphore) {
+      ADR_LOG("CreateSemaphore() failed");
+      abort();
+    }
+  }
+
+  Semaphore::~Semaphore() {
+    CloseHandle(m_impl->semaphore);
+    delete m_impl;
+  }
+
+  bool Semaphore::wait(float seconds) {
+    return WaitForSingleObject(
+      m_impl->semaphore, int(seconds * 1000)) == WAIT_OBJECT_0;
+  }
+
+  void Semaphore::post() {
+    ReleaseSemaphore(m_impl->semaphore, 1, 0);
+  }
+
+
 }
@@ -9,6 +9,7 @@
 #include <ctype.h>
 #include "utility.h"
 #include "internal.h"
+#include "threads.h"
 #include <stdio.h>
 
 
@@ -101,13 +102,47 @@ namespace audiere {
     return InterlockedDecrement(&var);
   }
 
+#elif defined(__GNUC__) && \
+      (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))
+
+  // Taking a reference needs no ordering, since the caller already holds
+  // one.  Dropping one releases this thread's writes to the object, and
+  // the thread that drops the last one acquires all of them before the
+  // object is destroyed.
+
+  ADR_EXPORT(long) AdrAtomicIncrement(volatile long& var) {
+    return __atomic_add_fetch(&var, 1, __ATOMIC_RELAXED);
+  }
+
+  ADR_EXPORT(long) AdrAtomicDecrement(volatile long& var) {
+    return __atomic_sub_fetch(&var, 1, __ATOMIC_ACQ_REL);
+  }
+
+#elif defined(__GNUC__) && \
+      (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+
+  // the older builtins are full barriers
+
+  ADR_EXPORT(long) AdrAtomicIncrement(volatile long& var) {
+    return __sync_add_and_fetch(&var, 1);
+  }
+
+  ADR_EXPORT(long) AdrAtomicDecrement(volatile long& var) {
+    return __sync_sub_and_fetch(&var, 1);
+  }
+
 #else
 
+  // no atomic builtins, so fall back to a lock
+  static Mutex g_atomic_mutex;
+
   ADR_EXPORT(long) AdrAtomicIncrement(volatile long& var) {
+    SYNCHRONIZED(g_atomic_mutex);
     return ++var;
   }
 
   ADR_EXPORT(long) AdrAtomicDecrement(volatile long& var) {
+    SYNCHRONIZED(g_atomic_mutex);
     return --var;
   }
 
@@ -117,6 +152,7 @@ namespace audiere {
     switch (format) {
       case SF_U8:  return 1;
       case SF_S16: return 2;
+      case SF_F32: return 4;
       default:     return 0;
     }
   }
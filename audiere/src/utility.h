@@ -92,11 +92,11 @@ namespace audiere {
   }
 
   inline u32 read32_le(const u8* b) {
-    return read16_le(b) + (read16_le(b + 2) << 16);
+    return read16_le(b) + (u32(read16_le(b + 2)) << 16);
   }
 
   inline u32 read32_be(const u8* b) {
-    return (read16_be(b) << 16) + read16_be(b + 2);
+    return (u32(read16_be(b)) << 16) + read16_be(b + 2);
   }
 
   /// Converts an 80-bit IEEE 754 floating point number to a u32.
@@ -124,6 +124,15 @@ namespace audiere {
   }
 
 
+  /**
+   * Creates a SampleBuffer that owns samples, which must have been
+   * allocated with new u8[], instead of copying them.
+   */
+  SampleBuffer* AdoptSampleBuffer(
+    u8* samples, int frame_count,
+    int channel_count, int sample_rate, SampleFormat sample_format);
+
+
   inline SampleSource* OpenBufferStream(
     void* samples, int sample_count,
     int channel_count, int sample_rate, SampleFormat sample_format)
@@ -134,58 +143,152 @@ namespace audiere {
   }
 
 
-  class QueueBuffer {
+  /**
+   * FIFO byte queue backed by a power-of-two ring.  Reads and writes never
+   * move the bytes already queued, and the readable and writable regions
+   * are exposed as contiguous spans so callers can produce into or consume
+   * from the ring without an intermediate copy.  A span ends at the wrap
+   * point, so data that straddles it comes back as two spans.
+   *
+   * The capacity only grows when a reserve() or write() asks for more room
+   * than the ring has, which for a decoder happens at most a few times
+   * while it sees its largest frame.
+   */
+  class RingBuffer {
   public:
-    QueueBuffer() {
-      m_capacity = 256;
-      m_size = 0;
+    RingBuffer(int capacity = 4096) {
+      m_capacity = RoundCapacity(capacity);
+      m_read = 0;
+      m_write = 0;
 
       m_buffer = (u8*)malloc(m_capacity);
     }
 
-    ~QueueBuffer() {
+    ~RingBuffer() {
       m_buffer = (u8*)realloc(m_buffer, 0);
     }
 
     int getSize() {
-      return m_size;
+      return int(m_write - m_read);
     }
 
-    void write(const void* buffer, int size) {
-      bool need_realloc = false;
-      while (size + m_size > m_capacity) {
-        m_capacity *= 2;
-        need_realloc = true;
+    int getCapacity() {
+      return m_capacity;
+    }
+
+    /// Makes sure at least 'size' more bytes can be written.
+    void reserve(int size) {
+      if (getSize() + size <= m_capacity) {
+        return;
       }
 
-      if (need_realloc) {
-        m_buffer = (u8*)realloc(m_buffer, m_capacity);
+      // Unwrap into a new, larger ring.
+      const int queued = getSize();
+      const int capacity = RoundCapacity(queued + size);
+      u8* buffer = (u8*)malloc(capacity);
+      read(buffer, queued);
+      m_buffer = (u8*)realloc(m_buffer, 0);
+      m_buffer = buffer;
+      m_capacity = capacity;
+      m_read = 0;
+      m_write = queued;
+    }
+
+    /**
+     * Returns the longest contiguous run of queued bytes starting at the
+     * front of the queue.  Call consume() once they have been used.
+     *
+     * @return  number of bytes at 'data', 0 if the queue is empty
+     */
+    int getReadSpan(const u8*& data) {
+      const int offset = int(m_read & (m_capacity - 1));
+      data = m_buffer + offset;
+      return std::min(getSize(), m_capacity - offset);
+    }
+
+    /**
+     * Returns the longest contiguous run of free space at the back of the
+     * queue.  Call commit() with the number of bytes actually written.
+     */
+    int getWriteSpan(u8*& data) {
+      const int offset = int(m_write & (m_capacity - 1));
+      data = m_buffer + offset;
+      return std::min(m_capacity - getSize(), m_capacity - offset);
+    }
+
+    /// Drops up to 'size' bytes from the front of the queue.
+    int consume(int size) {
+      const int to_consume = std::min(size, getSize());
+      m_read += to_consume;
+      if (m_read == m_write) {
+        // Start over at the beginning so the next write is contiguous.
+        m_read = m_write = 0;
       }
+      return to_consume;
+    }
 
-      memcpy(m_buffer + m_size, buffer, size);
-      m_size += size;
+    /// Appends 'size' bytes written through getWriteSpan().
+    void commit(int size) {
+      m_write += size;
+    }
+
+    void write(const void* buffer, int size) {
+      reserve(size);
+      const u8* in = (const u8*)buffer;
+      while (size > 0) {
+        u8* span;
+        const int count = std::min(size, getWriteSpan(span));
+        memcpy(span, in, count);
+        commit(count);
+        in += count;
+        size -= count;
+      }
     }
 
     int read(void* buffer, int size) {
-      int to_read = std::min(size, m_size);
-      memcpy(buffer, m_buffer, to_read);
-      memmove(m_buffer, m_buffer + to_read, m_size - to_read);
-      m_size -= to_read;
-      return to_read;
+      u8* out = (u8*)buffer;
+      int total = 0;
+      while (total < size) {
+        const u8* span;
+        const int count = std::min(size - total, getReadSpan(span));
+        if (count == 0) {
+          break;
+        }
+        memcpy(out + total, span, count);
+        consume(count);
+        total += count;
+      }
+      return total;
+    }
+
+    int discard(int size) {
+      return consume(size);
     }
 
     void clear() {
-      m_size = 0;
+      m_read = m_write = 0;
     }
 
   private:
+    static int RoundCapacity(int size) {
+      int capacity = 256;
+      while (capacity < size) {
+        capacity *= 2;
+      }
+      return capacity;
+    }
+
     u8* m_buffer;
     int m_capacity;
-    int m_size;
+
+    // Running totals of bytes read and written.  Only their difference and
+    // their low bits matter, so they are allowed to wrap.
+    unsigned m_read;
+    unsigned m_write;
 
     // private and unimplemented to prevent their use
-    QueueBuffer(const QueueBuffer&);
-    QueueBuffer& operator=(const QueueBuffer&);
+    RingBuffer(const RingBuffer&);
+    RingBuffer& operator=(const RingBuffer&);
   };
 
 
@@ -92,6 +92,22 @@ LINK32=link.exe
 # PROP Default_Filter ""
 # Begin Source File
 
+SOURCE=..\..\src\adpcm.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\adpcm.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\adpcm_buffer.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\atomic.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\src\audiere.h
 # End Source File
 # Begin Source File
@@ -108,6 +124,26 @@ SOURCE=..\..\src\basic_source.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\src\compressed_buffer.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\convert.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\convert.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\cpu.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\cpu.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\src\cd_win32.cpp
 # End Source File
 # Begin Source File
@@ -120,6 +156,14 @@ SOURCE=..\..\src\debug.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\src\decoder_pool.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\decoder_pool.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\src\default_file.h
 # End Source File
 # Begin Source File
@@ -196,6 +240,10 @@ SOURCE=..\..\src\input.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\src\input.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\src\input_aiff.cpp
 # End Source File
 # Begin Source File
@@ -256,6 +304,10 @@ SOURCE=..\..\src\internal.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\src\lockfree_queue.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\src\loop_point_source.cpp
 # End Source File
 # Begin Source File
@@ -272,6 +324,14 @@ SOURCE=..\..\src\memory_file.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\src\mp3_info.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\mp3_info.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\src\midi_mci.cpp
 # End Source File
 # Begin Source File
@@ -280,6 +340,26 @@ SOURCE=..\..\src\noise.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\src\parallel_decode.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\parallel_decode.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\pipeline.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\pipeline.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\probe.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\src\resampler.cpp
 # End Source File
 # Begin Source File
@@ -292,6 +372,14 @@ SOURCE=..\..\src\sample_buffer.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\src\seek_cache.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\seek_cache.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\src\sound.cpp
 # End Source File
 # Begin Source File
@@ -352,6 +440,10 @@ SOURCE=..\..\src\mpaudec\bits.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\src\mpaudec\fixed.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\src\mpaudec\internal.h
 # End Source File
 # Begin Source File
@@ -368,8 +460,32 @@ SOURCE=..\..\src\mpaudec\mpaudectab.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\src\mpaudec\mpaudectab_gen.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\src\mpaudec\mpegaudio.h
 # End Source File
+# Begin Source File
+
+SOURCE=..\..\src\mpaudec\simd.c
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\mpaudec\simd.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\mpaudec\simd_avx2.c
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\mpaudec\simd_kernels.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\src\mpaudec\simd_sse2.c
+# End Source File
 # End Group
 # Begin Group "speexfile"
 